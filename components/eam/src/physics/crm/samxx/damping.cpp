@@ -1,32 +1,17 @@
 
 #include "damping.h"
 
-void damping() {
+// Compute the number of damped levels, and the inverse relaxation time scale
+// (nonzero only in the damped levels) for each CRM
+void damping_coefs(int1d const &n_damp, real2d const &tau) {
   YAKL_SCOPE( z              , ::z );
-  YAKL_SCOPE( u              , ::u );
-  YAKL_SCOPE( v              , ::v );
-  YAKL_SCOPE( t              , ::t );
-  YAKL_SCOPE( na             , ::na );
-  YAKL_SCOPE( dudt           , ::dudt );
-  YAKL_SCOPE( dvdt           , ::dvdt );
-  YAKL_SCOPE( dwdt           , ::dwdt );
-  YAKL_SCOPE( w              , ::w );
-  YAKL_SCOPE( dtn            , ::dtn );
-  YAKL_SCOPE( micro_field    , ::micro_field );
-  YAKL_SCOPE( qv             , ::qv );
-  YAKL_SCOPE( qv0            , ::qv0 );
   YAKL_SCOPE( ncrms          , ::ncrms );
 
   real constexpr tau_min    = 60.0;
   real constexpr tau_max    = 450.0;
   real constexpr fractional_damp_depth = 0.4;
 
-  int1d  n_damp    ("n_damp",ncrms);
   int2d  do_damping("n_damp",nzm,ncrms);
-  real2d t0loc     ("t0loc" ,nzm,ncrms);
-  real2d u0loc     ("u0loc" ,nzm,ncrms);
-  real2d v0loc     ("v0loc" ,nzm,ncrms);
-  real2d tau       ("tau"   ,nzm,ncrms);
 
   if (tau_min < 2.0*dt) { 
     std::cout << "Error: in damping() tau_min is too small!";
@@ -58,6 +43,30 @@ void damping() {
       tau(k,icrm) = 1. / tau(k,icrm);
     }
   });
+}
+
+void damping() {
+  YAKL_SCOPE( u              , ::u );
+  YAKL_SCOPE( v              , ::v );
+  YAKL_SCOPE( t              , ::t );
+  YAKL_SCOPE( na             , ::na );
+  YAKL_SCOPE( dudt           , ::dudt );
+  YAKL_SCOPE( dvdt           , ::dvdt );
+  YAKL_SCOPE( dwdt           , ::dwdt );
+  YAKL_SCOPE( w              , ::w );
+  YAKL_SCOPE( dtn            , ::dtn );
+  YAKL_SCOPE( micro_field    , ::micro_field );
+  YAKL_SCOPE( qv             , ::qv );
+  YAKL_SCOPE( qv0            , ::qv0 );
+  YAKL_SCOPE( ncrms          , ::ncrms );
+
+  int1d  n_damp    ("n_damp",ncrms);
+  real2d t0loc     ("t0loc" ,nzm,ncrms);
+  real2d u0loc     ("u0loc" ,nzm,ncrms);
+  real2d v0loc     ("v0loc" ,nzm,ncrms);
+  real2d tau       ("tau"   ,nzm,ncrms);
+
+  damping_coefs(n_damp, tau);
 
   // recalculate grid-mean u0, v0, t0 first,
   // as t has been updated. No need for qv0, as
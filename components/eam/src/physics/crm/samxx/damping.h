@@ -4,5 +4,7 @@
 #include "samxx_const.h"
 #include "vars.h"
 
+void damping_coefs(int1d const &n_damp, real2d const &tau);
+
 void damping();
 
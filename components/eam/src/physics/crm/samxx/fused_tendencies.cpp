@@ -0,0 +1,183 @@
+
+#include "fused_tendencies.h"
+
+// On CPUs, each of zero(), buoyancy(), forcing(), the radiative heating, and damping()
+// streams the whole CRM state through memory. Since all of them are pointwise (or
+// only need horizontal means at each level), they can be computed in a single pass
+// over tiles of (k,icrm), sized so that the tile stays in cache between the stages.
+// The horizontal sums are accumulated in the same (j,i) order as the separate stages,
+// so that results are bit-for-bit identical.
+
+// Number of CRMs per tile (the CRM index is the fastest varying one), and target
+// size (in bytes) of the tile working set, used to set the number of levels per tile
+int  constexpr crm_tile_ncrms = 8;
+int  constexpr crm_tile_bytes = 256*1024;
+// Approximate number of 3D variables touched for each grid point
+int  constexpr crm_tile_nvars = 20;
+int  constexpr crm_tile_nz0   = crm_tile_bytes / (crm_tile_ncrms*nx*ny*crm_tile_nvars*(int)sizeof(real));
+int  constexpr crm_tile_nz    = crm_tile_nz0 > 1 ? crm_tile_nz0 : 1;
+
+bool use_fused_tendencies() {
+#if defined(MMF_FUSED_TENDENCIES) && !defined(YAKL_ARCH_CUDA) && !defined(YAKL_ARCH_HIP) && \
+    !defined(YAKL_ARCH_SYCL) && !defined(YAKL_ARCH_OPENMP45)
+  // The variance transport forcing sits between buoyancy() and forcing()
+  return !use_VT;
+#else
+  return false;
+#endif
+}
+
+void fused_tendencies() {
+  YAKL_SCOPE( dudt          , ::dudt );
+  YAKL_SCOPE( dvdt          , ::dvdt );
+  YAKL_SCOPE( dwdt          , ::dwdt );
+  YAKL_SCOPE( misc          , ::misc );
+  YAKL_SCOPE( na            , ::na );
+  YAKL_SCOPE( adz           , ::adz );
+  YAKL_SCOPE( bet           , ::bet );
+  YAKL_SCOPE( tabs0         , ::tabs0 );
+  YAKL_SCOPE( epsv          , ::epsv );
+  YAKL_SCOPE( qv            , ::qv );
+  YAKL_SCOPE( qv0           , ::qv0 );
+  YAKL_SCOPE( qcl           , ::qcl );
+  YAKL_SCOPE( qci           , ::qci );
+  YAKL_SCOPE( qn0           , ::qn0 );
+  YAKL_SCOPE( qpl           , ::qpl );
+  YAKL_SCOPE( qpi           , ::qpi );
+  YAKL_SCOPE( qp0           , ::qp0 );
+  YAKL_SCOPE( tabs          , ::tabs );
+  YAKL_SCOPE( t             , ::t );
+  YAKL_SCOPE( u             , ::u );
+  YAKL_SCOPE( v             , ::v );
+  YAKL_SCOPE( w             , ::w );
+  YAKL_SCOPE( ttend         , ::ttend );
+  YAKL_SCOPE( qtend         , ::qtend );
+  YAKL_SCOPE( utend         , ::utend );
+  YAKL_SCOPE( vtend         , ::vtend );
+  YAKL_SCOPE( micro_field   , ::micro_field );
+  YAKL_SCOPE( crm_rad_qrad  , ::crm_rad_qrad );
+  YAKL_SCOPE( dtn           , ::dtn );
+  YAKL_SCOPE( ncrms         , ::ncrms );
+
+  bool do_buoyancy = !docolumn;
+  bool do_damping  = dodamping;
+
+  int1d  n_damp("n_damp",ncrms);
+  real2d tau   ("tau"   ,nzm,ncrms);
+  if (do_damping) {
+    damping_coefs(n_damp, tau);
+  }
+
+  int ntiles_z    = (nz   +crm_tile_nz   -1)/crm_tile_nz;
+  int ntiles_crms = (ncrms+crm_tile_ncrms-1)/crm_tile_ncrms;
+
+  // for (int kt=0; kt<ntiles_z; kt++) {
+  //   for (int ct=0; ct<ntiles_crms; ct++) {
+  parallel_for( SimpleBounds<2>(ntiles_z,ntiles_crms) , YAKL_LAMBDA (int kt, int ct) {
+    int k_beg = kt*crm_tile_nz;
+    int k_end = min(k_beg+crm_tile_nz,nz);
+    int c_beg = ct*crm_tile_ncrms;
+    int c_end = min(c_beg+crm_tile_ncrms,ncrms);
+
+    for (int k=k_beg; k<k_end; k++) {
+      real qneg [crm_tile_ncrms];
+      real qpoz [crm_tile_ncrms];
+      int  nneg [crm_tile_ncrms];
+      real u0loc[crm_tile_ncrms];
+      real v0loc[crm_tile_ncrms];
+      real t0loc[crm_tile_ncrms];
+      for (int ic=0; ic<crm_tile_ncrms; ic++) {
+        qneg [ic] = 0.0;
+        qpoz [ic] = 0.0;
+        nneg [ic] = 0;
+        u0loc[ic] = 0.0;
+        v0loc[ic] = 0.0;
+        t0loc[ic] = 0.0;
+      }
+
+      // zero(), buoyancy(), first part of forcing(), radiative heating,
+      // and horizontal means for damping()
+      for (int j=0; j<nyp1; j++) {
+        for (int i=0; i<nxp1; i++) {
+          for (int icrm=c_beg; icrm<c_end; icrm++) {
+            int ic = icrm-c_beg;
+            if(i<nxp1 && j<ny && k<nzm){ dudt(na-1,k,j,i,icrm) = 0.0; }
+            if(i<nx && j<nyp1 && k<nzm){ dvdt(na-1,k,j,i,icrm) = 0.0; }
+            if(i<nx && j<ny && k<nz){ dwdt(na-1,k,j,i,icrm) = 0.0; }
+            if(i<nx && j<ny && k<nz){ misc(k,j,i,icrm) = 0.0; }
+
+            if (i>=nx || j>=ny || k>=nzm) { continue; }
+
+            if (do_buoyancy && k>=1) {
+              int km = k-1;
+              real betu, betd;
+              betu = adz(km,icrm)/(adz(k,icrm)+adz(km,icrm));
+              betd = adz(k,icrm)/(adz(k,icrm)+adz(km,icrm));
+
+              dwdt(na-1,k,j,i,icrm) =
+                    dwdt(na-1,k,j,i,icrm) +
+                       bet(k,icrm)*betu*
+                       ( tabs0(k,icrm)*(epsv*(qv(k,j,i,icrm)-qv0(k,icrm))-(qcl(k,j,i,icrm)+qci(k,j,i,icrm)-
+                                        qn0(k,icrm)+qpl(k,j,i,icrm)+qpi(k,j,i,icrm)-qp0(k,icrm)))
+                       +(tabs(k,j,i,icrm)-tabs0(k,icrm))*(1.0+epsv*qv0(k,icrm)-qn0(k,icrm)-qp0(k,icrm)) )
+                       +bet(km,icrm)*betd*
+                       ( tabs0(km,icrm)*(epsv*(qv(km,j,i,icrm)-qv0(km,icrm))-(qcl(km,j,i,icrm)+qci(km,j,i,icrm)-
+                                         qn0(km,icrm)+qpl(km,j,i,icrm)+qpi(km,j,i,icrm)-qp0(km,icrm)))
+                       +(tabs(km,j,i,icrm)-tabs0(km,icrm))*(1.0+epsv*qv0(km,icrm)-qn0(km,icrm)-qp0(km,icrm)) );
+            }
+
+            t(k, j+offy_s, i+offx_s, icrm) = t(k, j+offy_s, i+offx_s, icrm) + ttend(k,icrm) * dtn;
+            micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) =
+                  micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) + qtend(k,icrm) * dtn;
+
+            if (micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) < 0.0) {
+              nneg[ic] += 1;
+              qneg[ic] += micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm);
+            } else {
+              qpoz[ic] += micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm);
+            }
+            dudt(na-1,k,j,i,icrm) = dudt(na-1,k,j,i,icrm) + utend(k,icrm);
+            dvdt(na-1,k,j,i,icrm) = dvdt(na-1,k,j,i,icrm) + vtend(k,icrm);
+
+            int i_rad = i / (nx/crm_nx_rad);
+            int j_rad = j / (ny/crm_ny_rad);
+            t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn;
+
+            if (do_damping) {
+              u0loc[ic] += u(k,offy_u+j,offx_u+i,icrm)/( (real) nx * (real) ny );
+              v0loc[ic] += v(k,offy_v+j,offx_v+i,icrm)/( (real) nx * (real) ny );
+              t0loc[ic] += t(k,offy_s+j,offx_s+i,icrm)/( (real) nx * (real) ny );
+            }
+          }
+        }
+      }
+
+      if (k>=nzm) { continue; }
+
+      // Water vapor fixer from forcing(), and damping()
+      for (int j=0; j<ny; j++) {
+        for (int i=0; i<nx; i++) {
+          for (int icrm=c_beg; icrm<c_end; icrm++) {
+            int ic = icrm-c_beg;
+            real factor;
+            if(nneg[ic] > 0 && qpoz[ic]+qneg[ic] > 0.0) {
+              factor =  1.0 + qneg[ic]/qpoz[ic];
+              micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) =
+                    max(0.0,micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm)*factor);
+            }
+
+            int idwv = index_water_vapor;
+            if ( do_damping && k <= nzm-1 && k >= nzm-1-n_damp(icrm) ) {
+              dudt       (na-1,k,       j,       i,icrm) -=     (u (k,offy_u+j,offx_u+i,icrm)-u0loc[ic]) * tau(k,icrm);
+              dvdt       (na-1,k,       j,       i,icrm) -=     (v (k,offy_v+j,offx_v+i,icrm)-v0loc[ic]) * tau(k,icrm);
+              dwdt       (na-1,k,       j,       i,icrm) -=      w (k,offy_w+j,offx_w+i,icrm)            * tau(k,icrm);
+              t          (     k,offy_s+j,offx_s+i,icrm) -= dtn*(t (k,offy_s+j,offx_s+i,icrm)-t0loc[ic]) * tau(k,icrm);
+              micro_field(idwv,k,offy_s+j,offx_s+i,icrm) -= dtn*(qv(k,       j,       i,icrm)-qv0  (k,icrm)) * tau(k,icrm);
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
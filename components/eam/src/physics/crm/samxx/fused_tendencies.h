@@ -0,0 +1,14 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include "vars.h"
+#include "damping.h"
+
+// Whether the pointwise tendencies at the start of each subcycle can be computed
+// with fused_tendencies() rather than with the separate stages. This is opt-in
+// (build with -DMMF_FUSED_TENDENCIES), and only available on CPU builds.
+bool use_fused_tendencies();
+
+void fused_tendencies();
+
@@ -3,71 +3,86 @@
 #include "vars.h"
 
 void kurant () {
-  YAKL_SCOPE( w     , ::w );
-  YAKL_SCOPE( u     , ::u );
-  YAKL_SCOPE( v     , ::v );
-  YAKL_SCOPE( dt    , ::dt );
-  YAKL_SCOPE( dx    , ::dx );
-  YAKL_SCOPE( dy    , ::dy );
-  YAKL_SCOPE( dz    , ::dz );
-  YAKL_SCOPE( adzw  , ::adzw );
-  YAKL_SCOPE( ncrms , ::ncrms );
+  YAKL_SCOPE( w              , ::w );
+  YAKL_SCOPE( u              , ::u );
+  YAKL_SCOPE( v              , ::v );
+  YAKL_SCOPE( dt             , ::dt );
+  YAKL_SCOPE( dx             , ::dx );
+  YAKL_SCOPE( dy             , ::dy );
+  YAKL_SCOPE( dz             , ::dz );
+  YAKL_SCOPE( adzw           , ::adzw );
+  YAKL_SCOPE( ncrms          , ::ncrms );
+  YAKL_SCOPE( wm             , ::kurant_wm );
+  YAKL_SCOPE( uhm            , ::kurant_uhm );
+  YAKL_SCOPE( cfl            , ::kurant_cfl );
+  YAKL_SCOPE( cfl_crm        , ::kurant_cfl_crm );
+  YAKL_SCOPE( ncycle_dev     , ::kurant_ncycle );
 
   int constexpr max_ncycle = 4;
-  real cfl;
 
-  real2d wm    ("wm"   ,nz ,ncrms);
-  real2d uhm   ("uhm"  ,nz ,ncrms);
-  real2d tmpMax("uhMax",nzm,ncrms);
-
-  ncycle = 1;
+  // The max over each horizontal plane is computed by a single thread,
+  // rather than with atomics over the whole grid
+  // for (int k=0; k<nz; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    wm(k,icrm) = 0.0;
-    uhm(k,icrm) = 0.0;
+    real wmax  = 0.0;
+    real uhmax = 0.0;
+    if (k < nzm) {
+      for (int j=0; j<ny; j++) {
+        for (int i=0; i<nx; i++) {
+          wmax = max( wmax , fabs(w(k,j+offy_w,i+offx_w,icrm)) );
+
+          real utmp = u(k,j+offy_u,i+offx_u,icrm);
+          real vtmp = v(k,j+offy_v,i+offx_v,icrm);
+          uhmax = max( uhmax , sqrt(utmp*utmp +YES3D*vtmp*vtmp) );
+        }
+      }
+    }
+    wm (k,icrm) = wmax;
+    uhm(k,icrm) = uhmax;
   });
 
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny; j++) {
-  //     for (int i=0; i<nx; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    real tmp;
-    tmp = fabs(w(k,j+offy_w,i+offx_w,icrm));
-    yakl::atomicMax(wm(k,icrm),tmp);
+  kurant_sgs(cfl);
 
-    real utmp = u(k,j+offy_u,i+offx_u,icrm);
-    real vtmp = v(k,j+offy_v,i+offx_v,icrm);
-    tmp = sqrt(utmp*utmp +YES3D*vtmp*vtmp);
-    yakl::atomicMax(uhm(k,icrm),tmp);
+  // Max over the levels of each CRM. NaNs are propagated, so they can be detected below.
+  // for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    real cflmax = 0.0;
+    for (int k=0; k<nzm; k++) {
+      real tmp1 = uhm(k,icrm)*dt*sqrt(1.0/(dx*dx) + YES3D*1.0/(dy*dy));
+      real dztemp = dz(icrm)*adzw(k,icrm);
+      real tmp2 = wm(k,icrm)*dt/dztemp;
+      real tmp3 = wm(k+1,icrm)*dt/dztemp;
+      real tmp = max(max(max(tmp1,tmp2),tmp3),cfl(k,icrm));
+      if (tmp != tmp || tmp > cflmax) { cflmax = tmp; }
+    }
+    cfl_crm(icrm) = cflmax;
   });
 
-
-  cfl = 0.0;
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    real tmp1 = uhm(k,icrm)*dt*sqrt(1.0/(dx*dx) + YES3D*1.0/(dy*dy));
-    real dztemp = dz(icrm)*adzw(k,icrm);
-    real tmp2 = wm(k,icrm)*dt/dztemp;
-    real tmp3 = wm(k+1,icrm)*dt/dztemp;
-    tmpMax(k,icrm) = max(max(tmp1,tmp2),tmp3);
+  // Max over all CRMs, and number of subcycles (-1 if the CFL number is NaN)
+  parallel_for( 1 , YAKL_LAMBDA (int dummy) {
+    real cflmax = 0.0;
+    for (int icrm=0; icrm<ncrms; icrm++) {
+      if (cfl_crm(icrm) != cfl_crm(icrm) || cfl_crm(icrm) > cflmax) { cflmax = cfl_crm(icrm); }
+    }
+    if (cflmax != cflmax) {
+      ncycle_dev(0) = -1;
+    } else {
+      ncycle_dev(0) = max(1,static_cast<int>(ceil(cflmax/0.7)));
+    }
   });
 
-  yakl::ParallelMax<real,yakl::memDevice> pmax( nzm*ncrms );
-  real cfl_loc = pmax(tmpMax.data());
-  cfl = max(cfl,cfl_loc);
-
+  // This is the only point where the host waits for the device
+  ncycle_dev.deep_copy_to(kurant_ncycle_host);
+  yakl::fence();
+  ncycle = kurant_ncycle_host(0);
 
-  if(cfl != cfl) {
+  if(ncycle < 0) {
     std::cout << "\nkurant() - cfl is NaN." << std::endl;
     finalize();
     exit(-1);
   }
 
-  kurant_sgs(cfl);
-
-  ncycle = max(ncycle,max(1,static_cast<int>(ceil(cfl/0.7))));
-
 #ifdef MMF_FIXED_SUBCYCLE
   ncycle = max_ncycle;
 #endif
@@ -77,5 +92,3 @@ void kurant () {
     exit(-1);
   }
 }
-
-
@@ -1,7 +1,8 @@
 
 #include "sgs.h"
 
-void kurant_sgs(real &cfl) {
+// Compute the SGS CFL number of each level and CRM into cfl
+void kurant_sgs(real2d const &cfl) {
   YAKL_SCOPE( sgs_field_diag , :: sgs_field_diag );
   YAKL_SCOPE( dz             , :: dz );
   YAKL_SCOPE( dy             , :: dy );
@@ -13,36 +14,24 @@ void kurant_sgs(real &cfl) {
   YAKL_SCOPE( grdf_z         , :: grdf_z );
   YAKL_SCOPE( ncrms          , :: ncrms );
 
-  real2d tkhmax("tkhmax",nzm,ncrms);
-
-  // for (int k=0; k<nzm; k++) {
-  //   for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    tkhmax(k,icrm) = 0.;
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //   for (int j=0; j<ny; j++) {
-  //     for (int i=0; i<nx; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    yakl::atomicMax( tkhmax(k,icrm) , sgs_field_diag(1,k,offy_d+j,offx_d+i,icrm) );
-  });
-
+  // The max over each horizontal plane is computed by a single thread,
+  // rather than with atomics over the whole grid
   // for (int k=0; k<nzm; k++) {
   //   for (int icrm=0; icrm < ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    real tkhmax = 0.;
+    for (int j=0; j<ny; j++) {
+      for (int i=0; i<nx; i++) {
+        tkhmax = max( tkhmax , sgs_field_diag(1,k,offy_d+j,offx_d+i,icrm) );
+      }
+    }
+
     real dztmp = dz(icrm)*adzw(k,icrm);
-    real xdir = 0.5*tkhmax(k,icrm)*grdf_x(k,icrm)*dt/(dx*dx);
-    real ydir = 0.5*tkhmax(k,icrm)*grdf_y(k,icrm)*dt/(dy*dy)*YES3D;
-    real zdir = 0.5*tkhmax(k,icrm)*grdf_z(k,icrm)*dt/(dztmp*dztmp);
-    tkhmax(k,icrm) = max( max( xdir , ydir ) , zdir );
+    real xdir = 0.5*tkhmax*grdf_x(k,icrm)*dt/(dx*dx);
+    real ydir = 0.5*tkhmax*grdf_y(k,icrm)*dt/(dy*dy)*YES3D;
+    real zdir = 0.5*tkhmax*grdf_z(k,icrm)*dt/(dztmp*dztmp);
+    cfl(k,icrm) = max( max( xdir , ydir ) , zdir );
   });
-
-  // Perform a max reduction over tkhmax
-  yakl::ParallelMax<real,yakl::memDevice> pmax( nzm*ncrms );
-  real cfl_loc = pmax( tkhmax.data() );
-  cfl = max(cfl , cfl_loc);
 }
 
 
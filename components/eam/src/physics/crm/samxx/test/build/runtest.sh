@@ -29,6 +29,15 @@ cd ..
 printf "\nComparing results\n\n"
 python nccmp.py fortran2d/fortran_output_000001.nc cpp2d/cpp_output_000001.nc || exit -1
 
+printf "\nRunning C++ code with fused tendencies\n\n"
+cd cpp2d_fused
+rm -f cpp_output_000001.nc
+mpirun -n $ntasks ./cpp2d_fused || exit -1
+cd ..
+
+printf "\nComparing fused and unfused tendencies (must be bit-for-bit)\n\n"
+python nccmp.py cpp2d/cpp_output_000001.nc cpp2d_fused/cpp_output_000001.nc --bfb || exit -1
+
 ################################################################################
 ################################################################################
 
@@ -49,5 +58,14 @@ cd ..
 printf "\nComparing results\n\n"
 python nccmp.py fortran3d/fortran_output_000001.nc cpp3d/cpp_output_000001.nc || exit -1
 
+printf "\nRunning C++ code with fused tendencies\n\n"
+cd cpp3d_fused
+rm -f cpp_output_000001.nc
+mpirun -n $ntasks ./cpp3d_fused || exit -1
+cd ..
+
+printf "\nComparing fused and unfused tendencies (must be bit-for-bit)\n\n"
+python nccmp.py cpp3d/cpp_output_000001.nc cpp3d_fused/cpp_output_000001.nc --bfb || exit -1
+
 ################################################################################
 ################################################################################
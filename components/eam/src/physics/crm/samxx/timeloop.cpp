@@ -39,40 +39,47 @@ void timeloop() {
       //    the Adams-Bashforth scheme in time
       abcoefs();
 
-      //---------------------------------------------
-      //    initialize stuff:
-      zero();
-
-      //-----------------------------------------------------------
-      //       Buoyancy term:
-      buoyancy();
-
-      //-----------------------------------------------------------
-      // variance transport forcing
-      if (use_VT) {
-        VT_diagnose();
-        VT_forcing();
-      }
-
-      //------------------------------------------------------------
-      //       Large-scale and surface forcing:
-      forcing();
-
-      // Apply radiative tendency
-      // for (int k=0; k<nzm; k++) {
-      //   for (int j=0; j<ny; j++) {
-      //     for (int i=0; i<nx; i++) {
-      //       for (int icrm=0; icrm<ncrms; icrm++) {
-      parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-        int i_rad = i / (nx/crm_nx_rad);
-        int j_rad = j / (ny/crm_ny_rad);
-        t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn;
-      });
-
-      //----------------------------------------------------------
-      //    suppress turbulence near the upper boundary (spange):
-      if (dodamping) { 
-        damping();
+      if (use_fused_tendencies()) {
+        //---------------------------------------------
+        //    initialize stuff, buoyancy, large-scale and surface forcing,
+        //    radiative tendency, and damping, in a single pass over the domain
+        fused_tendencies();
+      } else {
+        //---------------------------------------------
+        //    initialize stuff:
+        zero();
+
+        //-----------------------------------------------------------
+        //       Buoyancy term:
+        buoyancy();
+
+        //-----------------------------------------------------------
+        // variance transport forcing
+        if (use_VT) {
+          VT_diagnose();
+          VT_forcing();
+        }
+
+        //------------------------------------------------------------
+        //       Large-scale and surface forcing:
+        forcing();
+
+        // Apply radiative tendency
+        // for (int k=0; k<nzm; k++) {
+        //   for (int j=0; j<ny; j++) {
+        //     for (int i=0; i<nx; i++) {
+        //       for (int icrm=0; icrm<ncrms; icrm++) {
+        parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+          int i_rad = i / (nx/crm_nx_rad);
+          int j_rad = j / (ny/crm_ny_rad);
+          t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn;
+        });
+
+        //----------------------------------------------------------
+        //    suppress turbulence near the upper boundary (spange):
+        if (dodamping) { 
+          damping();
+        }
       }
 
       //---------------------------------------------------------
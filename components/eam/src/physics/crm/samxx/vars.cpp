@@ -194,6 +194,13 @@ void allocate() {
   q_vt_pert        = real4d( "q_vt_pert      "     , nzm , ny         , nx     , ncrms ); 
   u_vt_pert        = real4d( "u_vt_pert      "     , nzm , ny         , nx     , ncrms ); 
 
+  kurant_wm          = real2d   ( "kurant_wm         " , nz  , ncrms );
+  kurant_uhm         = real2d   ( "kurant_uhm        " , nz  , ncrms );
+  kurant_cfl         = real2d   ( "kurant_cfl        " , nzm , ncrms );
+  kurant_cfl_crm     = real1d   ( "kurant_cfl_crm    " ,       ncrms );
+  kurant_ncycle      = int1d    ( "kurant_ncycle     " , 1           );
+  kurant_ncycle_host = intHost1d( "kurant_ncycle_host" , 1           );
+
   yakl::memset(t00               ,0.);
   yakl::memset(tln               ,0.);
   yakl::memset(qln               ,0.);
@@ -667,6 +674,13 @@ void finalize() {
   t_vt_pert        = real4d();
   q_vt_pert        = real4d();
   u_vt_pert        = real4d();
+
+  kurant_wm          = real2d();
+  kurant_uhm         = real2d();
+  kurant_cfl         = real2d();
+  kurant_cfl_crm     = real1d();
+  kurant_ncycle      = int1d();
+  kurant_ncycle_host = intHost1d();
 }
 
 
@@ -1620,6 +1634,13 @@ real4d t_vt_pert      ;
 real4d q_vt_pert      ;
 real4d u_vt_pert      ;
 
+real2d kurant_wm          ;
+real2d kurant_uhm         ;
+real2d kurant_cfl         ;
+real1d kurant_cfl_crm     ;
+int1d  kurant_ncycle      ;
+intHost1d kurant_ncycle_host;
+
 real1d fcorz           ;
 real1d fcor            ;
 real1d longitude0      ;
@@ -336,6 +336,14 @@ extern real4d t_vt_pert      ;
 extern real4d q_vt_pert      ;
 extern real4d u_vt_pert      ;
 
+// Persistent scratch for kurant()
+extern real2d kurant_wm          ;
+extern real2d kurant_uhm         ;
+extern real2d kurant_cfl         ;
+extern real1d kurant_cfl_crm     ;
+extern int1d  kurant_ncycle      ;
+extern intHost1d kurant_ncycle_host;
+
 extern real1d fcorz           ;
 extern real1d fcor            ;
 extern real1d longitude0      ;
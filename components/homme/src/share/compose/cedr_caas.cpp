@@ -43,16 +43,26 @@ CAAS<ES>::CAAS (const mpi::Parallel::Ptr& p, const Int nlclcells,
   o.nrhomidxs_ = 0;
   o.need_conserve_ = false;
   finished_setup_ = false;
+  reduce_pending_ = false;
+  ngroups_ = 0;
+  nactive_ = 0;
   cedr_throw_if(nlclcells == 0, "CAAS does not support 0 cells on a rank.");
   tracer_decls_ = std::make_shared<std::vector<Decl> >();  
 }
 
 template <typename ES>
 void CAAS<ES>::declare_tracer(int problem_type, const Int& rhomidx) {
+  declare_tracer(problem_type, rhomidx, 0);
+}
+
+template <typename ES>
+void CAAS<ES>::declare_tracer(int problem_type, const Int& rhomidx,
+                              const Int& group) {
   cedr_throw_if( ! (problem_type & ProblemType::shapepreserve),
                 "CAAS does not support ! shapepreserve yet.");
   cedr_throw_if(rhomidx > 0, "rhomidx > 0 is not supported yet.");
-  tracer_decls_->push_back(Decl(problem_type, rhomidx));
+  cedr_throw_if(group < 0, "group must be >= 0.");
+  tracer_decls_->push_back(Decl(problem_type, rhomidx, group));
   if (problem_type & ProblemType::conserve)
     o.need_conserve_ = true;
   o.nrhomidxs_ = std::max(o.nrhomidxs_, rhomidx+1);
@@ -62,17 +72,43 @@ template <typename ES>
 void CAAS<ES>::end_tracer_declarations () {
   cedr_throw_if(tracer_decls_->size() == 0, "#tracers is 0.");
   cedr_throw_if(o.nrhomidxs_ == 0, "#rhomidxs is 0.");
-  o.probs_ = IntList("CAAS probs", static_cast<Int>(tracer_decls_->size()));
+  const Int nt = static_cast<Int>(tracer_decls_->size());
+  o.probs_ = IntList("CAAS probs", nt);
   probs_h_ = Kokkos::create_mirror_view(o.probs_);
-  //t2r_ = IntList("CAAS t2r", static_cast<Int>(tracer_decls_->size()));
-  for (Int i = 0; i < o.probs_.extent_int(0); ++i) {
+  //t2r_ = IntList("CAAS t2r", nt);
+  t2g_.resize(nt);
+  ngroups_ = 0;
+  for (Int i = 0; i < nt; ++i) {
     probs_h_(i) = (*tracer_decls_)[i].probtype;
     //t2r_(i) = (*tracer_decls_)[i].rhomidx;
+    t2g_[i] = (*tracer_decls_)[i].group;
+    ngroups_ = std::max(ngroups_, t2g_[i] + 1);
   }
   Kokkos::deep_copy(o.probs_, probs_h_);
   tracer_decls_ = nullptr;
+  active_ = IntList("CAAS active", nt);
+  active_h_ = Kokkos::create_mirror_view(active_);
+  set_active_groups(std::vector<bool>(ngroups_, true));
+}
+
+template <typename ES>
+Int CAAS<ES>::get_num_groups () const { return ngroups_; }
+
+template <typename ES>
+void CAAS<ES>::set_active_groups (const std::vector<bool>& active) {
+  cedr_throw_if(static_cast<Int>(active.size()) != ngroups_,
+                "set_active_groups: active.size() " << active.size()
+                << " != #groups " << ngroups_);
+  cedr_assert( ! reduce_pending_);
+  nactive_ = 0;
+  for (Int ti = 0; ti < static_cast<Int>(t2g_.size()); ++ti)
+    if (active[t2g_[ti]]) active_h_(nactive_++) = ti;
+  Kokkos::deep_copy(active_, active_h_);
 }
 
+template <typename ES>
+Int CAAS<ES>::get_num_active_tracers () const { return nactive_; }
+
 template <typename ES>
 void CAAS<ES>::get_buffers_sizes (size_t& buf1, size_t& buf2, size_t& buf3) {
   const Int e = o.need_conserve_ ? 1 : 0;
@@ -129,9 +165,12 @@ Int CAAS<ES>::get_num_tracers () const {
 template <typename ES>
 void CAAS<ES>::reduce_locally () {
   const bool user_reduces = user_reducer_ != nullptr;
-  ConstExceptGnu Int nt = o.probs_.size(), nlclcells = o.nlclcells_;
+  // Only the active tracers are reduced. Slot k in send_ is for tracer
+  // active(k), while d is indexed by tracer.
+  ConstExceptGnu Int nt = o.probs_.size(), nta = nactive_, nlclcells = o.nlclcells_;
 
   const auto probs = o.probs_;
+  const auto active = active_;
   const auto send = send_;
   const auto d = o.d_;
   if (user_reduces) {
@@ -140,40 +179,44 @@ void CAAS<ES>::reduce_locally () {
     const auto calc_Qm_clip = KOKKOS_LAMBDA (const Int& j) {
       const auto k = j / nlclaccum;
       const auto bi = j % nlclaccum;
-      const auto os = (k+1)*nlclcells;
+      const auto ti = active(k);
+      const auto os = (ti+1)*nlclcells;
       Real accum_clip = 0, accum_term = 0;
       for (Int ai = 0; ai < n_accum_in_place; ++ai) {
         const Int i = n_accum_in_place*bi + ai;
         Real Qm_clip, Qm_term;
-        calc_Qm_scalars(d, probs, nt, nlclcells, k, os, i, Qm_clip, Qm_term);
+        calc_Qm_scalars(d, probs, nt, nlclcells, ti, os, i, Qm_clip, Qm_term);
         d(os + i) = Qm_clip;
         accum_clip += Qm_clip;
         accum_term += Qm_term;
       }
-      send(nlclaccum*      k  + bi) = accum_clip;
-      send(nlclaccum*(nt + k) + bi) = accum_term;
+      send(nlclaccum*       k  + bi) = accum_clip;
+      send(nlclaccum*(nta + k) + bi) = accum_term;
     };
-    Kokkos::parallel_for(Kokkos::RangePolicy<ES>(0, nt*nlclaccum), calc_Qm_clip);
+    Kokkos::parallel_for(Kokkos::RangePolicy<ES>(0, nta*nlclaccum), calc_Qm_clip);
     const auto set_Qm_minmax = KOKKOS_LAMBDA (const Int& j) {
-      const auto k = 2*nt + j / nlclaccum;
+      // k in [0, nta) is Qm_min, k in [nta, 2*nta) is Qm_max.
+      const auto k = j / nlclaccum;
       const auto bi = j % nlclaccum;
-      const auto os = (k-nt+1)*nlclcells;
+      const auto ti = active(k % nta);
+      const auto os = (1 + (1 + k / nta)*nt + ti)*nlclcells;
       Real accum_ext = 0;
       for (Int ai = 0; ai < n_accum_in_place; ++ai) {
         const Int i = n_accum_in_place*bi + ai;
         accum_ext += d(os + i);
       }
-      send(nlclaccum*k + bi) = accum_ext;
+      send(nlclaccum*(2*nta + k) + bi) = accum_ext;
     };
-    Kokkos::parallel_for(Kokkos::RangePolicy<ES>(0, 2*nt*nlclaccum), set_Qm_minmax);
+    Kokkos::parallel_for(Kokkos::RangePolicy<ES>(0, 2*nta*nlclaccum), set_Qm_minmax);
   } else {
     using ESU = cedr::impl::ExeSpaceUtils<ES>;
     const auto calc_Qm_clip = KOKKOS_LAMBDA (const typename ESU::Member& t) {
       const auto k = t.league_rank();
-      const auto os = (k+1)*nlclcells;
+      const auto ti = active(k);
+      const auto os = (ti+1)*nlclcells;
       const auto reduce = [&] (const Int& i, Kokkos::ComposeReal2& accum) {
         Real Qm_clip, Qm_term;
-        calc_Qm_scalars(d, probs, nt, nlclcells, k, os, i, Qm_clip, Qm_term);
+        calc_Qm_scalars(d, probs, nt, nlclcells, ti, os, i, Qm_clip, Qm_term);
         d(os+i) = Qm_clip;
         accum.v[0] += Qm_clip;
         accum.v[1] += Qm_term;
@@ -181,47 +224,72 @@ void CAAS<ES>::reduce_locally () {
       Kokkos::ComposeReal2 accum;
       Kokkos::parallel_reduce(Kokkos::TeamThreadRange(t, nlclcells),
                               reduce, Kokkos::Sum<Kokkos::ComposeReal2>(accum));
-      send(     k) = accum.v[0];
-      send(nt + k) = accum.v[1];
+      send(      k) = accum.v[0];
+      send(nta + k) = accum.v[1];
     };
-    Kokkos::parallel_for(ESU::get_default_team_policy(nt, nlclcells),
+    Kokkos::parallel_for(ESU::get_default_team_policy(nta, nlclcells),
                          calc_Qm_clip);
     const auto set_Qm_minmax = KOKKOS_LAMBDA (const typename ESU::Member& t) {
-      const auto k = 2*nt + t.league_rank();
-      const auto os = (k-nt+1)*nlclcells;
+      // k in [0, nta) is Qm_min, k in [nta, 2*nta) is Qm_max.
+      const auto k = t.league_rank();
+      const auto ti = active(k % nta);
+      const auto os = (1 + (1 + k / nta)*nt + ti)*nlclcells;
       Real accum = 0;
       Kokkos::parallel_reduce(Kokkos::TeamThreadRange(t, nlclcells),
                               [&] (const Int& i, Real& accum) { accum += d(os+i); },
                               Kokkos::Sum<Real>(accum));
-      send(k) = accum;
+      send(2*nta + k) = accum;
     };
-    Kokkos::parallel_for(ESU::get_default_team_policy(2*nt, nlclcells),
+    Kokkos::parallel_for(ESU::get_default_team_policy(2*nta, nlclcells),
                          set_Qm_minmax);
   }
 }
 
 template <typename ES>
-void CAAS<ES>::reduce_globally () {
-  const int err = mpi::all_reduce(*p_, send_.data(), recv_.data(),
-                                  send_.size(), MPI_SUM);
+void CAAS<ES>::start_reduce_globally () {
+  // The reduction reads send_, so the local reductions must be done.
+  ES().fence();
+  if (user_reducer_) {
+    reduce_pending_ = user_reducer_->start(
+      *p_, send_.data(), recv_.data(),
+      o.nlclcells_ / user_reducer_->n_accum_in_place(), 4*nactive_, MPI_SUM);
+    return;
+  }
+  const int err = mpi::iall_reduce(*p_, send_.data(), recv_.data(),
+                                   4*nactive_, MPI_SUM, &reduce_req_);
   cedr_throw_if(err != MPI_SUCCESS,
-                "CAAS::reduce_globally MPI_Allreduce returned " << err);
+                "CAAS::start_reduce_globally MPI_Iallreduce returned " << err);
+  reduce_pending_ = true;
+}
+
+template <typename ES>
+void CAAS<ES>::finish_reduce_globally () {
+  if ( ! reduce_pending_) return;
+  reduce_pending_ = false;
+  if (user_reducer_) {
+    user_reducer_->finish(*p_, recv_.data(), 4*nactive_);
+    return;
+  }
+  const int err = mpi::waitall(1, &reduce_req_);
+  cedr_throw_if(err != MPI_SUCCESS,
+                "CAAS::finish_reduce_globally MPI_Waitall returned " << err);
 }
 
 template <typename ES>
 void CAAS<ES>::finish_locally () {
   using ESU = cedr::impl::ExeSpaceUtils<ES>;
-  ConstExceptGnu Int nt = o.probs_.size(), nlclcells = o.nlclcells_;
+  ConstExceptGnu Int nt = o.probs_.size(), nta = nactive_, nlclcells = o.nlclcells_;
+  const auto active = active_;
   const auto recv = recv_;
   const auto d = o.d_;
   const auto adjust_Qm = KOKKOS_LAMBDA (const typename ESU::Member& t) {
     const auto k = t.league_rank();
-    const auto os = (k+1)*nlclcells;
-    const auto Qm_clip_sum = recv(     k);
-    const auto Qm_sum      = recv(nt + k);
+    const auto os = (active(k)+1)*nlclcells;
+    const auto Qm_clip_sum = recv(      k);
+    const auto Qm_sum      = recv(nta + k);
     const auto m = Qm_sum - Qm_clip_sum;
     if (m < 0) {
-      const auto Qm_min_sum = recv(2*nt + k);
+      const auto Qm_min_sum = recv(2*nta + k);
       auto fac = Qm_clip_sum - Qm_min_sum;
       if (fac > 0) {
         fac = m/fac;
@@ -234,7 +302,7 @@ void CAAS<ES>::finish_locally () {
         Kokkos::parallel_for(Kokkos::TeamThreadRange(t, nlclcells), adjust);
       }
     } else if (m > 0) {
-      const auto Qm_max_sum = recv(3*nt + k);
+      const auto Qm_max_sum = recv(3*nta + k);
       auto fac = Qm_max_sum - Qm_clip_sum;
       if (fac > 0) {
         fac = m/fac;
@@ -248,7 +316,7 @@ void CAAS<ES>::finish_locally () {
       }
     }
   };
-  Kokkos::parallel_for(ESU::get_default_team_policy(nt, nlclcells),
+  Kokkos::parallel_for(ESU::get_default_team_policy(nta, nlclcells),
                        adjust_Qm);
 }
 
@@ -257,15 +325,24 @@ const typename CAAS<ES>::DeviceOp& CAAS<ES>::get_device_op() { return o; }
 
 template <typename ES>
 void CAAS<ES>::run () {
+  run_start();
+  run_finish();
+}
+
+template <typename ES>
+void CAAS<ES>::run_start () {
   cedr_assert(finished_setup_);
+  cedr_assert( ! reduce_pending_);
+  // The set of active groups is the same on all ranks.
+  if (nactive_ == 0) return;
   reduce_locally();
-  const bool user_reduces = user_reducer_ != nullptr;
-  if (user_reduces)
-    (*user_reducer_)(*p_, send_.data(), recv_.data(),
-                     o.nlclcells_ / user_reducer_->n_accum_in_place(),
-                     recv_.size(), MPI_SUM);
-  else
-    reduce_globally();
+  start_reduce_globally();
+}
+
+template <typename ES>
+void CAAS<ES>::run_finish () {
+  if (nactive_ == 0) return;
+  finish_reduce_globally();
   finish_locally();
 }
 
@@ -302,9 +379,11 @@ struct TestCAAS : public cedr::test::TestRandomized {
 
   TestCAAS (const mpi::Parallel::Ptr& p, const Int& ncells,
             const bool use_own_reducer, const bool external_memory,
-            const bool verbose)
-    : TestRandomized("CAAS", p, ncells, verbose),
-      p_(p), external_memory_(external_memory)
+            const bool verbose, const bool overlap = false,
+            const Int ngroups = 1)
+    : TestRandomized(overlap ? "CAAS (overlap)" : "CAAS", p, ncells, verbose),
+      p_(p), external_memory_(external_memory), overlap_(overlap),
+      ngroups_(ngroups)
   {
     const auto np = p->size(), rank = p->rank();
     nlclcells_ = ncells / np;
@@ -321,6 +400,7 @@ struct TestCAAS : public cedr::test::TestRandomized {
     }
     caas_ = std::make_shared<CAAST>( p, nlclcells_, reducer);
     init();
+    work_ = typename CAAST::RealList("work", nlclcells_*tracers_.size());
   }
 
   CDR& get_cdr () override { return *caas_; }
@@ -345,7 +425,7 @@ struct TestCAAS : public cedr::test::TestRandomized {
         continue;
       t.idx = idx++;
       tracers.push_back(t);
-      caas_->declare_tracer(t.problem_type, 0);
+      caas_->declare_tracer(t.problem_type, 0, t.idx % ngroups_);
     }
     tracers_ = tracers;
     caas_->end_tracer_declarations();
@@ -360,15 +440,47 @@ struct TestCAAS : public cedr::test::TestRandomized {
   }
 
   void run_impl (const Int trial) override {
-    caas_->run();
+    if (ngroups_ > 1) {
+      // Limit each group in its own run. A run leaves the tracers in the
+      // inactive groups alone, so in the end every tracer is limited once.
+      const Int ng = caas_->get_num_groups();
+      for (Int g = 0; g < ng; ++g) {
+        std::vector<bool> active(ng, false);
+        active[g] = true;
+        caas_->set_active_groups(active);
+        caas_->run();
+      }
+      caas_->set_active_groups(std::vector<bool>(ng, true));
+    } else if (overlap_) {
+      caas_->run_start();
+      do_independent_work();
+      caas_->run_finish();
+    } else {
+      caas_->run();
+      do_independent_work();
+    }
+  }
+
+  // Stand-in for work that does not depend on the CAAS data, e.g., the local
+  // reductions of the next tracer batch.
+  void do_independent_work () {
+    const auto w = work_;
+    const auto f = KOKKOS_LAMBDA (const Int& i) {
+      Real a = w(i);
+      for (Int j = 0; j < 32; ++j)
+        a = 0.5*(a + 1/(1 + a*a));
+      w(i) = a;
+    };
+    Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, w.extent_int(0)), f);
+    Kokkos::fence();
   }
 
 private:
   mpi::Parallel::Ptr p_;
-  bool external_memory_;
-  Int nlclcells_;
+  bool external_memory_, overlap_;
+  Int ngroups_, nlclcells_;
   CAAST::Ptr caas_;
-  typename CAAST::RealList buf1_, buf2_;
+  typename CAAST::RealList buf1_, buf2_, work_;
 
   static Int get_nllclcells (const Int& ncells, const Int& np, const Int& rank) {
     Int nlclcells = ncells / np;
@@ -386,11 +498,23 @@ Int unittest (const mpi::Parallel::Ptr& p) {
     if (ncells > np) ncells -= np/2;
     for (const bool own_reducer : {false, true})
       for (const bool external_memory : {false, true})
-        nerr += TestCAAS(p, ncells, own_reducer, external_memory, false)
-          .run<TestCAAS::CAAST>(1, false);
+        for (const bool overlap : {false, true})
+          nerr += TestCAAS(p, ncells, own_reducer, external_memory, false, overlap)
+            .run<TestCAAS::CAAST>(1, false);
+    for (const bool own_reducer : {false, true})
+      nerr += TestCAAS(p, ncells, own_reducer, false, false, false, 3)
+        .run<TestCAAS::CAAST>(1, false);
   }
   return nerr;
 }
+
+Int perftest (const mpi::Parallel::Ptr& p, const Int ncells, const Int nrepeat) {
+  Int nerr = 0;
+  for (const bool overlap : {false, true})
+    nerr += TestCAAS(p, ncells, false, false, true, overlap)
+      .run<TestCAAS::CAAST>(nrepeat, false);
+  return nerr;
+}
 } // namespace test
 } // namespace caas
 } // namespace cedr
@@ -46,6 +46,20 @@ public:
     // if those DOFs are guaranteed always to be on the same processor. If so,
     // expose that value n here.
     virtual int n_accum_in_place () const { return 1; }
+
+    // Optional split-phase interface, used by CAAS::run_start/run_finish. start
+    // has the same arguments as operator(); it begins the reduction and returns
+    // true if it is still in flight, in which case finish completes it, writing
+    // rcvbuf. sendbuf and rcvbuf must not be touched in between. By default,
+    // start does the blocking reduction.
+    virtual bool start (const mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
+                        int nlocal, int nfld, MPI_Op op) const {
+      (*this)(p, sendbuf, rcvbuf, nlocal, nfld, op);
+      return false;
+    }
+
+    virtual void finish (const mpi::Parallel& /*p*/, Real* /*rcvbuf*/,
+                         int /*nfld*/) const {}
   };
 
   CAAS(const mpi::Parallel::Ptr& p, const Int nlclcells,
@@ -53,6 +67,11 @@ public:
 
   void declare_tracer(int problem_type, const Int& rhomidx) override;
 
+  // Same as above, but also put the tracer in a tracer group. Groups are
+  // numbered 0, 1, ...; the two-argument version puts the tracer in group 0.
+  // Groups can be limited on different cadences; see set_active_groups.
+  void declare_tracer(int problem_type, const Int& rhomidx, const Int& group);
+
   void end_tracer_declarations() override;
 
   void get_buffers_sizes(size_t& buf1, size_t& buf2) override;
@@ -65,6 +84,18 @@ public:
 
   Int get_num_tracers() const override;
 
+  Int get_num_groups() const;
+
+  // Limit only the tracers in groups g having active[g] true in subsequent
+  // calls to run. The other tracers are not modified and are not part of the
+  // global reduction, so the cost of run scales with the number of active
+  // tracers. The reductions of all active groups are packed into one
+  // message. Initially all groups are active. Valid after
+  // end_tracer_declarations, but not between run_start and run_finish.
+  void set_active_groups(const std::vector<bool>& active);
+
+  Int get_num_active_tracers() const;
+
   struct DeviceOp : public CDR::DeviceOp {
     // lclcellidx is trivial; it is the user's index for the cell.
     KOKKOS_INLINE_FUNCTION
@@ -88,14 +119,27 @@ public:
 
   void run() override;
 
+  // Split-phase version of run(): run_start does the local reductions and posts
+  // the global reduction; run_finish completes the global reduction and
+  // finishes the local work. Between the two calls, the caller may do work that
+  // does not touch this object's data (e.g., the local reductions of another
+  // CAAS object), to overlap it with the global reduction. run() is equivalent
+  // to run_start(); run_finish().
+  //   If a UserAllReducer was provided, it is called through its start/finish
+  // interface, so the reduction overlaps only if the UserAllReducer implements
+  // it. HOMME's ReproSumReducer does, and HOMME overlaps the reduction with the
+  // update of the tracers in inactive groups.
+  void run_start();
+  void run_finish();
+
 protected:
   typedef cedr::impl::Unmanaged<RealList> UnmanagedRealList;
 
   struct Decl {
     int probtype;
-    Int rhomidx;
-    Decl (const int probtype_, const Int rhomidx_)
-      : probtype(probtype_), rhomidx(rhomidx_) {}
+    Int rhomidx, group;
+    Decl (const int probtype_, const Int rhomidx_, const Int group_)
+      : probtype(probtype_), rhomidx(rhomidx_), group(group_) {}
   };
 
   mpi::Parallel::Ptr p_;
@@ -103,11 +147,19 @@ protected:
   std::shared_ptr<std::vector<Decl> > tracer_decls_;
   typename IntList::HostMirror probs_h_;
   IntList t2r_;
+  // Tracer -> group, and the list of tracers in the active groups.
+  std::vector<Int> t2g_;
+  Int ngroups_, nactive_;
+  IntList active_;
+  typename IntList::HostMirror active_h_;
   RealList send_, recv_;
   bool finished_setup_;
   DeviceOp o;
+  mpi::Request reduce_req_;
+  bool reduce_pending_;
 
-  void reduce_globally();
+  void start_reduce_globally();
+  void finish_reduce_globally();
 
 PRIVATE_CUDA:
   void reduce_locally();
@@ -119,6 +171,9 @@ private:
 
 namespace test {
 Int unittest(const mpi::Parallel::Ptr& p);
+// Report the time per run with and without overlapping the global reduction
+// with independent work (see CAAS::run_start/run_finish).
+Int perftest(const mpi::Parallel::Ptr& p, const Int ncells, const Int nrepeat);
 } // namespace test
 } // namespace caas
 } // namespace cedr
@@ -47,6 +47,11 @@ int reduce(const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_Op op,
 template <typename T>
 int all_reduce(const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_Op op);
 
+// Nonblocking all_reduce. Complete it with waitall or waitany.
+template <typename T>
+int iall_reduce(const Parallel& p, const T* sendbuf, T* rcvbuf, int count,
+                MPI_Op op, Request* ireq);
+
 template <typename T>
 int isend(const Parallel& p, const T* buf, int count, int dest, int tag,
           Request* ireq = nullptr);
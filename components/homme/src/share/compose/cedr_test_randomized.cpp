@@ -421,7 +421,7 @@ TestRandomized
 ::TestRandomized (const std::string& name, const mpi::Parallel::Ptr& p,
                   const Int& ncells, const bool verbose,
                   const CDR::Options options)
-  : cdr_name_(name), options_(options), p_(p), ncells_(ncells),
+  : cdr_name_(name), options_(options), verbose_(verbose), p_(p), ncells_(ncells),
     write_inited_(false)
 {}
 
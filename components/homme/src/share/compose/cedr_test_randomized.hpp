@@ -22,12 +22,14 @@ public:
   // The subclass should call this, probably in its constructor.
   void init();
 
+  // If verbose, report the time per run_impl call, excluding the first.
   template <typename CDRT, typename ExeSpace = Kokkos::DefaultExecutionSpace>
   Int run(const Int nrepeat = 1, const bool write=false);
 
 private:
   const std::string cdr_name_;
   const CDR::Options options_;
+  const bool verbose_;
 
 protected:
   struct Tracer {
@@ -4,6 +4,8 @@
 #ifndef INCLUDE_CEDR_TEST_RANDOMIZED_INL_HPP
 #define INCLUDE_CEDR_TEST_RANDOMIZED_INL_HPP
 
+#include <iostream>
+
 #include "cedr_test_randomized.hpp"
 
 namespace cedr {
@@ -38,6 +40,7 @@ Int TestRandomized::run (const Int nrepeat, const bool write) {
   }
   // repeat > 1 runs the same values repeatedly for performance
   // meaurement.
+  double t_run = 0;
   for (Int trial = 0; trial <= nrepeat; ++trial) {
     const auto set_Qm = KOKKOS_LAMBDA (const Int& j) {
       const auto ti = j / nlclcells;
@@ -46,7 +49,19 @@ Int TestRandomized::run (const Int nrepeat, const bool write) {
                  vd.Qm_prev(ti)[i]);
     };
     Kokkos::parallel_for(Kokkos::RangePolicy<ES>(0, nt*nlclcells), set_Qm);
+    ES().fence();
+    const double t0 = MPI_Wtime();
     run_impl(trial);
+    ES().fence();
+    // The first trial includes one-time costs.
+    if (trial > 0) t_run += MPI_Wtime() - t0;
+  }
+  if (verbose_ && nrepeat > 0) {
+    double t_run_max = 0;
+    mpi::reduce(*p_, &t_run, &t_run_max, 1, MPI_MAX, p_->root());
+    if (p_->amroot())
+      std::cout << cdr_name_ << ": " << nt << " tracers, " << ncells_ << " cells, "
+                << t_run_max/nrepeat << " s per run\n";
   }
   {
     const auto get_Qm = KOKKOS_LAMBDA (const Int& j) {
@@ -3,6 +3,10 @@
 #include "compose_kokkos.hpp"
 #include "cedr_bfb_tree_allreduce.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace ko = Kokkos;
 
 namespace homme {
@@ -351,18 +355,8 @@ struct ReproSumReducer :
   int operator() (const cedr::mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
                   int nlocal, int count, MPI_Op op) const override {
     cedr_assert(op == MPI_SUM);
-    const Real* sendptr = sendbuf;
-    Real* rcvptr = rcvbuf;
-    if (ko::OnGpu<typename MT::DES>::value) {
-      if (send.size() == 0) {
-        send = typename RealList::HostMirror("send", nlocal*count);
-        recv = typename RealList::HostMirror("recv", count);
-      }
-      cedr_assert(static_cast<int>(send.size()) == nlocal*count);
-      ko::deep_copy(send, ConstRealList(sendbuf, nlocal*count));
-      sendptr = send.data();
-      rcvptr = recv.data();
-    }
+    const Real* sendptr = copy_send_to_host(sendbuf, nlocal, count);
+    Real* rcvptr = ko::OnGpu<typename MT::DES>::value ? recv.data() : rcvbuf;
 #ifdef COMPOSE_HORIZ_OPENMP
 #   pragma omp barrier
 #   pragma omp master
@@ -371,16 +365,120 @@ struct ReproSumReducer :
 #ifdef COMPOSE_HORIZ_OPENMP
 #   pragma omp barrier
 #endif
-    if (ko::OnGpu<typename MT::DES>::value)
-      ko::deep_copy(RealList(rcvbuf, count), recv);
+    copy_recv_from_host(rcvbuf, count);
     return 0;
   }
 
+  // compose_repro_sum is blocking. For the split-phase reduction, accumulate
+  // each value exactly in fixed point instead. Integer sums do not depend on
+  // order, so the result is still invariant to the rank decomposition, and the
+  // global sum can be posted with MPI_Iallreduce. The result can differ from
+  // compose_repro_sum's in the last bit. Only CAAS::run_start/run_finish call
+  // start and finish, which compose::CAAS does not use under HORIZ_OPENMP.
+  bool start (const cedr::mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
+              int nlocal, int count, MPI_Op op) const override {
+    cedr_assert(op == MPI_SUM);
+    const Real* sendptr = copy_send_to_host(sendbuf, nlocal, count);
+    if (static_cast<int>(lsend.size()) < nlimb*count) {
+      lsend.resize(nlimb*count);
+      lrecv.resize(nlimb*count);
+    }
+    std::fill(lsend.begin(), lsend.begin() + nlimb*count, 0);
+    for (int f = 0; f < count; ++f)
+      for (int i = 0; i < nlocal; ++i)
+        accumulate(lsend.data() + nlimb*f, sendptr[nlocal*f + i]);
+    const int err = cedr::mpi::iall_reduce(p, lsend.data(), lrecv.data(),
+                                           nlimb*count, MPI_SUM, &req);
+    cedr_throw_if(err != MPI_SUCCESS,
+                  "ReproSumReducer::start MPI_Iallreduce returned " << err);
+    return true;
+  }
+
+  void finish (const cedr::mpi::Parallel& p, Real* rcvbuf, int count) const override {
+    const int err = cedr::mpi::waitall(1, &req);
+    cedr_throw_if(err != MPI_SUCCESS,
+                  "ReproSumReducer::finish MPI_Waitall returned " << err);
+    Real* rcvptr = ko::OnGpu<typename MT::DES>::value ? recv.data() : rcvbuf;
+    for (int f = 0; f < count; ++f)
+      rcvptr[f] = to_real(lrecv.data() + nlimb*f);
+    copy_recv_from_host(rcvbuf, count);
+  }
+
 private:
   typedef Kokkos::View<Real*, typename MT::DES> RealList;
   typedef Kokkos::View<const Real*, typename MT::DES> ConstRealList;
+  typedef long long Limb;
+
+  // Limb j holds bits [nbit*j, nbit*(j+1)) of x*2^-emin. 2^emin is below the
+  // lowest mantissa bit of the smallest subnormal, and nlimb limbs reach past
+  // the largest finite double. Each value adds less than 2^nbit to a limb, so a
+  // limb can take 2^31 values before it can overflow.
+  enum : int { nbit = 32, emin = -1126, nlimb = 68 };
+
+  static void accumulate (Limb* limbs, const Real x) {
+    cedr_assert(std::isfinite(x));
+    if (x == 0) return;
+    int e;
+    const Real f = std::frexp(x, &e);
+    // x = m 2^(e-53), with m an integer, |m| < 2^53.
+    const Limb m = static_cast<Limb>(std::ldexp(f, 53));
+    const Limb sign = m < 0 ? -1 : 1;
+    unsigned long long u = m < 0 ? -m : m;
+    const unsigned long long mask = (1ULL << nbit) - 1;
+    const int s = e - 53 - emin, j = s / nbit, r = s % nbit;
+    limbs[j  ] += sign*static_cast<Limb>((u << r) & mask);
+    u >>= nbit - r;
+    limbs[j+1] += sign*static_cast<Limb>(u & mask);
+    limbs[j+2] += sign*static_cast<Limb>(u >> nbit);
+  }
+
+  // Propagate carries so that limbs [0, nlimb-1) are in [0, 2^nbit). The
+  // result is unique to the represented value.
+  static void normalize (Limb* limbs) {
+    const Limb base = Limb(1) << nbit;
+    for (int j = 0; j < nlimb-1; ++j) {
+      Limb c = limbs[j] / base;
+      if (limbs[j] - c*base < 0) --c;
+      limbs[j] -= c*base;
+      limbs[j+1] += c;
+    }
+  }
+
+  static Real to_real (Limb* limbs) {
+    normalize(limbs);
+    // Convert the magnitude so that the limbs have the same sign.
+    const bool neg = limbs[nlimb-1] < 0;
+    if (neg) {
+      for (int j = 0; j < nlimb; ++j) limbs[j] = -limbs[j];
+      normalize(limbs);
+    }
+    Real x = 0;
+    for (int j = nlimb-1; j >= 0; --j)
+      if (limbs[j] != 0) x += std::ldexp(Real(limbs[j]), nbit*j + emin);
+    return neg ? -x : x;
+  }
+
+  const Real* copy_send_to_host (const Real* sendbuf, int nlocal, int count) const {
+    if ( ! ko::OnGpu<typename MT::DES>::value) return sendbuf;
+    // count varies with the number of active tracer groups.
+    if (static_cast<int>(send.size()) < nlocal*count) {
+      send = typename RealList::HostMirror("send", nlocal*count);
+      recv = typename RealList::HostMirror("recv", count);
+    }
+    ko::deep_copy(ko::subview(send, std::make_pair(0, nlocal*count)),
+                  ConstRealList(sendbuf, nlocal*count));
+    return send.data();
+  }
+
+  void copy_recv_from_host (Real* rcvbuf, int count) const {
+    if ( ! ko::OnGpu<typename MT::DES>::value) return;
+    ko::deep_copy(RealList(rcvbuf, count),
+                  ko::subview(recv, std::make_pair(0, count)));
+  }
 
   mutable typename RealList::HostMirror send, recv;
+  mutable std::vector<Limb> lsend, lrecv;
+  mutable cedr::mpi::Request req;
   const Int fcomm_, n_accum_in_place_;
 };
 
@@ -431,7 +529,7 @@ CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_,
     cdr_over_super_levels(threed && Alg::is_caas(alg)),
     caas_in_suplev(alg == Alg::qlt_super_level_local_caas && nsublev > 1),
     hard_zero(hard_zero_),
-    p(p_), run(cdr_alg_ != 42), inited_tracers_(false)
+    p(p_), run(cdr_alg_ != 42), inited_tracers_(false), nstep_(0)
 {
   const Int n_id_in_suplev = caas_in_suplev ? 1 : nsublev;
   if (Alg::is_qlt(alg)) {
@@ -468,18 +566,65 @@ CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_,
   ie2gci_h = Kokkos::create_mirror_view(ie2gci);
 }
 
+template <typename MT>
+void CDR<MT>::set_tracer_groups (const Int ngroups, const Int* q2group_,
+                                 const Int* group_cadence_,
+                                 const Int* group_probtype_) {
+  cedr_throw_if( ! Alg::is_caas(alg), "Tracer groups require CAAS.");
+  cedr_throw_if(inited_tracers_, "Call set_tracer_groups before init_tracers.");
+  q2group.assign(q2group_, q2group_ + qsize);
+  group_cadence.assign(group_cadence_, group_cadence_ + ngroups);
+  group_probtype.assign(group_probtype_, group_probtype_ + ngroups);
+  for (Int q = 0; q < qsize; ++q)
+    cedr_throw_if(q2group[q] < 0 || q2group[q] >= ngroups,
+                  "Tracer " << q << " has invalid group " << q2group[q]);
+  for (Int g = 0; g < ngroups; ++g)
+    cedr_throw_if(group_cadence[g] < 1,
+                  "Group " << g << " has invalid cadence " << group_cadence[g]);
+}
+
 template <typename MT>
 void CDR<MT>::init_tracers (const bool need_conservation) {
   nonneg = Bools("nonneg", qsize);
   nonneg_h = Kokkos::create_mirror_view(nonneg);
   Kokkos::deep_copy(nonneg_h, hard_zero);
   Kokkos::deep_copy(nonneg, nonneg_h);
+  qactive = Bools("qactive", qsize);
+  qactive_h = Kokkos::create_mirror_view(qactive);
+  Kokkos::deep_copy(qactive_h, true);
+  Kokkos::deep_copy(qactive, qactive_h);
   typedef cedr::ProblemType PT;
+  const int probtype = PT::shapepreserve | (need_conservation ? PT::conserve : 0);
   const Int nt = cdr_over_super_levels ? qsize : nsuplev*qsize;
-  for (Int ti = 0; ti < nt; ++ti)
-    cdr->declare_tracer(PT::shapepreserve |
-                        (need_conservation ? PT::conserve : 0), 0);
+  if (q2group.empty()) {
+    for (Int ti = 0; ti < nt; ++ti)
+      cdr->declare_tracer(probtype, 0);
+  } else {
+    const auto caas = std::dynamic_pointer_cast<CAAST>(cdr);
+    cedr_assert(caas);
+    for (Int ti = 0; ti < nt; ++ti) {
+      const Int g = q2group[ti % qsize];
+      caas->declare_tracer(group_probtype[g] ? group_probtype[g] : probtype, 0, g);
+    }
+  }
   cdr->end_tracer_declarations();
+  inited_tracers_ = true;
+}
+
+template <typename MT>
+void CDR<MT>::update_active_groups () {
+  if (group_cadence.empty()) return;
+  const Int ngroups = group_cadence.size();
+  std::vector<bool> active(ngroups);
+  for (Int g = 0; g < ngroups; ++g)
+    active[g] = nstep_ % group_cadence[g] == 0;
+  ++nstep_;
+  for (Int q = 0; q < qsize; ++q)
+    qactive_h[q] = active[q2group[q]];
+  Kokkos::deep_copy(qactive, qactive_h);
+  // Groups having no tracers in the CDR are not known to it.
+  active.resize(std::dynamic_pointer_cast<CAAST>(cdr)->get_num_groups());
+  std::dynamic_pointer_cast<CAAST>(cdr)->set_active_groups(active);
 }
 
 template <typename MT>
@@ -610,6 +755,9 @@ int cedr_unittest (MPI_Comm mpi_comm) {
   ne = cedr::caas::test::unittest(p);
   if (ne && p->amroot()) std::cerr << "FAIL: cedr::caas::test::unittest()\n";
   nerr += ne;
+  ne = cedr::caas::test::perftest(p, 1024*p->size(), 10);
+  if (ne && p->amroot()) std::cerr << "FAIL: cedr::caas::test::perftest()\n";
+  nerr += ne;
   ne = cedr::BfbTreeAllReducer<>::unittest(p);
   if (ne && p->amroot()) std::cerr << "FAIL: cedr::BfbTreeAllReducer<>::unittest()\n";
   nerr += ne;
@@ -663,6 +811,14 @@ extern "C" void cedr_unittest (const homme::Int fcomm, homme::Int* nerrp) {
   *nerrp += compose::test::cedr_unittest();
 }
 
+extern "C" void cedr_set_tracer_groups (const homme::Int ngroups,
+                                        const homme::Int* q2group,
+                                        const homme::Int* group_cadence,
+                                        const homme::Int* group_probtype) {
+  cedr_assert(g_cdr);
+  g_cdr->set_tracer_groups(ngroups, q2group, group_cadence, group_probtype);
+}
+
 extern "C" void cedr_set_ie2gci (const homme::Int ie, const homme::Int gci) {
   cedr_assert(g_cdr);
   // Now is a good time to drop the tree, whose persistence was used for unit
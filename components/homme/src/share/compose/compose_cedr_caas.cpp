@@ -17,10 +17,11 @@ typedef cedr::Real Real;
 void CAAS::run_horiz_omp () {
   cedr_assert(finished_setup_);
   cedr_assert(user_reducer_ != nullptr);
+  if (nactive_ == 0) return;
   reduce_locally_horiz_omp();
   (*user_reducer_)(*p_, send_.data(), recv_.data(),
                    o.nlclcells_ / user_reducer_->n_accum_in_place(),
-                   recv_.size(), MPI_SUM);
+                   4*nactive_, MPI_SUM);
   finish_locally_horiz_omp();
 }
 
@@ -36,9 +37,10 @@ void homme_parallel_for (const Int& beg, const Int& end, const Func& f) {
 void CAAS::reduce_locally_horiz_omp () {
   const bool user_reduces = user_reducer_ != nullptr;
   cedr_assert(user_reduces); // assumption in Homme
-  ConstExceptGnu Int nt = o.probs_.size(), nlclcells = o.nlclcells_;
+  ConstExceptGnu Int nt = o.probs_.size(), nta = nactive_, nlclcells = o.nlclcells_;
 
   const auto& probs = o.probs_;
+  const auto& active = active_;
   const auto& send = send_;
   const auto& d = o.d_;
   const Int n_accum_in_place = user_reducer_->n_accum_in_place();
@@ -46,46 +48,50 @@ void CAAS::reduce_locally_horiz_omp () {
   const auto calc_Qm_clip = COMPOSE_LAMBDA (const Int& j) {
     const auto k = j / nlclaccum;
     const auto bi = j % nlclaccum;
-    const auto os = (k+1)*nlclcells;
+    const auto ti = active(k);
+    const auto os = (ti+1)*nlclcells;
     Real accum_clip = 0, accum_term = 0;
     for (Int ai = 0; ai < n_accum_in_place; ++ai) {
       const Int i = n_accum_in_place*bi + ai;
       Real Qm_clip, Qm_term;
-      cedr::caas::calc_Qm_scalars(d, probs, nt, nlclcells, k, os, i, Qm_clip,
+      cedr::caas::calc_Qm_scalars(d, probs, nt, nlclcells, ti, os, i, Qm_clip,
                                   Qm_term);
       d(os + i) = Qm_clip;
       accum_clip += Qm_clip;
       accum_term += Qm_term;
     }
-    send(nlclaccum*      k  + bi) = accum_clip;
-    send(nlclaccum*(nt + k) + bi) = accum_term;
+    send(nlclaccum*       k  + bi) = accum_clip;
+    send(nlclaccum*(nta + k) + bi) = accum_term;
   };
-  homme_parallel_for(0, nt*nlclaccum, calc_Qm_clip);
+  homme_parallel_for(0, nta*nlclaccum, calc_Qm_clip);
   const auto set_Qm_minmax = COMPOSE_LAMBDA (const Int& j) {
-    const auto k = 2*nt + j / nlclaccum;
+    // k in [0, nta) is Qm_min, k in [nta, 2*nta) is Qm_max.
+    const auto k = j / nlclaccum;
     const auto bi = j % nlclaccum;
-    const auto os = (k-nt+1)*nlclcells;
+    const auto ti = active(k % nta);
+    const auto os = (1 + (1 + k / nta)*nt + ti)*nlclcells;
     Real accum_ext = 0;
     for (Int ai = 0; ai < n_accum_in_place; ++ai) {
       const Int i = n_accum_in_place*bi + ai;
       accum_ext += d(os + i);
     }
-    send(nlclaccum*k + bi) = accum_ext;
+    send(nlclaccum*(2*nta + k) + bi) = accum_ext;
   };
-  homme_parallel_for(0, 2*nt*nlclaccum, set_Qm_minmax);
+  homme_parallel_for(0, 2*nta*nlclaccum, set_Qm_minmax);
 }
 
 void CAAS::finish_locally_horiz_omp () {
-  ConstExceptGnu Int nt = o.probs_.size(), nlclcells = o.nlclcells_;
+  ConstExceptGnu Int nt = o.probs_.size(), nta = nactive_, nlclcells = o.nlclcells_;
+  const auto& active = active_;
   const auto& recv = recv_;
   const auto& d = o.d_;
   const auto adjust_Qm = COMPOSE_LAMBDA (const Int& k) {
-    const auto os = (k+1)*nlclcells;
-    const auto Qm_clip_sum = recv(     k);
-    const auto Qm_sum      = recv(nt + k);
+    const auto os = (active(k)+1)*nlclcells;
+    const auto Qm_clip_sum = recv(      k);
+    const auto Qm_sum      = recv(nta + k);
     const auto m = Qm_sum - Qm_clip_sum;
     if (m < 0) {
-      const auto Qm_min_sum = recv(2*nt + k);
+      const auto Qm_min_sum = recv(2*nta + k);
       auto fac = Qm_clip_sum - Qm_min_sum;
       if (fac > 0) {
         fac = m/fac;
@@ -97,7 +103,7 @@ void CAAS::finish_locally_horiz_omp () {
         };
       }
     } else if (m > 0) {
-      const auto Qm_max_sum = recv(3*nt + k);
+      const auto Qm_max_sum = recv(3*nta + k);
       auto fac = Qm_max_sum - Qm_clip_sum;
       if (fac > 0) {
         fac = m/fac;
@@ -110,7 +116,7 @@ void CAAS::finish_locally_horiz_omp () {
       }
     }
   };
-  homme_parallel_for(0, nt, adjust_Qm);  
+  homme_parallel_for(0, nta, adjust_Qm);  
 }
 
 } // namespace compose
@@ -65,6 +65,13 @@ struct CDR {
   IdxsH ie2lci_h, ie2gci_h;
   Bools nonneg;
   BoolsH nonneg_h;
+  // Tracer groups, supported only by CAAS. Tracer q is in group q2group[q];
+  // group g is limited every group_cadence[g] calls to run_global, with the
+  // problem type group_probtype[g] (0 to use the default). qactive[q] is true
+  // if tracer q is limited in the current step.
+  std::vector<Int> q2group, group_cadence, group_probtype;
+  Bools qactive;
+  BoolsH qactive_h;
   bool run; // for debugging, it can be useful not to run the CEDR.
 
   CDR(Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_, bool use_sgi,
@@ -74,14 +81,23 @@ struct CDR {
   CDR(const CDR&) = delete;
   CDR& operator=(const CDR&) = delete;
 
+  // Call before init_tracers.
+  void set_tracer_groups(const Int ngroups, const Int* q2group,
+                         const Int* group_cadence, const Int* group_probtype);
+
   void init_tracers(const bool need_conservation);
 
+  // Set the groups active in this step. Call once per step, before
+  // run_global.
+  void update_active_groups();
+
   void get_buffers_sizes(size_t& s1, size_t &s2);
 
   void set_buffers(Real* b1, Real* b2);
 
 private:
   bool inited_tracers_;
+  Int nstep_;
 };
 
 } // namespace homme
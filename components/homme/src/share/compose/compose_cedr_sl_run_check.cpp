@@ -188,6 +188,8 @@ void check (CDR<MT>& cdr, Data& d, const Real* q_min_r, const Real* q_max_r,
       const Real tol = 1e4*std::numeric_limits<Real>::epsilon();
       for (Int k = 0; k < nprob; ++k)
         for (Int q = 0; q < qsize; ++q) {
+          // Tracers in inactive groups were not limited in this step.
+          if ( ! cdr.qactive_h[q]) continue;
           const Real rd = cedr::util::reldif(mass_p_g(k,q), mass_c_g(k,q));
           if (rd > tol)
             pr(puf(k) pu(q) pu(mass_p_g(k,q)) pu(mass_c_g(k,q)) pu(rd));
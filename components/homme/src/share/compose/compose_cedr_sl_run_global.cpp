@@ -40,12 +40,51 @@ COMPOSE_FUNCTION ko::EnableIfOnGpu<MT> warn_on_Qm_prev_negative (
   const Qdp& qdp_p, const Dp3d& dp3d_c)
 {}
 
+#ifdef COMPOSE_PORT
+// Tracers in inactive groups are not limited in this step, so Qdp = q dp for
+// them. This does not depend on the CDR, so run_cdr does it while the CDR's
+// global reduction is in flight.
+template <typename MT>
+static void write_inactive_qdp (CDR<MT>& cdr, const Data& d,
+                                const Int nets, const Int nete) {
+  const auto& ta = *d.ta;
+  const Int nlev = ta.nlev, qsize = ta.qsize, np2 = ta.np2;
+  bool any_inactive = false;
+  for (Int q = 0; q < qsize; ++q)
+    if ( ! cdr.qactive_h[q]) any_inactive = true;
+  if ( ! any_inactive) return;
+  const auto np1 = ta.np1;
+  const auto n1_qdp = ta.n1_qdp;
+  const auto& dp3d_c = ta.dp3d;
+  const auto& qdp_c = ta.qdp;
+  const auto& q_c = ta.q;
+  const auto& qactive = cdr.qactive;
+  const auto f = COMPOSE_LAMBDA (const Int& idx) {
+    const Int ie = nets + idx/(nlev*qsize);
+    const Int q = (idx / nlev) % qsize;
+    const Int k = idx % nlev;
+    if (qactive[q]) return;
+    for (Int g = 0; g < np2; ++g)
+      qdp_c(ie,n1_qdp,q,g,k) = q_c(ie,q,g,k) * dp3d_c(ie,np1,g,k);
+  };
+  ko::parallel_for(ko::RangePolicy<typename MT::DES>(0, (nete - nets + 1)*nlev*qsize), f);
+}
+#endif
+
 template <typename MT>
-static void run_cdr (CDR<MT>& q) {
+static void run_cdr (CDR<MT>& q, const Data& d, const Int nets, const Int nete) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
+#ifdef COMPOSE_PORT
+  const auto caas = dynamic_cast<typename CDR<MT>::CAAST*>(q.cdr.get());
+  if (caas) caas->run_start();
+  else q.cdr->run();
+  write_inactive_qdp(q, d, nets, nete);
+  if (caas) caas->run_finish();
+#else
   q.cdr->run();
+#endif
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
@@ -82,6 +121,7 @@ void run_global (CDR<MT>& cdr, CDRT* cedr_cdr_p,
   const auto cdr_over_super_levels = cdr.cdr_over_super_levels;
   const auto caas_in_suplev = cdr.caas_in_suplev;
   const auto& nonnegs = cdr.nonneg;
+  const auto& qactive = cdr.qactive;
   const auto& ie2lci = cdr.ie2lci;
   const auto& ie2gci = cdr.ie2gci;
   const typename CDRT::DeviceOp
@@ -112,6 +152,12 @@ void run_global (CDR<MT>& cdr, CDRT* cedr_cdr_p,
 #ifndef COMPOSE_PORT
     for (Int q = 0; q < qsize; ++q)
     for (Int spli = 0; spli < cdr.nsuplev; ++spli) {
+#endif
+    // Tracers in inactive groups are not part of this step's CDR problem.
+#ifdef COMPOSE_PORT
+    if ( ! qactive[q]) return;
+#else
+    if ( ! qactive[q]) continue;
 #endif
     const Int k0 = nsublev*spli;
     const Int ti = cdr_over_super_levels ? q : spli*qsize + q;
@@ -176,6 +222,14 @@ void run_global (CDR<MT>& cdr, CDRT* cedr_cdr_p,
 template <typename MT>
 void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
                  const Int nets, const Int nete) {
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+# pragma omp master
+#endif
+  cdr.update_active_groups();
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+#endif
   if (dynamic_cast<typename CDR<MT>::QLTT*>(cdr.cdr.get()))
     run_global<4, MT, typename CDR<MT>::QLTT>(
       cdr, dynamic_cast<typename CDR<MT>::QLTT*>(cdr.cdr.get()),
@@ -188,7 +242,7 @@ void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r
     cedr_throw_if(true, "run_global: could not cast cdr.");
   ko::fence();
   { Timer t("02_run_cdr");
-    run_cdr(cdr); }
+    run_cdr(cdr, d, nets, nete); }
 }
 
 template void
@@ -186,6 +186,7 @@ void run_local (CDR<MT>& cdr, CDRT* cedr_cdr_p,
   const Int nsuplev = cdr.nsuplev;
   const auto cdr_over_super_levels = cdr.cdr_over_super_levels;
   const auto caas_in_suplev = cdr.caas_in_suplev;
+  const auto& qactive = cdr.qactive;
   const typename CDRT::DeviceOp
 #ifndef COMPOSE_PORT
     &
@@ -211,7 +212,15 @@ void run_local (CDR<MT>& cdr, CDRT* cedr_cdr_p,
 #endif
     const Int k0 = nsublev*spli;
     const Int ti = cdr_over_super_levels ? q : spli*qsize + q;
-    if (caas_in_suplev) {
+    if ( ! qactive[q]) {
+      // This tracer's group is not limited in this step.
+#ifndef COMPOSE_PORT
+      // In the port, run_global already did this while the CDR ran.
+      for (Int k = k0; k < k0 + nsublev && k < nlev; ++k)
+        for (Int g = 0; g < np2; ++g)
+          qdp_c1(n1_qdp,q,g,k) = q_c1(q,g,k) * dp3d_c1(np1,g,k);
+#endif
+    } else if (caas_in_suplev) {
       const auto ie_idx = (cdr_over_super_levels ?
                            nsuplev*ie + spli :
                            ie);
@@ -346,6 +346,15 @@ void slmm_set_bufs (homme::Real* sendbuf, homme::Real* recvbuf,
 
 void slmm_set_null_bufs () { slmm_set_bufs(nullptr, nullptr, 0, 0); }
 
+// Number of tracers per chunk in the pipelined remote q exchange; 0 means one
+// chunk of all tracers.
+void slmm_set_tracer_chunk_size (homme::Int qchunk) {
+  slmm_assert(homme::g_csl_mpi);
+  amb::dev_init_threads();
+  homme::islmpi::set_tracer_chunk_size(*homme::g_csl_mpi, qchunk);
+  amb::dev_fin_threads();
+}
+
 void slmm_get_mpi_pattern (homme::Int* sl_mpi) {
   *sl_mpi = homme::g_csl_mpi ? 1 : 0;
 }
@@ -705,6 +705,7 @@ void size_mpi_buffers (IslMpi<MT>& cm, const Rank2Gids& rank2rmtgids,
   cm.recvsz.resize(nrmtrank);
   cm.sendmetasz.resize(nrmtrank);
   cm.recvmetasz.resize(nrmtrank);
+  cm.qrecvsz.resize(nrmtrank);
   Int rmt_xs_sz = 0, rmt_qse_sz = 0;
   for (Int ri = 0; ri < nrmtrank; ++ri) {
     const auto& rmtgids = rank2rmtgids.at(cm.ranks(ri));
@@ -714,6 +715,7 @@ void size_mpi_buffers (IslMpi<MT>& cm, const Rank2Gids& rank2rmtgids,
                                         qbufcnt(owngids, rmtgids)));
     cm.recvsz[ri] = bytes2real(std::max(xbufcnt(owngids, rmtgids),
                                         qbufcnt(rmtgids, owngids)));
+    cm.qrecvsz[ri] = bytes2real(qbufcnt(rmtgids, owngids));
     rmt_xs_sz  += 5*cm.np2*cm.nlev*rmtgids.size();
     rmt_qse_sz += 4       *cm.nlev*rmtgids.size();
 #ifdef COMPOSE_PORT_SEPARATE_VIEWS
@@ -776,6 +778,27 @@ void setup_comm_pattern (IslMpi<MT>& cm, const Int* nbr_id_rank, const Int* nirp
     set_idx2_maps(cm, rank2rmtgids, gid2rmt_owning_lid);
   }
   size_mpi_buffers(cm, rank2rmtgids, rank2owngids);
+  set_tracer_chunk_size(cm, 0);
+}
+
+template <typename MT>
+void set_tracer_chunk_size (IslMpi<MT>& cm, const Int qchunk) {
+  slmm_throw_if(qchunk < 0, "Tracer chunk size must be >= 0; 0 means no chunking.");
+  cm.qchunk = std::max(1, qchunk == 0 ? cm.qsize : std::min(qchunk, cm.qsize));
+  cm.nqchunk = std::max(1, (cm.qsize + cm.qchunk - 1)/cm.qchunk);
+  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+  cm.qsendreq.reset_capacity(cm.nqchunk*nrmtrank, true);
+  cm.qrecvreq.reset_capacity(cm.nqchunk*nrmtrank, true);
+  cm.qrecvreq_ri.reset_capacity(cm.nqchunk*nrmtrank, true);
+  cm.qrecvreq_n.reset_capacity(cm.nqchunk, true);
+  // With more than one chunk, q data can't be received into recvbuf, as it
+  // holds the remote departure points for the next chunks.
+  if (cm.nqchunk > 1 && cm.qrecvbuf.n() != nrmtrank) {
+    cm.qrecvbuf.init(nrmtrank, cm.qrecvsz.data());
+#ifdef COMPOSE_MPI_ON_HOST
+    cm.qrecvbuf_h = cm.qrecvbuf.mirror();
+#endif
+  }
 }
 
 template void
@@ -783,6 +806,8 @@ alloc_mpi_buffers(IslMpi<ko::MachineTraits>& cm, Real* sendbuf, Real* recvbuf);
 template void
 setup_comm_pattern(IslMpi<ko::MachineTraits>& cm, const Int* nbr_id_rank,
                    const Int* nirptr);
+template void
+set_tracer_chunk_size(IslMpi<ko::MachineTraits>& cm, const Int qchunk);
 
 } // namespace islmpi
 } // namespace homme
@@ -537,6 +537,20 @@ struct IslMpi {
   FixedCapList<Int, DDT> rmt_xs, rmt_qs_extrema;
   Int nrmt_xs, nrmt_qs_extrema;
 
+  // The q exchange is pipelined over chunks of tracers. Chunk ic holds tracers
+  // [ic*qchunk, min((ic+1)*qchunk, qsize)). In a rank's send or receive buffer
+  // of size n, chunk ic's q data start at offset (ic*qchunk)*(n/qsize). With
+  // one chunk, q data are received into recvbuf. With more, recvbuf still holds
+  // the departure points needed by the next chunks, so q data are received into
+  // qrecvbuf. Requests for chunk ic are in slots ic*nrmtrank + [0, nrmtrank).
+  Int qchunk, nqchunk;
+  FixedCapList<mpi::Request, HDT> qsendreq, qrecvreq;
+  FixedCapList<Int, HDT> qrecvreq_ri, qrecvreq_n;
+  ListOfLists<Real, DDT> qrecvbuf;
+#ifdef COMPOSE_MPI_ON_HOST
+  typename ListOfLists<Real, DDT>::Mirror qrecvbuf_h;
+#endif
+
   // Mirror views.
   typename FixedCapList<Int, DDT>::Mirror nx_in_rank_h, sendcount_h,
     x_bulkdata_offset_h, rmt_xs_h, rmt_qs_extrema_h, mylid_with_comm_h;
@@ -549,7 +563,7 @@ struct IslMpi {
 #endif
 
   // temporary work space
-  std::vector<Int> nlid_per_rank, sendsz, recvsz, sendmetasz, recvmetasz;
+  std::vector<Int> nlid_per_rank, sendsz, recvsz, sendmetasz, recvmetasz, qrecvsz;
   ArrayD<Real**> rwork;
 
   typedef ArrayD<char***> DepMask;
@@ -563,9 +577,19 @@ struct IslMpi {
           Int inp, Int inlev, Int iqsize, Int iqsized, Int inelemd, Int ihalo)
     : p(ip), advecter(advecter),
       np(inp), np2(np*np), nlev(inlev), qsize(iqsize), qsized(iqsized), nelemd(inelemd),
-      halo(ihalo), tracer_arrays(tracer_arrays_)
+      halo(ihalo), tracer_arrays(tracer_arrays_), qchunk(iqsize), nqchunk(1)
   {}
 
+  Int qchunk_beg (const Int& ic) const { return ic*qchunk; }
+  Int qchunk_size (const Int& ic) const { return std::min(qchunk, qsize - ic*qchunk); }
+
+  ListOfLists<Real, DDT>& get_qrecvbuf () { return nqchunk > 1 ? qrecvbuf : recvbuf; }
+#ifdef COMPOSE_MPI_ON_HOST
+  typename ListOfLists<Real, DDT>::Mirror& get_qrecvbuf_h () {
+    return nqchunk > 1 ? qrecvbuf_h : recvbuf_h;
+  }
+#endif
+
   IslMpi(const IslMpi&) = delete;
   IslMpi& operator=(const IslMpi&) = delete;
 
@@ -611,6 +635,18 @@ void alloc_mpi_buffers (IslMpi<MT>& cm, Real* sendbuf = nullptr, Real* recvbuf =
 template <typename MT>
 void setup_comm_pattern(IslMpi<MT>& cm, const Int* nbr_id_rank, const Int* nirptr);
 
+// Set the number of tracers per chunk in the pipelined q exchange. qchunk = 0
+// means one chunk of all tracers.
+template <typename MT>
+void set_tracer_chunk_size(IslMpi<MT>& cm, const Int qchunk);
+
+// Timer name for tracer chunk ic. With one chunk, the name is unchanged.
+template <typename MT>
+std::string qchunk_timer_name (const IslMpi<MT>& cm, const std::string& name,
+                               const Int& ic) {
+  return cm.nqchunk == 1 ? name : name + "_c" + std::to_string(ic);
+}
+
 namespace extend_halo {
 template <typename MT>
 void extend_local_meshes(const mpi::Parallel& p,
@@ -634,6 +670,14 @@ template <typename MT>
 void wait_on_send (IslMpi<MT>& cm, const bool skip_if_empty = false);
 template <typename MT>
 void recv(IslMpi<MT>& cm, const bool skip_if_empty = false);
+template <typename MT>
+void setup_irecv_q(IslMpi<MT>& cm);
+template <typename MT>
+void isend_q(IslMpi<MT>& cm, const Int& ic);
+template <typename MT>
+void recv_q(IslMpi<MT>& cm, const Int& ic);
+template <typename MT>
+void wait_on_send_q(IslMpi<MT>& cm);
 
 const int nreal_per_2int = (2*sizeof(Int) + sizeof(Real) - 1) / sizeof(Real);
 
@@ -645,15 +689,19 @@ void pack_dep_points_sendbuf_pass2(IslMpi<MT>& cm, const DepPoints<MT>& dep_poin
 template <typename MT>
 void calc_q_extrema(IslMpi<MT>& cm, const Int& nets, const Int& nete);
 
+// The following operate on tracer chunk ic. calc_rmt_q also analyzes the
+// departure points from remotes when ic = 0.
 template <typename MT>
-void calc_rmt_q(IslMpi<MT>& cm);
+void calc_rmt_q(IslMpi<MT>& cm, const Int& ic = 0);
 template <typename MT>
 void calc_own_q(IslMpi<MT>& cm, const Int& nets, const Int& nete,
                 const DepPoints<MT>& dep_points,
-                const QExtrema<MT>& q_min, const QExtrema<MT>& q_max);
+                const QExtrema<MT>& q_min, const QExtrema<MT>& q_max,
+                const Int& ic = 0);
 template <typename MT>
 void copy_q(IslMpi<MT>& cm, const Int& nets,
-            const QExtrema<MT>& q_min, const QExtrema<MT>& q_max);
+            const QExtrema<MT>& q_min, const QExtrema<MT>& q_max,
+            const Int& ic = 0);
 
 /* Take a semi-Lagrangian step, excluding property preservation.
      dep_points is const in principle, but if
@@ -151,6 +151,123 @@ void recv (IslMpi<MT>& cm, const bool skip_if_empty) {
 #endif
 }
 
+// Set up to receive q for each of my departure point requests sent to remotes,
+// for all tracer chunks.
+template <typename MT>
+void setup_irecv_q (IslMpi<MT>& cm) {
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp master
+#endif
+  {
+    const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+#ifdef COMPOSE_MPI_ON_HOST
+    const auto& recvbufs = cm.get_qrecvbuf_h();
+#else
+    const auto& recvbufs = cm.get_qrecvbuf();
+#endif
+    for (Int ic = 0; ic < cm.nqchunk; ++ic) {
+      const Int os = ic*nrmtrank, iq0 = cm.qchunk_beg(ic), nq = cm.qchunk_size(ic);
+      Int nreq = 0;
+      for (Int ri = 0; ri < nrmtrank; ++ri) {
+        if (cm.nx_in_rank_h(ri) == 0) continue;
+#ifdef COMPOSE_MPI_ON_HOST
+        auto&& recvbuf = recvbufs(ri);
+#else
+        auto&& recvbuf = recvbufs.get_h(ri);
+#endif
+        // As in setup_irecv, the count is the number of slots available to
+        // this chunk.
+        const Int nslot = recvbuf.n()/cm.qsize;
+        cm.qrecvreq_ri(os + nreq) = ri;
+        mpi::irecv(*cm.p, recvbuf.data() + iq0*nslot, nq*nslot, cm.ranks(ri), 42,
+                   &cm.qrecvreq(os + nreq));
+        ++nreq;
+      }
+      cm.qrecvreq_n(ic) = nreq;
+    }
+  }
+}
+
+template <typename MT>
+void isend_q (IslMpi<MT>& cm, const Int& ic) {
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+# pragma omp master
+#endif
+  {
+    const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+    const Int iq0 = cm.qchunk_beg(ic), nq = cm.qchunk_size(ic);
+    for (Int ri = 0; ri < nrmtrank; ++ri) {
+      if (cm.sendcount_h(ri) == 0) continue;
+      const Int os = iq0*(cm.sendbuf.get_h(ri).n()/cm.qsize);
+      const Int count = nq*(cm.sendcount_h(ri)/cm.qsize);
+#ifdef COMPOSE_MPI_ON_HOST
+      auto&& sendbuf = cm.sendbuf_h(ri);
+      typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
+      typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
+      Kokkos::deep_copy(ArrayH(sendbuf.data() + os, count),
+                        ArrayD(cm.sendbuf.get_h(ri).data() + os, count));
+#else
+      auto&& sendbuf = cm.sendbuf.get_h(ri);
+#endif
+      mpi::isend(*cm.p, sendbuf.data() + os, count, cm.ranks(ri), 42,
+                 &cm.qsendreq(ic*nrmtrank + ri));
+    }
+  }
+}
+
+template <typename MT>
+void recv_q (IslMpi<MT>& cm, const Int& ic) {
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp master
+#endif
+  {
+    const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+    const Int os = ic*nrmtrank, nreq = cm.qrecvreq_n(ic);
+#ifdef COMPOSE_MPI_ON_HOST
+    typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
+    typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
+    const auto& recvbufs = cm.get_qrecvbuf();
+    const auto& recvbufs_h = cm.get_qrecvbuf_h();
+    const Int iq0 = cm.qchunk_beg(ic);
+    for (Int i = 0; i < nreq; ++i) {
+      Int reqi;
+      MPI_Status stat;
+      mpi::waitany(nreq, cm.qrecvreq.data() + os, &reqi, &stat);
+      const Int ri = cm.qrecvreq_ri(os + reqi);
+      int count;
+      MPI_Get_count(&stat, mpi::get_type<Real>(), &count);
+      const Int bos = iq0*(recvbufs_h(ri).n()/cm.qsize);
+      Kokkos::deep_copy(ArrayD(recvbufs.get_h(ri).data() + bos, count),
+                        ArrayH(recvbufs_h(ri).data() + bos, count));
+    }
+#else
+    mpi::waitall(nreq, cm.qrecvreq.data() + os);
+#endif
+  }
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+#endif
+}
+
+template <typename MT>
+void wait_on_send_q (IslMpi<MT>& cm) {
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp master
+#endif
+  {
+    const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+    for (Int ic = 0; ic < cm.nqchunk; ++ic)
+      for (Int ri = 0; ri < nrmtrank; ++ri) {
+        if (cm.sendcount_h(ri) == 0) continue;
+        mpi::wait(&cm.qsendreq(ic*nrmtrank + ri));
+      }
+  }
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+#endif
+}
+
 template void init_mylid_with_comm_threaded(
   IslMpi<ko::MachineTraits>& cm, const Int& nets, const Int& nete);
 template void setup_irecv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
@@ -159,6 +276,10 @@ template void isend(IslMpi<ko::MachineTraits>& cm, const bool want_req,
 template void recv_and_wait_on_send(IslMpi<ko::MachineTraits>& cm);
 template void wait_on_send(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
 template void recv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
+template void setup_irecv_q(IslMpi<ko::MachineTraits>& cm);
+template void isend_q(IslMpi<ko::MachineTraits>& cm, const Int& ic);
+template void recv_q(IslMpi<ko::MachineTraits>& cm, const Int& ic);
+template void wait_on_send_q(IslMpi<ko::MachineTraits>& cm);
 
 } // namespace islmpi
 } // namespace homme
@@ -196,9 +196,12 @@ Int getbuf (Buffer& buf, const Int& os, Int& i1, Int& i2) {
 #ifndef COMPOSE_PORT
 // Homme computational pattern.
 
+// Compute q at dep_point for tracers [iq0, iq0 + nq), storing tracer iq0 + i in
+// q_tgt[i].
 template <Int np, typename MT>
 void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
-             const Real* const dep_point, Real* const q_tgt, const bool use_q) {
+             const Real* const dep_point, Real* const q_tgt, const bool use_q,
+             const Int& iq0, const Int& nq) {
   static_assert(np == 4, "Only np 4 is supported.");
 
   Real ref_coord[2]; {
@@ -213,14 +216,13 @@ void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
   const auto& ed = cm.ed_d(src_lid);
   const Int levos = np*np*lev;
   const Int np2nlev = np*np*cm.nlev;
-  const Int qsize = cm.qsize;
   static const Int blocksize = 8;
   if (use_q) {
     // We can use q from calc_q_extrema.
-    const Real* const qs0 = ed.q + levos;
+    const Real* const qs0 = ed.q + levos + iq0*np2nlev;
     // Block for auto-vectorization.
-    for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
-      if (iqo + blocksize <= qsize) {
+    for (Int iqo = 0; iqo < nq; iqo += blocksize) {
+      if (iqo + blocksize <= nq) {
         Real tmp[blocksize];
         for (Int iqi = 0; iqi < blocksize; ++iqi) {
           const Real* const qs = qs0 + (iqo + iqi)*np2nlev;
@@ -229,7 +231,7 @@ void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
         for (Int iqi = 0; iqi < blocksize; ++iqi)
           q_tgt[iqo + iqi] = tmp[iqi];
       } else {
-        for (Int iq = iqo; iq < qsize; ++iq) {
+        for (Int iq = iqo; iq < nq; ++iq) {
           const Real* const qs = qs0 + iq*np2nlev;
           q_tgt[iq] = calc_q_tgt(rx, ry, qs);
         }
@@ -238,9 +240,9 @@ void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
   } else {
     // q from calc_q_extrema is being overwritten, so have to use qdp/dp.
     const Real* const dp = ed.dp + levos;
-    const Real* const qdp0 = ed.qdp + levos;
-    for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
-      if (iqo + blocksize <= qsize) {
+    const Real* const qdp0 = ed.qdp + levos + iq0*np2nlev;
+    for (Int iqo = 0; iqo < nq; iqo += blocksize) {
+      if (iqo + blocksize <= nq) {
         Real tmp[blocksize];
         for (Int iqi = 0; iqi < blocksize; ++iqi) {
           const Real* const qdp = qdp0 + (iqo + iqi)*np2nlev;
@@ -249,7 +251,7 @@ void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
         for (Int iqi = 0; iqi < blocksize; ++iqi)
           q_tgt[iqo + iqi] = tmp[iqi];
       } else {
-        for (Int iq = iqo; iq < qsize; ++iq) {
+        for (Int iq = iqo; iq < nq; ++iq) {
           const Real* const qdp = qdp0 + iq*np2nlev;
           q_tgt[iq] = calc_q_tgt(rx, ry, qdp, dp);
         }
@@ -261,8 +263,10 @@ void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
 template <Int np, typename MT>
 void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
                  const DepPoints<MT>& dep_points,
-                 const QExtrema<MT>& q_min, const QExtrema<MT>& q_max) {
+                 const QExtrema<MT>& q_min, const QExtrema<MT>& q_max,
+                 const Int& ic) {
   const int tid = get_tid();
+  const Int iq0 = cm.qchunk_beg(ic), nq = cm.qchunk_size(ic);
   for (Int tci = 0; tci < cm.nelemd; ++tci) {
     auto& ed = cm.ed_d(tci);
     const FA3<Real> q_tgt(ed.q, cm.np2, cm.nlev, cm.qsize);
@@ -274,23 +278,27 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
       const auto& e = ed.own(idx);
       const Int slid = ed.nbrs(ed.src(e.lev, e.k)).lid_on_rank;
       const auto& sed = cm.ed_d(slid);
-      for (Int iq = 0; iq < cm.qsize; ++iq) {
+      for (Int iq = iq0; iq < iq0 + nq; ++iq) {
         idx_qext(q_min, tci, iq, e.k, e.lev) = sed.q_extrema(iq, e.lev, 0);
         idx_qext(q_max, tci, iq, e.k, e.lev) = sed.q_extrema(iq, e.lev, 1);
       }
       Real* const qtmp = &cm.rwork(tid, 0);
-      calc_q<np>(cm, slid, e.lev, &dep_points(tci, e.lev, e.k, 0), qtmp, false);
-      for (Int iq = 0; iq < cm.qsize; ++iq)
-        q_tgt(e.k, e.lev, iq) = qtmp[iq];
+      calc_q<np>(cm, slid, e.lev, &dep_points(tci, e.lev, e.k, 0), qtmp, false,
+                 iq0, nq);
+      for (Int iq = 0; iq < nq; ++iq)
+        q_tgt(e.k, e.lev, iq0 + iq) = qtmp[iq];
     }
   }
 }
 
 template <typename MT>
 void copy_q (IslMpi<MT>& cm, const Int& nets,
-             const QExtrema<MT>& q_min, const QExtrema<MT>& q_max) {
+             const QExtrema<MT>& q_min, const QExtrema<MT>& q_max,
+             const Int& ic) {
   const auto myrank = cm.p->rank();
   const int tid = get_tid();
+  const auto& recvbufs = cm.get_qrecvbuf();
+  const Int qsize = cm.qsize, iq0 = cm.qchunk_beg(ic), nq = cm.qchunk_size(ic);
   for (Int ptr = cm.mylid_with_comm_tid_ptr_h(tid),
            end = cm.mylid_with_comm_tid_ptr_h(tid+1);
        ptr < end; ++ptr) {
@@ -300,35 +308,38 @@ void copy_q (IslMpi<MT>& cm, const Int& nets,
     for (const auto& e: ed.rmt) {
       slmm_assert(ed.nbrs(ed.src(e.lev, e.k)).rank != myrank);
       const Int ri = ed.nbrs(ed.src(e.lev, e.k)).rank_idx;
-      const auto&& recvbuf = cm.recvbuf(ri);
-      for (Int iq = 0; iq < cm.qsize; ++iq) {
-        idx_qext(q_min, tci, iq, e.k, e.lev) = recvbuf(e.q_extrema_ptr + 2*iq    );
-        idx_qext(q_max, tci, iq, e.k, e.lev) = recvbuf(e.q_extrema_ptr + 2*iq + 1);
+      const auto&& recvbuf = recvbufs(ri);
+      // The item's pointers are for all tracers; get the chunk's.
+      const Int os = iq0*(recvbuf.n()/qsize);
+      const Int qeptr = os + nq*(e.q_extrema_ptr/qsize), qptr = os + nq*(e.q_ptr/qsize);
+      for (Int iq = 0; iq < nq; ++iq) {
+        idx_qext(q_min, tci, iq0 + iq, e.k, e.lev) = recvbuf(qeptr + 2*iq    );
+        idx_qext(q_max, tci, iq0 + iq, e.k, e.lev) = recvbuf(qeptr + 2*iq + 1);
       }
-      for (Int iq = 0; iq < cm.qsize; ++iq) {
-        slmm_assert(recvbuf(e.q_ptr + iq) != -1);
-        q_tgt(e.k, e.lev, iq) = recvbuf(e.q_ptr + iq);
+      for (Int iq = 0; iq < nq; ++iq) {
+        slmm_assert(recvbuf(qptr + iq) != -1);
+        q_tgt(e.k, e.lev, iq0 + iq) = recvbuf(qptr + iq);
       }
     }
   }
 }
 
 template <Int np, typename MT>
-void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
-  const Int qsize = cm.qsize;
+void calc_rmt_q_pass2 (IslMpi<MT>& cm, const Int& ic) {
+  const Int qsize = cm.qsize, iq0 = cm.qchunk_beg(ic), nq = cm.qchunk_size(ic);
 
 #ifdef HORIZ_OPENMP
 # pragma omp for
 #endif
   for (Int it = 0; it < cm.nrmt_qs_extrema; ++it) {
+    auto&& qs = cm.sendbuf(cm.rmt_qs_extrema_h(4*it));
     const Int
-      ri = cm.rmt_qs_extrema_h(4*it), lid = cm.rmt_qs_extrema_h(4*it + 1),
-      lev = cm.rmt_qs_extrema_h(4*it + 2), qos = qsize*cm.rmt_qs_extrema_h(4*it + 3);  
-    auto&& qs = cm.sendbuf(ri);
+      lid = cm.rmt_qs_extrema_h(4*it + 1), lev = cm.rmt_qs_extrema_h(4*it + 2),
+      qos = iq0*(qs.n()/qsize) + nq*cm.rmt_qs_extrema_h(4*it + 3);
     const auto& ed = cm.ed_h(lid);
-    for (Int iq = 0; iq < qsize; ++iq)
+    for (Int iq = 0; iq < nq; ++iq)
       for (int i = 0; i < 2; ++i)
-        qs(qos + 2*iq + i) = ed.q_extrema(iq, lev, i);
+        qs(qos + 2*iq + i) = ed.q_extrema(iq0 + iq, lev, i);
   }
 
 #ifdef HORIZ_OPENMP
@@ -337,10 +348,11 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
   for (Int it = 0; it < cm.nrmt_xs; ++it) {
     const Int
       ri = cm.rmt_xs_h(5*it), lid = cm.rmt_xs_h(5*it + 1), lev = cm.rmt_xs_h(5*it + 2),
-      xos = cm.rmt_xs_h(5*it + 3), qos = qsize*cm.rmt_xs_h(5*it + 4);
+      xos = cm.rmt_xs_h(5*it + 3);
     const auto&& xs = cm.recvbuf(ri);
     auto&& qs = cm.sendbuf(ri);
-    calc_q<np>(cm, lid, lev, &xs(xos), &qs(qos), true);
+    const Int qos = iq0*(qs.n()/qsize) + nq*cm.rmt_xs_h(5*it + 4);
+    calc_q<np>(cm, lid, lev, &xs(xos), &qs(qos), true, iq0, nq);
   }
 }
 
@@ -362,7 +374,8 @@ void calc_coefs (const slmm::SphereToRef<typename MT::DES>& s2r,
 template <Int np, typename MT>
 void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
                  const DepPoints<MT>& dep_points,
-                 const QExtrema<MT>& q_min, const QExtrema<MT>& q_max) {
+                 const QExtrema<MT>& q_min, const QExtrema<MT>& q_max,
+                 const Int& ic) {
   const auto& dp_src = cm.tracer_arrays->dp;
   const auto& qdp_src = cm.tracer_arrays->qdp;
   const auto& qtl = cm.tracer_arrays->n0_qdp;
@@ -372,7 +385,7 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
   const auto& local_meshes = cm.advecter->local_meshes();
   const auto alg = cm.advecter->alg();
   const auto& own_dep_list = cm.own_dep_list;
-  const Int qsize = cm.qsize;
+  const Int iq0 = cm.qchunk_beg(ic), iqe = iq0 + cm.qchunk_size(ic);
   static const Int blocksize = 8;
   const auto f = COMPOSE_LAMBDA (const Int& it) {
     const Int tci = own_dep_list(it,0);
@@ -381,7 +394,7 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
     const auto& ed = ed_d(tci);
     const Int slid = ed.nbrs(ed.src(tgt_lev, tgt_k)).lid_on_rank;
     const auto& sed = ed_d(slid);
-    for (Int iq = 0; iq < qsize; ++iq) {
+    for (Int iq = iq0; iq < iqe; ++iq) {
       idx_qext(q_min, tci, iq, tgt_k, tgt_lev) = sed.q_extrema(iq, tgt_lev, 0);
       idx_qext(q_max, tci, iq, tgt_k, tgt_lev) = sed.q_extrema(iq, tgt_lev, 1);
     }
@@ -392,8 +405,8 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
     Real dp[16];
     for (Int k = 0; k < 16; ++k) dp[k] = dp_src(slid, k, tgt_lev);
     // Block for auto-vectorization.
-    for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
-      if (iqo + blocksize <= qsize) {
+    for (Int iqo = iq0; iqo < iqe; iqo += blocksize) {
+      if (iqo + blocksize <= iqe) {
         Real tmp[blocksize];
         for (Int iqi = 0; iqi < blocksize; ++iqi) {
           const Int iq = iqo + iqi;
@@ -404,7 +417,7 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
         for (Int iqi = 0; iqi < blocksize; ++iqi)
           q_tgt(tci, iqo + iqi, tgt_k, tgt_lev) = tmp[iqi];
       } else {
-        for (Int iq = iqo; iq < qsize; ++iq) {
+        for (Int iq = iqo; iq < iqe; ++iq) {
           Real qdp[16];
           for (Int k = 0; k < 16; ++k) qdp[k] = qdp_src(slid, qtl, iq, k, tgt_lev);
           q_tgt(tci, iq, tgt_k, tgt_lev) = calc_q_tgt(rx, ry, qdp, dp);
@@ -418,15 +431,17 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
 
 template <typename MT>
 void copy_q (IslMpi<MT>& cm, const Int& nets,
-             const QExtrema<MT>& q_min, const QExtrema<MT>& q_max) {
+             const QExtrema<MT>& q_min, const QExtrema<MT>& q_max,
+             const Int& ic) {
   slmm_assert(cm.mylid_with_comm_tid_ptr_h.size() == 2);
   const auto myrank = cm.p->rank();
   const auto& q_tgt = cm.tracer_arrays->q;
   const auto& mylid_with_comm = cm.mylid_with_comm_d;
   const auto& ed_d = cm.ed_d;
-  const auto& recvbufs = cm.recvbuf;
+  const auto& recvbufs = cm.get_qrecvbuf();
   const Int nlid = cm.mylid_with_comm_h.size();
   const Int qsize = cm.qsize, nlev = cm.nlev, np2 = cm.np2;
+  const Int iq0 = cm.qchunk_beg(ic), nq = cm.qchunk_size(ic);
   const auto f = COMPOSE_LAMBDA (const Int& it) {
     const Int tci = mylid_with_comm(it/(np2*nlev));
     const Int rmt_id = it % (np2*nlev);
@@ -436,13 +451,16 @@ void copy_q (IslMpi<MT>& cm, const Int& nets,
     slmm_kernel_assert(ed.nbrs(ed.src(e.lev, e.k)).rank != myrank);
     const Int ri = ed.nbrs(ed.src(e.lev, e.k)).rank_idx;
     const auto&& recvbuf = recvbufs(ri);
-    for (Int iq = 0; iq < qsize; ++iq) {
-      idx_qext(q_min, tci, iq, e.k, e.lev) = recvbuf(e.q_extrema_ptr + 2*iq    );
-      idx_qext(q_max, tci, iq, e.k, e.lev) = recvbuf(e.q_extrema_ptr + 2*iq + 1);
+    // The item's pointers are for all tracers; get the chunk's.
+    const Int os = iq0*(recvbuf.n()/qsize);
+    const Int qeptr = os + nq*(e.q_extrema_ptr/qsize), qptr = os + nq*(e.q_ptr/qsize);
+    for (Int iq = 0; iq < nq; ++iq) {
+      idx_qext(q_min, tci, iq0 + iq, e.k, e.lev) = recvbuf(qeptr + 2*iq    );
+      idx_qext(q_max, tci, iq0 + iq, e.k, e.lev) = recvbuf(qeptr + 2*iq + 1);
     }
-    for (Int iq = 0; iq < qsize; ++iq) {
-      slmm_kernel_assert(recvbuf(e.q_ptr + iq) != -1);
-      q_tgt(tci, iq, e.k, e.lev) = recvbuf(e.q_ptr + iq);
+    for (Int iq = 0; iq < nq; ++iq) {
+      slmm_kernel_assert(recvbuf(qptr + iq) != -1);
+      q_tgt(tci, iq0 + iq, e.k, e.lev) = recvbuf(qptr + iq);
     }
   };
   ko::parallel_for(ko::RangePolicy<typename MT::DES>(0, nlid*np2*nlev), f);
@@ -530,24 +548,24 @@ void calc_rmt_q_pass1_scan (IslMpi<MT>& cm) {
 }
 
 template <Int np, typename MT>
-void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
+void calc_rmt_q_pass2 (IslMpi<MT>& cm, const Int& ic) {
   const auto& q_src = cm.tracer_arrays->q;
   const auto& rmt_qs_extrema = cm.rmt_qs_extrema;
   const auto& rmt_xs = cm.rmt_xs;
   const auto& ed_d = cm.ed_d;
   const auto& sendbuf = cm.sendbuf;
   const auto& recvbuf = cm.recvbuf;
-  const Int qsize = cm.qsize;
+  const Int qsize = cm.qsize, iq0 = cm.qchunk_beg(ic), nq = cm.qchunk_size(ic);
 
   const auto fqe = COMPOSE_LAMBDA (const Int& it) {
+    auto&& qs = sendbuf(rmt_qs_extrema(4*it));
     const Int
-    ri = rmt_qs_extrema(4*it), lid = rmt_qs_extrema(4*it + 1),
-    lev = rmt_qs_extrema(4*it + 2), qos = qsize*rmt_qs_extrema(4*it + 3);  
-    auto&& qs = sendbuf(ri);
+    lid = rmt_qs_extrema(4*it + 1), lev = rmt_qs_extrema(4*it + 2),
+    qos = iq0*(qs.n()/qsize) + nq*rmt_qs_extrema(4*it + 3);
     const auto& ed = ed_d(lid);
-    for (Int iq = 0; iq < qsize; ++iq)
+    for (Int iq = 0; iq < nq; ++iq)
       for (int i = 0; i < 2; ++i)
-        qs(qos + 2*iq + i) = ed.q_extrema(iq, lev, i);
+        qs(qos + 2*iq + i) = ed.q_extrema(iq0 + iq, lev, i);
   };
   ko::fence();
   ko::parallel_for(ko::RangePolicy<typename MT::DES>(0, cm.nrmt_qs_extrema), fqe);
@@ -560,18 +578,19 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
   const auto fx = COMPOSE_LAMBDA (const Int& it) {
     const Int
     ri = rmt_xs(5*it), lid = rmt_xs(5*it + 1), lev = rmt_xs(5*it + 2),
-    xos = rmt_xs(5*it + 3), qos = qsize*rmt_xs(5*it + 4);
+    xos = rmt_xs(5*it + 3);
     const auto&& xs = recvbuf(ri);
     auto&& qs = sendbuf(ri);
+    const Int qos = iq0*(qs.n()/qsize) + nq*rmt_xs(5*it + 4);
     Real rx[4], ry[4];
     calc_coefs<np,MT>(s2r, local_meshes(lid), alg, lid, lev, &xs(xos), rx, ry);
     Real* const q_tgt = &qs(qos);
     // Block for auto-vectorization.
-    for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
-      if (iqo + blocksize <= qsize) {
+    for (Int iqo = 0; iqo < nq; iqo += blocksize) {
+      if (iqo + blocksize <= nq) {
         Real tmp[blocksize];
         for (Int iqi = 0; iqi < blocksize; ++iqi) {
-          const Int iq = iqo + iqi;
+          const Int iq = iq0 + iqo + iqi;
           Real qsrc[16];
           for (Int k = 0; k < 16; ++k) qsrc[k] = q_src(lid, iq, k, lev);
           tmp[iqi] = calc_q_tgt(rx, ry, qsrc);
@@ -579,9 +598,9 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
         for (Int iqi = 0; iqi < blocksize; ++iqi)
           q_tgt[iqo + iqi] = tmp[iqi];
       } else {
-        for (Int iq = iqo; iq < qsize; ++iq) {
+        for (Int iq = iqo; iq < nq; ++iq) {
           Real qsrc[16];
-          for (Int k = 0; k < 16; ++k) qsrc[k] = q_src(lid, iq, k, lev);
+          for (Int k = 0; k < 16; ++k) qsrc[k] = q_src(lid, iq0 + iq, k, lev);
           q_tgt[iq] = calc_q_tgt(rx, ry, qsrc);
         }
       }
@@ -672,40 +691,45 @@ void calc_rmt_q_pass1 (IslMpi<MT>& cm) {
 }
 
 template <Int np, typename MT>
-void calc_rmt_q (IslMpi<MT>& cm) {
-  { slmm::Timer t("09_rmt_q_pass1");
-    calc_rmt_q_pass1<np>(cm); }
-  { slmm::Timer t("09_rmt_q_pass2");
-    calc_rmt_q_pass2<np>(cm); }
+void calc_rmt_q (IslMpi<MT>& cm, const Int& ic) {
+  if (ic == 0) {
+    slmm::Timer t("09_rmt_q_pass1");
+    calc_rmt_q_pass1<np>(cm);
+  }
+  { slmm::Timer t(qchunk_timer_name(cm, "09_rmt_q_pass2", ic));
+    calc_rmt_q_pass2<np>(cm, ic); }
 }
 
 template <typename MT>
 void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
                  const DepPoints<MT>& dep_points,
-                 const QExtrema<MT>& q_min, const QExtrema<MT>& q_max) {
+                 const QExtrema<MT>& q_min, const QExtrema<MT>& q_max,
+                 const Int& ic) {
   switch (cm.np) {
-  case 4: calc_own_q<4>(cm, nets, nete, dep_points, q_min, q_max); break;
+  case 4: calc_own_q<4>(cm, nets, nete, dep_points, q_min, q_max, ic); break;
   default: slmm_throw_if(true, "np " << cm.np << "not supported");
   }
 }
 
 template <typename MT>
-void calc_rmt_q (IslMpi<MT>& cm) {
+void calc_rmt_q (IslMpi<MT>& cm, const Int& ic) {
   switch (cm.np) {
-  case 4: calc_rmt_q<4>(cm); break;
+  case 4: calc_rmt_q<4>(cm, ic); break;
   default: slmm_throw_if(true, "np " << cm.np << "not supported");
   }
 }
 
-template void calc_rmt_q(IslMpi<ko::MachineTraits>& cm);
+template void calc_rmt_q(IslMpi<ko::MachineTraits>& cm, const Int& ic);
 template void calc_own_q(IslMpi<ko::MachineTraits>& cm,
                          const Int& nets, const Int& nete,
                          const DepPoints<ko::MachineTraits>& dep_points,
                          const QExtrema<ko::MachineTraits>& q_min,
-                         const QExtrema<ko::MachineTraits>& q_max);
+                         const QExtrema<ko::MachineTraits>& q_max,
+                         const Int& ic);
 template void copy_q(IslMpi<ko::MachineTraits>& cm, const Int& nets,
                      const QExtrema<ko::MachineTraits>& q_min,
-                     const QExtrema<ko::MachineTraits>& q_max);
+                     const QExtrema<ko::MachineTraits>& q_max,
+                     const Int& ic);
 
 } // namespace islmpi
 } // namespace homme
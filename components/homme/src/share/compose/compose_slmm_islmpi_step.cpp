@@ -56,28 +56,47 @@ void step (
   // barrier, at the same time make sure the send buffer is free for use.
   { Timer t("08_recv_and_wait");
     recv_and_wait_on_send(cm); }
+  // The q exchange is pipelined over chunks of tracers: while chunk ic's q
+  // data are in flight, compute the requested q for chunk ic+1 and send it,
+  // then compute q for the departure points that have remained in my elements.
+  // Timers are reported per chunk.
+  const Int nqchunk = cm.nqchunk;
+  // With one chunk, the q data are received into recvbuf, so we can't set up to
+  // receive them until the OpenMP barrier in isend_q assures that all threads
+  // are done with the receive buffer's departure points. Otherwise, q data are
+  // received into a separate buffer, and we can do it right away.
+  if (nqchunk > 1) {
+    Timer t("11_setup_irecv");
+    setup_irecv_q(cm);
+  }
   // Compute the requested q for departure points from remotes.
-  calc_rmt_q(cm);
+  calc_rmt_q(cm, 0);
   // Send q data.
-  { Timer t("10_isend");
-    isend(cm, true /* want_req */, true /* skip_if_empty */); }
-  // Set up to receive q for each of my departure point requests sent to
-  // remotes. We can't do this until the OpenMP barrier in isend assures that
-  // all threads are done with the receive buffer's departure points.
-  { Timer t("11_setup_irecv");
-    setup_irecv(cm, true /* skip_if_empty */); }
-  // While waiting to get my data from remotes, compute q for departure points
-  // that have remained in my elements.
-  { Timer t("12_own_q");
-    calc_own_q(cm, nets, nete, dep_points, q_min, q_max); }
-  // Receive remote q data and use this to fill in the rest of my fields.
-  { Timer t("13_recv");
-    recv(cm, true /* skip_if_empty */); }
-  { Timer t("14_copy_q");
-    copy_q(cm, nets, q_min, q_max); }
+  { Timer t(qchunk_timer_name(cm, "10_isend", 0));
+    isend_q(cm, 0); }
+  if (nqchunk == 1) {
+    Timer t("11_setup_irecv");
+    setup_irecv_q(cm);
+  }
+  for (Int ic = 0; ic < nqchunk; ++ic) {
+    if (ic+1 < nqchunk) {
+      calc_rmt_q(cm, ic+1);
+      { Timer t(qchunk_timer_name(cm, "10_isend", ic+1));
+        isend_q(cm, ic+1); }
+    }
+    // While waiting to get my data from remotes, compute q for departure points
+    // that have remained in my elements.
+    { Timer t(qchunk_timer_name(cm, "12_own_q", ic));
+      calc_own_q(cm, nets, nete, dep_points, q_min, q_max, ic); }
+    // Receive remote q data and use this to fill in the rest of my fields.
+    { Timer t(qchunk_timer_name(cm, "13_recv", ic));
+      recv_q(cm, ic); }
+    { Timer t(qchunk_timer_name(cm, "14_copy_q", ic));
+      copy_q(cm, nets, q_min, q_max, ic); }
+  }
   // Wait on send buffer so it's free to be used by others.
   { Timer t("15_wait_on_send");
-    wait_on_send(cm, true /* skip_if_empty */); }
+    wait_on_send_q(cm); }
 }
 
 template void step(IslMpi<ko::MachineTraits>&, const Int, const Int, Real*, Real*, Real*);
@@ -178,6 +178,26 @@ get_default_team_policy(const int num_parallel_iterations,
   return policy;
 }
 
+// Like get_default_team_policy, but with the team/vector sizes of the default
+// policy for num_total_iterations. Use this to run a kernel on a subset of the
+// iterations (e.g., only the interior elements) while still using a TeamUtils
+// built for the full default policy, since its workspace indices depend on the
+// team size.
+template <typename ExecSpace, typename... Tags>
+Kokkos::TeamPolicy<ExecSpace, Tags...>
+get_subset_team_policy(const int num_parallel_iterations,
+                       const int num_total_iterations,
+                       const ThreadPreferences tp = ThreadPreferences()) {
+  const auto threads_vectors =
+    DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(
+      num_total_iterations, tp);
+  auto policy = Kokkos::TeamPolicy<ExecSpace, Tags...>(num_parallel_iterations,
+                                                   threads_vectors.first,
+                                                   threads_vectors.second);
+  policy.set_chunk_size(1);
+  return policy;
+}
+
 template<typename ExecSpaceType, typename... Tags>
 static
 typename std::enable_if<!OnGpu<ExecSpaceType>::value,int>::type
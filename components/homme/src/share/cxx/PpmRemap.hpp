@@ -575,60 +575,73 @@ struct PpmVertRemap : public VertRemapAlg {
     kv.team_barrier();
   }
 
+  // Compute remapping intervals once for all tracers. For the k-th new cell
+  // interface, find the old grid cell index kk in which it resides, that is,
+  // the largest kk such that pio(kk)<=pin(k+1).
+  //
+  // Note that because we set pio(NUM_PHYSICAL_LEV+1) = pio(NUM_PHYSICAL_LEV) + 1.0
+  // and pin(NUM_PHYSICAL_LEV) = pio(NUM_PHYSICAL_LEV), we have kk <= NUM_PHYSICAL_LEV.
+  // Furthermore, since pio(0) = pin(0) = 0.0, we have kk >= 0.
+  // Since the top bounds match anyway, the value of the coefficients don't
+  // matter, so enforcing kk < NUM_PHYSICAL_LEV doesn't affect anything important.
+  //
+  // On CPU, since both pio and pin are increasing, we find all kk's with a single
+  // merge pass over the two arrays, whose cost does not depend on how much the
+  // grid deformed.
+  template <typename ExecSpaceType = ExecSpace>
+  KOKKOS_INLINE_FUNCTION
+  typename std::enable_if<!Homme::OnGpu<ExecSpaceType>::value, void>::type
+  compute_kid(KernelVariables &kv,
+      ExecViewUnmanaged<const Real[_ppm_consts::PIO_PHYSICAL_LEV]> pio,
+      ExecViewUnmanaged<const Real[_ppm_consts::PIN_PHYSICAL_LEV]> pin,
+      ExecViewUnmanaged<int[NUM_PHYSICAL_LEV]> k_id) const {
+    Kokkos::single(Kokkos::PerThread(kv.team), [&]() {
+      int kk = 0;
+      for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+        assert(pio(_ppm_consts::PIO_PHYSICAL_LEV - 1) > pin(k + 1));
+        while (pio(kk+1) <= pin(k+1)) {
+          ++kk;
+        }
+        // This is to keep the indices in bounds.
+        k_id(k) = kk==NUM_PHYSICAL_LEV ? kk-1 : kk;
+      }
+    });
+  }
+
+  // On GPU, each k is handled by a different vector lane, with a branchless
+  // binary search, so that all lanes run the same number of iterations.
+  template <typename ExecSpaceType = ExecSpace>
+  KOKKOS_INLINE_FUNCTION
+  typename std::enable_if<Homme::OnGpu<ExecSpaceType>::value, void>::type
+  compute_kid(KernelVariables &kv,
+      ExecViewUnmanaged<const Real[_ppm_consts::PIO_PHYSICAL_LEV]> pio,
+      ExecViewUnmanaged<const Real[_ppm_consts::PIN_PHYSICAL_LEV]> pin,
+      ExecViewUnmanaged<int[NUM_PHYSICAL_LEV]> k_id) const {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                         [&](const int k) {
+      assert(pio(_ppm_consts::PIO_PHYSICAL_LEV - 1) > pin(k + 1));
+      const int kk = branchless_binary_search(pio,pin(k+1));
+      // This is to keep the indices in bounds.
+      k_id(k) = kk==NUM_PHYSICAL_LEV ? kk-1 : kk;
+    });
+  }
+
   KOKKOS_INLINE_FUNCTION
   void compute_integral_bounds(KernelVariables &kv) const {
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
                          [&](const int &loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
-      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
-                           [&](const int k) {
-        // Compute remapping intervals once for all
-        // tracers. Find the old grid cell index in which
-        // the k-th new cell interface resides. Then
-        // integrate from the bottom of that old cell to
-        // the new interface location. In practice, the
-        // grid never deforms past one cell, so the search
-        // can be simplified by this. Also, the interval
-        // of integration is usually of magnitude close to
-        // zero or close to dpo because of minimial
-        // deformation. Numerous tests confirmed that the
-        // bottom and top of the grids match to machine
-        // precision, so set them equal to each other.
-        int kk = k;// + 1;
-        // This reduces the work required to find the index where this
-        // fails at, and is typically less than NUM_PHYSICAL_LEV^2 Since
-        // the top bounds match anyway, the value of the coefficients
-        // don't matter, so enforcing kk <= NUM_PHYSICAL_LEV doesn't
-        // affect anything important
-        //
-        // Note that because we set
-        // pio(:, :, :, NUM_PHYSICAL_LEV + 1) = pio(:, :, :,
-        // NUM_PHYSICAL_LEV) + 1.0 and pin(:, :, :, NUM_PHYSICAL_LEV) =
-        // pio(:, :, :, NUM_PHYSICAL_LEV) this loop ensures kk <=
-        // NUM_PHYSICAL_LEV + 2 Furthermore, since we set pio(:, :, :,
-        // 0) = 0.0 and pin(:, :, :, 0) = 0.0 kk must be incremented at
-        // least once
-        assert(m_pio(kv.ie, igp, jgp, _ppm_consts::PIO_PHYSICAL_LEV - 1) >
-               m_pin(kv.ie, igp, jgp, k + 1));
-        if (m_pio(kv.ie,igp,jgp,kk) <= m_pin(kv.ie,igp,jgp,k+1)) {
-          while (m_pio(kv.ie, igp, jgp, kk) <= m_pin(kv.ie, igp, jgp, k + 1)) {
-            kk++;
-            assert(kk < m_pio.extent_int(3));
-          }
-          --kk;
-        } else {
-          binary_search(Homme::subview(m_pio,kv.ie,igp,jgp),m_pin(kv.ie,igp,jgp,k+1),kk);
-        }
 
-        // This is to keep the indices in bounds.
-        if (kk == NUM_PHYSICAL_LEV) {
-          --kk;
-        }
-        // kk is now the cell index we're integrating over.
+      compute_kid(kv, Homme::subview(m_pio, kv.ie, igp, jgp),
+                      Homme::subview(m_pin, kv.ie, igp, jgp),
+                      Homme::subview(m_kid, kv.ie, igp, jgp));
 
-        // Save kk for reuse
-        m_kid(kv.ie, igp, jgp, k) = kk;
+      // Integrate from the bottom of the old cell kk to the new interface
+      // location. Note: each vector lane reads the kk it computed in compute_kid.
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                           [&](const int k) {
+        const int kk = m_kid(kv.ie, igp, jgp, k);
         // PPM interpolants are normalized to an independent coordinate
         // domain
         // [-0.5, 0.5].
@@ -51,6 +51,7 @@ BoundaryExchange::BoundaryExchange()
   m_cleaned_up = true;
   m_send_pending = false;
   m_recv_pending = false;
+  m_local_pack_pending = false;
 }
 
 BoundaryExchange::BoundaryExchange(std::shared_ptr<Connectivity> connectivity, std::shared_ptr<MpiBuffersManager> buffers_manager)
@@ -329,8 +330,81 @@ void BoundaryExchange::pack_and_send ()
   }
 
   // ---- Pack ---- //
-  // First, pack 2d fields (if any)...
+  pack (ConnectionSharing::ANY);
+
+  // ---- Send ---- //
+  send ();
+  tstop("be pack_and_send");
+}
+
+void BoundaryExchange::exchange_start ()
+{
+  // Check that the registration has completed first
+  assert (m_registration_completed);
+
+  // Check that this object is setup to perform exchange and not exchange_min_max
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  tstart("be exchange_start");
+  // Check that buffers are not locked by someone else, then lock them
+  assert (!m_buffers_manager->are_buffers_busy());
+  m_buffers_manager->lock_buffers();
+
+  if (!m_buffer_views_and_requests_built) {
+    build_buffer_views_and_requests();
+  }
+
+  if ( ! m_recv_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+  m_recv_pending = true;
+
+  // Only shared connections here: local ones may still read from interior
+  // elements, which the caller is allowed to update until exchange_finish.
+  pack (ConnectionSharing::SHARED);
+  send ();
+  m_local_pack_pending = true;
+  tstop("be exchange_start");
+}
+
+void BoundaryExchange::exchange_finish () {
+  exchange_finish(nullptr);
+}
+
+void BoundaryExchange::exchange_finish (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  exchange_finish(&rspheremp);
+}
+
+void BoundaryExchange::exchange_finish (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  // Don't call exchange_finish without exchange_start
+  assert (m_local_pack_pending && m_send_pending);
+
+  tstart("be exchange_finish");
+  pack (ConnectionSharing::LOCAL);
+  m_local_pack_pending = false;
+
+  recv_and_unpack (rspheremp);
+  tstop("be exchange_finish");
+}
+
+void BoundaryExchange::pack (const ConnectionSharing sharing)
+{
+  tstart("be pack");
+  // Only pack connections with the requested sharing (all of them if sharing is ANY)
   auto connections = m_connectivity->get_connections<ExecMemSpace>();
+  const int pack_sharing = etoi(sharing);
+  constexpr int any_sharing = etoi(ConnectionSharing::ANY);
+
+  // First, pack 2d fields (if any)...
   if (m_num_2d_fields>0) {
     auto fields_2d = m_2d_fields;
     auto send_2d_buffers = m_send_2d_buffers;
@@ -338,6 +412,7 @@ void BoundaryExchange::pack_and_send ()
     Kokkos::parallel_for(MDRangePolicy<ExecSpace, 3>({0, 0, 0}, {m_num_elems, NUM_CONNECTIONS, m_num_2d_fields}, {1, 1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int iconn, const int ifield) {
       const ConnectionInfo& info = connections(ie, iconn);
+      if (pack_sharing!=any_sharing && info.sharing!=pack_sharing) return;
       const LidGidPos& field_lidpos  = info.local;
       // For the buffer, in case of local connection, use remote info. In fact, while with shared connections the
       // mpi call will take care of "copying" data to the remote recv buffer in the correct remote element lid,
@@ -366,6 +441,7 @@ void BoundaryExchange::pack_and_send ()
           const int iconn = (it / NUM_LEV) % NUM_CONNECTIONS;
           const int ilev = it % NUM_LEV;
           const ConnectionInfo& info = connections(ie, iconn);
+          if (pack_sharing!=any_sharing && info.sharing!=pack_sharing) return;
           const LidGidPos& field_lidpos = info.local;
           // For the buffer, in case of local connection, use remote info. In fact, while with shared connections the
           // mpi call will take care of "copying" data to the remote recv buffer in the correct remote element lid,
@@ -400,6 +476,7 @@ void BoundaryExchange::pack_and_send ()
           for (int iconn = 0; iconn < 8; ++iconn) {
             const ConnectionInfo& info = connections(ie, iconn);
             if (info.kind == etoi(ConnectionSharing::MISSING)) continue;
+            if (pack_sharing!=any_sharing && info.sharing!=pack_sharing) continue;
             const LidGidPos& field_lidpos = info.local;
             const LidGidPos& buffer_lidpos = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                               info.remote :
@@ -439,6 +516,7 @@ void BoundaryExchange::pack_and_send ()
           const int iconn = (it / NUM_LEV_P) % NUM_CONNECTIONS;
           const int ilev = it % NUM_LEV_P;
           const ConnectionInfo& info = connections(ie, iconn);
+          if (pack_sharing!=any_sharing && info.sharing!=pack_sharing) return;
           const LidGidPos& field_lidpos = info.local;
           // For the buffer, in case of local connection, use remote info. In fact, while with shared connections the
           // mpi call will take care of "copying" data to the remote recv buffer in the correct remote element lid,
@@ -473,6 +551,7 @@ void BoundaryExchange::pack_and_send ()
           for (int iconn = 0; iconn < 8; ++iconn) {
             const ConnectionInfo& info = connections(ie, iconn);
             if (info.kind == etoi(ConnectionSharing::MISSING)) continue;
+            if (pack_sharing!=any_sharing && info.sharing!=pack_sharing) continue;
             const LidGidPos& field_lidpos = info.local;
             const LidGidPos& buffer_lidpos = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                               info.remote :
@@ -499,7 +578,11 @@ void BoundaryExchange::pack_and_send ()
   }
   Kokkos::fence();
 
-  // ---- Send ---- //
+  tstop("be pack");
+}
+
+void BoundaryExchange::send ()
+{
   tstart("be sync_send_buffer");
   m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
   tstop("be sync_send_buffer");
@@ -510,7 +593,7 @@ void BoundaryExchange::pack_and_send ()
 
   // Notify a send is ongoing
   m_send_pending = true;
-  tstop("be pack_and_send");
+  tstop("be send");
 }
 
 void BoundaryExchange::recv_and_unpack () {
@@ -190,6 +190,16 @@ public:
   void exchange ();
   void exchange (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
 
+  // Split-phase version of exchange. exchange_start posts the receives, then packs and sends
+  // the shared (off-process) connections; exchange_finish packs the local connections, then
+  // waits for the messages and unpacks. The registered fields of the boundary elements
+  // (see Connectivity::get_boundary_elements) must be final when exchange_start is called,
+  // while the interior elements can still be updated until exchange_finish is called.
+  // This allows to overlap the computation on interior elements with the communication.
+  void exchange_start ();
+  void exchange_finish ();
+  void exchange_finish (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
   // Exchange all registered 1d fields, performing min/max operations with neighbors
   void exchange_min_max ();
 
@@ -287,6 +297,7 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_local_pack_pending;
 
   int         m_num_elems;
 
@@ -296,8 +307,13 @@ private:
   void free_requests();
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void exchange_finish(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  // Start the sends (the send buffers must be packed already)
+  void send();
 public: // This is semantically private but must be public for nvcc.
   void recv_and_unpack(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  // Pack the connections with the given sharing (ANY packs all of them)
+  void pack(const ConnectionSharing sharing);
 };
 
 // ============================ REGISTER METHODS ========================= //
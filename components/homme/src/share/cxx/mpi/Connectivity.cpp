@@ -9,6 +9,7 @@
 
 #include <array>
 #include <algorithm>
+#include <vector>
 
 namespace Homme
 {
@@ -17,6 +18,7 @@ Connectivity::Connectivity ()
  : m_finalized    (false)
  , m_initialized  (false)
  , m_num_local_elements (-1)
+ , m_num_boundary_elements (0)
 {
   // Nothing to be done here
 }
@@ -162,9 +164,35 @@ void Connectivity::finalize(const bool sanity_check)
     h_num_connections(etoi(ConnectionKind::ANY),etoi(ConnectionKind::ANY)) += h_num_connections(etoi(ConnectionSharing::ANY),kind);
   }
 
+  // Sort local elements so that the ones with at least one shared connection
+  // (boundary elements) come first, followed by the ones whose neighbors are
+  // all on this process (interior elements). Within each group, elements keep
+  // their lid order.
+  m_elems_by_sharing = ExecViewManaged<int*>("Elements sorted by sharing", m_num_local_elements);
+  h_elems_by_sharing = Kokkos::create_mirror_view(m_elems_by_sharing);
+  m_num_boundary_elements = 0;
+  std::vector<int> interior;
+  for (int ie=0; ie<m_num_local_elements; ++ie) {
+    bool shared = false;
+    for (int iconn=0; iconn<NUM_CONNECTIONS; ++iconn) {
+      shared = shared || h_connections(ie,iconn).sharing==etoi(ConnectionSharing::SHARED);
+    }
+    if (shared) {
+      h_elems_by_sharing(m_num_boundary_elements++) = ie;
+    } else {
+      interior.push_back(ie);
+    }
+  }
+  const int num_interior = interior.size();
+  for (int i=0; i<num_interior; ++i) {
+    h_elems_by_sharing(m_num_boundary_elements+i) = interior[i];
+  }
+  assert (m_num_boundary_elements+num_interior==m_num_local_elements);
+
   // Copying to device
   Kokkos::deep_copy(m_connections, h_connections);
   Kokkos::deep_copy(m_num_connections, h_num_connections);
+  Kokkos::deep_copy(m_elems_by_sharing, h_elems_by_sharing);
 
   m_finalized = true;
 }
@@ -173,6 +201,9 @@ void Connectivity::clean_up()
 {
   m_connections = ExecViewManaged<ConnectionInfo*[NUM_CONNECTIONS]>("",0);
   Kokkos::deep_copy(m_num_connections,0);
+  m_elems_by_sharing = ExecViewManaged<int*>("",0);
+  h_elems_by_sharing = Kokkos::create_mirror_view(m_elems_by_sharing);
+  m_num_boundary_elements = 0;
 
   // Cleaning up also the host mirrors
   Kokkos::deep_copy(h_connections, m_connections);
@@ -120,6 +120,20 @@ public:
 
   int get_num_local_elements     () const { return m_num_local_elements;  }
 
+  // Boundary elements have at least one connection with an element owned by another process,
+  // while interior elements only connect to elements on this process. Interior elements can
+  // therefore be computed while a halo exchange is in flight (see BoundaryExchange::exchange_start).
+  // The two lists store element lids, and are only available after finalize is called.
+  int get_num_boundary_elements  () const { return m_num_boundary_elements; }
+  int get_num_interior_elements  () const { return m_num_local_elements - m_num_boundary_elements; }
+
+  ExecViewUnmanaged<const int*> get_boundary_elements () const {
+    return Kokkos::subview(m_elems_by_sharing,Kokkos::make_pair(0,m_num_boundary_elements));
+  }
+  ExecViewUnmanaged<const int*> get_interior_elements () const {
+    return Kokkos::subview(m_elems_by_sharing,Kokkos::make_pair(m_num_boundary_elements,m_num_local_elements));
+  }
+
   bool is_initialized () const { return m_initialized; }
   bool is_finalized   () const { return m_finalized;   }
 
@@ -143,6 +157,11 @@ private:
 
   ExecViewManaged<ConnectionInfo*[NUM_CONNECTIONS]>             m_connections;
   ExecViewManaged<ConnectionInfo*[NUM_CONNECTIONS]>::HostMirror h_connections;
+
+  // Element lids, with boundary elements first and interior elements after
+  int                                     m_num_boundary_elements;
+  ExecViewManaged<int*>                   m_elems_by_sharing;
+  ExecViewManaged<int*>::HostMirror       h_elems_by_sharing;
 };
 
 } // namespace Homme
@@ -157,6 +157,23 @@ void binary_search (ViewType<T[N],Properties...> array,
   k = lo;
 }
 
+// Branchless version of binary_search: returns the largest k such that array(k)<=pivot.
+// Assumes array is sorted, and array(0)<=pivot. The number of iterations only depends
+// on N (not on the data), so searches for different pivots can run in lockstep
+// across vector lanes.
+template<typename T, int N, typename... Properties>
+KOKKOS_INLINE_FUNCTION
+int branchless_binary_search (ViewType<T[N],Properties...> array,
+                              const T& pivot) {
+  int k = 0;
+  for (int len=N; len>1; ) {
+    const int half = len/2;
+    k = array(k+half)<=pivot ? k+half : k;
+    len -= half;
+  }
+  return k;
+}
+
 // For nextpow2 and prevpow2, see, e.g.,
 //   https://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2
 inline unsigned short nextpow2 (unsigned short n) {
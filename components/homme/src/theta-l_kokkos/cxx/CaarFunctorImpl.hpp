@@ -120,6 +120,14 @@ struct CaarFunctorImpl {
 
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, NUM_TIME_LEVELS> m_bes;
 
+  // Elements with/without neighbors on other ranks. If both are non-empty, the
+  // pre-exchange loop on interior elements overlaps with the halo exchange.
+  ExecViewUnmanaged<const int*> m_boundary_elems;
+  ExecViewUnmanaged<const int*> m_interior_elems;
+
+  // If not empty, the pre-exchange kernel runs on these element lids only
+  ExecViewUnmanaged<const int*> m_elem_ids;
+
   CaarFunctorImpl(const Elements &elements, const Tracers &/* tracers */,
                   const ReferenceElement &ref_FE, const HybridVCoord &hvcoord,
                   const SphereOperators &sphere_ops, const SimulationParams& params)
@@ -314,6 +322,10 @@ struct CaarFunctorImpl {
       }
       be.registration_completed();
     }
+
+    const auto connectivity = bm_exchange->get_connectivity();
+    m_boundary_elems = connectivity->get_boundary_elements();
+    m_interior_elems = connectivity->get_interior_elements();
   }
 
   void set_rk_stage_data (const RKStageData& data) {
@@ -333,15 +345,36 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
-    GPTLstart("caar compute");
-    Kokkos::parallel_for("caar loop pre-boundary exchange", m_policy_pre, *this);
-    Kokkos::fence();
-    GPTLstop("caar compute");
+    if (m_boundary_elems.size()>0 && m_interior_elems.size()>0) {
+      // Compute boundary elements first, and send their halo data while
+      // computing the interior elements, which have no remote neighbors.
+      GPTLstart("caar compute");
+      run_pre_exchange_on(m_boundary_elems);
+      GPTLstop("caar compute");
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
-    GPTLstop("caar_bexchV");
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange_start();
+      GPTLstop("caar_bexchV");
+
+      GPTLstart("caar compute");
+      run_pre_exchange_on(m_interior_elems);
+      GPTLstop("caar compute");
+
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange_finish(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    } else {
+      GPTLstart("caar compute");
+      Kokkos::parallel_for("caar loop pre-boundary exchange", m_policy_pre, *this);
+      Kokkos::fence();
+      GPTLstop("caar compute");
+
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    }
 
     if (!m_theta_hydrostatic_mode) {
       GPTLstart("caar compute");
@@ -358,12 +391,26 @@ struct CaarFunctorImpl {
     profiling_pause();
   }
 
+  void run_pre_exchange_on (const ExecViewUnmanaged<const int*>& elem_ids)
+  {
+    // Use the same team layout of m_policy_pre, since m_tu was built from it
+    m_elem_ids = elem_ids;
+    const TeamPolicyType<TagPreExchange> policy =
+      Homme::get_subset_team_policy<ExecSpace,TagPreExchange>(elem_ids.extent_int(0),m_num_elems);
+    Kokkos::parallel_for("caar loop pre-boundary exchange", policy, *this);
+    Kokkos::fence();
+    m_elem_ids = ExecViewUnmanaged<const int*>();
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagPreExchange&, const TeamMember &team) const {
     // In this body, we use '====' to separate sync epochs (delimited by barriers)
     // Note: make sure the same temp is not used within each epoch!
 
     KernelVariables kv(team, m_tu);
+    if (m_elem_ids.size()>0) {
+      kv.ie = m_elem_ids(kv.ie);
+    }
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
@@ -211,6 +211,10 @@ void HyperviscosityFunctorImpl::init_boundary_exchanges () {
   }
   m_be->register_field(m_buffers.vtens, 2, 0);
   m_be->registration_completed();
+
+  const auto connectivity = bm_exchange->get_connectivity();
+  m_boundary_elems = connectivity->get_boundary_elements();
+  m_interior_elems = connectivity->get_interior_elements();
 }//initBE
 
 void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real eta_ave_w)
@@ -258,14 +262,26 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
     biharmonic_wk_theta ();
     GPTLstop("hvf-bhwk");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
-    Kokkos::fence();
-
     // Exchange
     assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+    if (overlap_exchange()) {
+      // Send the boundary elements' data while computing the interior elements
+      run_on_elems<TagHyperPreExchange>(m_boundary_elems);
+      GPTLstart("hvf-bexch");
+      m_be->exchange_start();
+      GPTLstop("hvf-bexch");
+      run_on_elems<TagHyperPreExchange>(m_interior_elems);
+      GPTLstart("hvf-bexch");
+      m_be->exchange_finish();
+      GPTLstop("hvf-bexch");
+    } else {
+      Kokkos::parallel_for(m_policy_pre_exchange, *this);
+      Kokkos::fence();
+
+      GPTLstart("hvf-bexch");
+      m_be->exchange();
+      GPTLstop("hvf-bexch");
+    }
 
     // Update states
     Kokkos::parallel_for(m_policy_update_states, *this);
@@ -341,19 +357,30 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   } //for for sponge layer
 } //run()
 
-void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
+void HyperviscosityFunctorImpl::biharmonic_wk_theta()
 {
   // For the first laplacian we use a differnt kernel, which uses directly the states
   // at timelevel np1 as inputs, and subtracts the reference states.
   // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
-  Kokkos::fence();
-
-  // Exchange
   assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+  if (overlap_exchange()) {
+    // Send the boundary elements' data while computing the interior elements
+    run_on_elems<TagFirstLaplaceHV>(m_boundary_elems);
+    GPTLstart("hvf-bexch");
+    m_be->exchange_start();
+    GPTLstop("hvf-bexch");
+    run_on_elems<TagFirstLaplaceHV>(m_interior_elems);
+    GPTLstart("hvf-bexch");
+    m_be->exchange_finish(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
+  } else {
+    Kokkos::parallel_for(m_policy_first_laplace, *this);
+    Kokkos::fence();
+
+    GPTLstart("hvf-bexch");
+    m_be->exchange(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
+  }
 
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
@@ -105,7 +105,23 @@ public:
 
   void run (const int np1, const Real dt, const Real eta_ave_w);
 
-  void biharmonic_wk_theta () const;
+  void biharmonic_wk_theta ();
+
+  // Run the kernel with the given tag only on the given element lids
+  template<typename Tag>
+  void run_on_elems (const ExecViewUnmanaged<const int*>& elem_ids) {
+    // Use the same team layout of the default policies, since m_tu was built from one of them
+    m_elem_ids = elem_ids;
+    auto policy = Homme::get_subset_team_policy<ExecSpace,Tag>(elem_ids.extent_int(0),m_num_elems);
+    Kokkos::parallel_for(policy, *this);
+    Kokkos::fence();
+    m_elem_ids = ExecViewUnmanaged<const int*>();
+  }
+
+  // Whether the halo exchanges can overlap with the computation on interior elements
+  bool overlap_exchange () const {
+    return m_boundary_elems.size()>0 && m_interior_elems.size()>0;
+  }
 
   // first iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
@@ -113,6 +129,9 @@ public:
      using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    if (m_elem_ids.size()>0) {
+      kv.ie = m_elem_ids(kv.ie);
+    }
     // Subtract the reference states from the states
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
                          [&](const int idx) {
@@ -444,6 +463,9 @@ public:
     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    if (m_elem_ids.size()>0) {
+      kv.ie = m_elem_ids(kv.ie);
+    }
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
                          [&](const int &point_idx) {
       const int igp = point_idx / NP;
@@ -539,6 +561,13 @@ protected:
 
   std::shared_ptr<BoundaryExchange> m_be;
 
+  // Elements with/without neighbors on other ranks (see Connectivity)
+  ExecViewUnmanaged<const int*> m_boundary_elems;
+  ExecViewUnmanaged<const int*> m_interior_elems;
+
+  // If not empty, the first laplace and pre-exchange kernels run on these element lids only
+  ExecViewUnmanaged<const int*> m_elem_ids;
+
   ExecViewManaged<Scalar[NUM_LEV]> m_nu_scale_top;
 }; //HVfunctorImpl
 
@@ -46,6 +46,8 @@ IF (${HOMME_ENABLE_COMPOSE})
   LIST(APPEND HOMME_TESTS
     thetah-sl-test11conv-r1t2-cdr20.cmake
     thetah-sl-test11conv-r0t1-cdr30-rrm.cmake
+    thetah-sl-test11conv-r0t1-cdr30-rrm-qgroups.cmake
+    thetah-sl-test11conv-r0t1-cdr30-rrm-qchunk.cmake
     thetah-sl-dcmip16_test1pg2.cmake
     )
 ENDIF()
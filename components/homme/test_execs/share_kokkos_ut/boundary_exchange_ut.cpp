@@ -50,7 +50,7 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   std::uniform_int_distribution<int>   dint(0,1);
 
   constexpr int ne        = 2;
-  constexpr int num_tests = 1;
+  constexpr int num_tests = 2;
   constexpr int DIM       = 2;
   constexpr double test_tolerance = 1e-13;
   constexpr int num_min_max_fields_1d = 1; // Count min and max of a field as 1, does not count the x2 due to min and max
@@ -136,6 +136,9 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     // Whether the neighbor min/max should be done as a whole or with two separate calls (start/pack_and_send and finish/recv_and_unpack)
     int minmax_split = dint(engine);
 
+    // The last test exchanges 2d/3d fields with the split-phase interface (exchange_start/exchange_finish)
+    const bool split_phase = itest==num_tests-1;
+
     // Initialize input data to random values
     genRandArray(field_min_1d_f90,engine,dreal_minmax);
     genRandArray(field_max_1d_f90,engine,dreal_minmax);
@@ -204,7 +207,14 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
                                field_3d_int_f90.data(), field_4d_f90.data(),
                                DIM, NUM_TIME_LEVELS, field_2d_idim+1, field_3d_idim+1, field_4d_outer_idim+1, minmax_split);
     minmax_split = 1;
-    if (minmax_split==0) {
+    if (split_phase) {
+      be3->pack_and_send_min_max();
+      be1->exchange_start();
+      be1->exchange_finish();
+      be2->exchange_start();
+      be2->exchange_finish();
+      be3->recv_and_unpack_min_max();
+    } else if (minmax_split==0) {
       be1->exchange();
       be2->exchange();
       be3->exchange_min_max();
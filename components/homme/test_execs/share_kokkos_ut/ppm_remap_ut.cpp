@@ -7,6 +7,7 @@
 #include "utilities/SubviewUtils.hpp"
 #include "utilities/TestUtils.hpp"
 
+#include <chrono>
 #include <random>
 
 using namespace Homme;
@@ -50,6 +51,7 @@ public:
   struct TagGridTest {};
   struct TagPPMTest {};
   struct TagRemapTest {};
+  struct TagGridsPhaseTest {};
 
   static bool nan_boundaries(
       HostViewUnmanaged<Real * [NP][NP][_ppm_consts::DPO_PHYSICAL_LEV]> host) {
@@ -375,6 +377,65 @@ public:
     }
   }
 
+  // Times the computation of the remap intervals (which is tracer independent),
+  // and checks the old grid cell index found for each new cell interface.
+  // The two random grids can differ by many levels, which is the worst case for
+  // the intervals search.
+  void test_grids_phase(const int num_reps) {
+    std::random_device rd;
+    const unsigned int catchRngSeed = Catch::rngSeed();
+    const unsigned int seed = catchRngSeed==0 ? rd() : catchRngSeed;
+    std::cout << "seed: " << seed << (catchRngSeed==0 ? " (catch rng seed was 0)\n" : "\n");
+    rngAlg engine(seed);
+    initialize_layers(engine);
+
+    const auto policy = Homme::get_default_team_policy<ExecSpace, TagGridsPhaseTest>(ne);
+    Kokkos::parallel_for(policy, *this);
+    ExecSpace::impl_static_fence();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < num_reps; ++rep) {
+      Kokkos::parallel_for(policy, *this);
+    }
+    ExecSpace::impl_static_fence();
+    const auto finish = std::chrono::steady_clock::now();
+    const double usec = std::chrono::duration<double,std::micro>(finish-start).count();
+    std::cout << "compute_grids_phase (" << NUM_PHYSICAL_LEV << " levels, "
+              << ne << " elements): " << usec/num_reps << " us per call\n";
+
+    auto pio = Kokkos::create_mirror_view(remap.m_pio);
+    auto pin = Kokkos::create_mirror_view(remap.m_pin);
+    auto kid = Kokkos::create_mirror_view(remap.m_kid);
+    Kokkos::deep_copy(pio, remap.m_pio);
+    Kokkos::deep_copy(pin, remap.m_pin);
+    Kokkos::deep_copy(kid, remap.m_kid);
+    for (int ie = 0; ie < ne; ++ie) {
+      for (int igp = 0; igp < NP; ++igp) {
+        for (int jgp = 0; jgp < NP; ++jgp) {
+          for (int k = 0; k < NUM_PHYSICAL_LEV; ++k) {
+            const int kk = kid(ie, igp, jgp, k);
+            const Real p = pin(ie, igp, jgp, k + 1);
+            REQUIRE(kk >= 0);
+            REQUIRE(kk < NUM_PHYSICAL_LEV);
+            REQUIRE(pio(ie, igp, jgp, kk) <= p);
+            // The index is clamped at the top of the column
+            if (p < pio(ie, igp, jgp, NUM_PHYSICAL_LEV)) {
+              REQUIRE(pio(ie, igp, jgp, kk + 1) > p);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagGridsPhaseTest &, const TeamMember& team) const {
+    KernelVariables kv(team);
+    remap.compute_grids_phase(
+        kv, Homme::subview(src_layer_thickness_kokkos, kv.ie),
+        Homme::subview(tgt_layer_thickness_kokkos, kv.ie));
+  }
+
   const int ne, num_remap;
   PpmVertRemap<boundary_cond> remap;
   ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> src_layer_thickness_kokkos;
@@ -391,6 +452,15 @@ TEST_CASE("ppm_mirrored", "vertical remap") {
   SECTION("remap") { remap_test_mirrored.test_remap(); }
 }
 
+TEST_CASE("ppm_grids_phase", "vertical remap") {
+  // Build with PLEV=256 (see ppm_remap_256lev_ut) to time the search of the
+  // remap intervals on a tall column
+  constexpr int num_elems = 64;
+  constexpr int num_reps = 20;
+  ppm_remap_functor_test<PpmMirrored> remap_test(num_elems, 1);
+  remap_test.test_grids_phase(num_reps);
+}
+
 
 TEST_CASE("binary_search","binary_search")
 {
@@ -439,6 +509,9 @@ TEST_CASE("binary_search","binary_search")
       REQUIRE ( (pio(kk) <= pin(k+1) &&
                 pio(kk+1) >= pin(k+1) &&
                 !(pio(kk+1) == pin(k+1) && k!=length)) );
+
+      // The branchless version must find the same index
+      REQUIRE ( branchless_binary_search(pio,pin(k+1)) == kk );
     }
   }
 }
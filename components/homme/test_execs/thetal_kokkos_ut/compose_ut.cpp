@@ -44,6 +44,7 @@ extern "C" {
   void run_trajectory_f90(Real t0, Real t1, bool independent_time_steps, Real* dep,
                           Real* dprecon);
   void run_sl_vertical_remap_bfb_f90(Real* diagnostic);
+  void slmm_set_tracer_chunk_size(int qchunk);
 } // extern "C"
 
 using CA4d = Kokkos::View<Real****, Kokkos::LayoutRight, Kokkos::HostSpace>;
@@ -407,6 +408,18 @@ TEST_CASE ("compose_transport_testing") {
         //todo add an l2 ceiling for some select tracers as a function of ne
       }
     }
+
+    // Pipelining the remote q exchange over tracer chunks must not change the
+    // result.
+    std::vector<Real> eval_chunked(eval_c.size());
+    ct.test_2d(false, nmax, eval_c);
+    for (const int qchunk : {1, s.qsize-1}) {
+      slmm_set_tracer_chunk_size(qchunk);
+      ct.test_2d(false, nmax, eval_chunked);
+      if (s.get_comm().root())
+        for (size_t i = 0; i < eval_c.size(); ++i) REQUIRE(eval_chunked[i] == eval_c[i]);
+    }
+    slmm_set_tracer_chunk_size(0);
   }
 
   } catch (...) {}
@@ -9,6 +9,7 @@
 #include "share/util/scream_timing.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_async_writer.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -414,11 +415,16 @@ void AtmosphereDriver::create_fields()
   // Must have grids and procs at this point
   check_ad_status (s_procs_created | s_grids_created);
 
+  // If requested, carve all fields out of few large arenas (size in MB)
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  const long long arena_size = driver_options_pl.get<int>("field_arena_size",0)*1024LL*1024LL;
+
   // By now, the processes should have fully built the ids of their
   // required/computed fields and groups. Let them register them in the FM
   for (auto it : m_grids_manager->get_repo()) {
     auto grid = it.second;
     m_field_mgrs[grid->name()] = std::make_shared<field_mgr_type>(grid);
+    m_field_mgrs[grid->name()]->set_arena_size(arena_size);
     m_field_mgrs[grid->name()]->registration_begins();
   }
 
@@ -589,6 +595,10 @@ void AtmosphereDriver::initialize_output_managers () {
 
   auto& io_params = m_atm_params.sublist("Scorpio");
 
+  // All output managers share the same diagnostics, so that diagnostics requested
+  // by more than one output stream are computed only once per time step.
+  m_diags_registry = std::make_shared<AtmosphereDiagnosticRegistry>();
+
   // IMPORTANT: create model restart OutputManager first! This OM will be able to
   // retrieve the original simulation start date, which we later pass to the
   // OM of all the requested outputs.
@@ -599,6 +609,7 @@ void AtmosphereDriver::initialize_output_managers () {
     // Signal that this is not a normal output, but the model restart one
     m_output_managers.emplace_back();
     auto& om = m_output_managers.back();
+    om.set_diagnostics_registry(m_diags_registry);
     if (fvphyshack) {
       // Don't save CGLL fields from ICs to the restart file.
       std::map<std::string,field_mgr_ptr> fms;
@@ -628,6 +639,7 @@ void AtmosphereDriver::initialize_output_managers () {
     // Add a new output manager
     m_output_managers.emplace_back();
     auto& om = m_output_managers.back();
+    om.set_diagnostics_registry(m_diags_registry);
     om.setup(m_atm_comm,params,m_field_mgrs,m_grids_manager,m_run_t0,m_case_t0,false);
   }
 
@@ -1202,8 +1214,18 @@ void AtmosphereDriver::run (const int dt) {
   m_current_ts += dt;
 
   // Update output streams
+  bool wrote_restart_data = false;
   for (auto& out_mgr : m_output_managers) {
     out_mgr.run(m_current_ts);
+    wrote_restart_data |= out_mgr.wrote_restart_data();
+  }
+
+  // Pending async output is written on its own pio subsystem, so it can keep going
+  // after we return to the coupler. However, if restart data was written, make
+  // sure all output up to this step is on file, so that history and restart
+  // files are consistent. At finalization, the writer is drained anyways.
+  if (wrote_restart_data) {
+    AsyncWriter::instance().wait_all();
   }
 
   // We must zero out the precipitation flux after the output managers have run.
@@ -1211,6 +1233,14 @@ void AtmosphereDriver::run (const int dt) {
   //       an identity value. See Issue #1767.
   set_precipitation_fields_to_zero();
 
+  // Report host/device traffic due to field syncs during this step
+  const auto sync_stats = Field::get_sync_stats();
+  m_atm_logger->debug("[EAMxx::run] field syncs: "
+      + std::to_string(sync_stats.bytes_to_host) + " bytes to host, "
+      + std::to_string(sync_stats.bytes_to_dev) + " bytes to device, "
+      + std::to_string(sync_stats.num_skipped) + " syncs skipped");
+  Field::reset_sync_stats();
+
 #ifdef SCREAM_HAS_MEMORY_USAGE
   long long my_mem_usage = get_mem_usage(MB);
   long long max_mem_usage;
@@ -1237,6 +1267,7 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     out_mgr.finalize();
   }
   m_output_managers.clear();
+  m_diags_registry = nullptr;
 
   // Finalize, and then destroy all atmosphere processes
   m_atm_process_group->finalize( /* inputs ? */ );
@@ -1331,6 +1362,11 @@ void AtmosphereDriver::report_res_dep_memory_footprint () const {
       my_dev_mem_usage += fap.get_alloc_size();
       my_host_mem_usage += fap.get_alloc_size();
     }
+    // Arenas may have some unused room left
+    for (const auto& a : fm_it.second->get_arenas()) {
+      my_dev_mem_usage += a->capacity() - a->used();
+      my_host_mem_usage += a->capacity() - a->used();
+    }
   }
   // Grids
   for (const auto& it : m_grids_manager->get_repo()) {
@@ -1361,6 +1397,27 @@ void AtmosphereDriver::report_res_dep_memory_footprint () const {
     m_atm_logger->info("[EAMxx::init] resolution-dependent host memory footprint: " + std::to_string(max_host_mem_usage/1e6) + "MB");
   }
 
+  // Field arenas usage. The number of arenas may differ across ranks.
+  for (const auto& fm_it : m_field_mgrs) {
+    const auto& arenas = fm_it.second->get_arenas();
+    int my_num_arenas = arenas.size();
+    int max_num_arenas;
+    m_atm_comm.all_reduce(&my_num_arenas,&max_num_arenas,1,MPI_MAX);
+    for (int i=0; i<max_num_arenas; ++i) {
+      long long my_usage[3] = {0,0,0};
+      if (i<my_num_arenas) {
+        my_usage[0] = arenas[i]->used();
+        my_usage[1] = arenas[i]->capacity();
+        my_usage[2] = arenas[i]->num_fields();
+      }
+      long long max_usage[3];
+      m_atm_comm.all_reduce(my_usage,max_usage,3,MPI_MAX);
+      m_atm_logger->info("[EAMxx::init] field arena " + std::to_string(i) + " on grid " + fm_it.first
+          + ": " + std::to_string(max_usage[0]/1e6) + "MB used out of " + std::to_string(max_usage[1]/1e6)
+          + "MB, " + std::to_string(max_usage[2]) + " fields (max over ranks)");
+    }
+  }
+
   // The following is a memory usage based on probing some OS tools
 #ifdef SCREAM_HAS_MEMORY_USAGE
   long long my_mem_usage_from_os = get_mem_usage(MB);
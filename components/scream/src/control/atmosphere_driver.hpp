@@ -170,6 +170,9 @@ protected:
 
   std::list<OutputManager>                  m_output_managers;
 
+  // Diagnostics shared by all output managers
+  std::shared_ptr<AtmosphereDiagnosticRegistry> m_diags_registry;
+
   std::shared_ptr<ATMBufferManager>         m_memory_buffer;
   std::shared_ptr<SCDataManager>            m_surface_coupling_import_data_manager;
   std::shared_ptr<SCDataManager>            m_surface_coupling_export_data_manager;
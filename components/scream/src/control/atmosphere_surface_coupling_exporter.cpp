@@ -132,6 +132,7 @@ void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &s
   m_cpl_exports_view_h = decltype(m_cpl_exports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_exports);
   m_cpl_exports_view_d = Kokkos::create_mirror_view(DefaultDevice(), m_cpl_exports_view_h);
+  m_cpl_exports_zero_copy = m_cpl_exports_view_d.data()==m_cpl_exports_view_h.data();
 
   m_export_field_names = new name_t[m_num_scream_exports];
   std::memcpy(m_export_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_exports*32*sizeof(char));
@@ -152,6 +153,8 @@ void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &s
 
   m_column_info_d = decltype(m_column_info_d) ("m_info", m_num_scream_exports);
   m_column_info_h = Kokkos::create_mirror_view(m_column_info_d);
+
+  m_cpl_to_scream_idx_d = decltype(m_cpl_to_scream_idx_d) ("cpl_to_scream_idx", m_num_cpl_exports);
 }
 // =========================================================================================
 void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
@@ -198,6 +201,17 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   // Copy data to device for use in do_export()
   Kokkos::deep_copy(m_column_info_d, m_column_info_h);
 
+  // Map each cpl export to the scream export (if any) that sets it
+  auto cpl_to_scream_idx_h = Kokkos::create_mirror_view(m_cpl_to_scream_idx_d);
+  Kokkos::deep_copy(cpl_to_scream_idx_h, -1);
+  for (int i=0; i<m_num_scream_exports; ++i) {
+    EKAT_REQUIRE_MSG (cpl_to_scream_idx_h(m_cpl_indices_view(i))==-1,
+        "Error! Multiple scream exports to the same cpl export.\n"
+        "  - cpl index: " + std::to_string(m_cpl_indices_view(i)) + "\n");
+    cpl_to_scream_idx_h(m_cpl_indices_view(i)) = i;
+  }
+  Kokkos::deep_copy(m_cpl_to_scream_idx_d, cpl_to_scream_idx_h);
+
   // Perform initial export (if any are marked for export during initialization)
   if (any_initial_exports) do_export(0, true);
 }
@@ -234,16 +248,13 @@ void SurfaceCouplingExporter::do_export(const Int dt, const bool called_during_i
   const auto z_int = m_buffer.z_int;
   const auto z_mid = m_buffer.z_mid;
 
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_cpl_exports_view_d, 0.0);
-
   // Local copies, to deal with CUDA's handling of *this.
   const int  num_levs           = m_num_levs;
   const auto col_info           = m_column_info_d;
+  const auto cpl_to_scream_idx  = m_cpl_to_scream_idx_d;
   const auto cpl_exports_view_d = m_cpl_exports_view_d;
   const int  num_cols           = m_num_cols;
-  const int  num_exports        = m_num_scream_exports;
+  const int  num_cpl_exports    = m_num_cpl_exports;
 
   // Preprocess exports
   const auto setup_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(num_cols, num_levs);
@@ -291,23 +302,33 @@ void SurfaceCouplingExporter::do_export(const Int dt, const bool called_during_i
     }
   });
 
-  // Export to cpl data
-  auto export_policy   = policy_type (0,num_exports*num_cols);
+  // Export to cpl data. We loop over all cpl entries (in the cpl array order),
+  // so that any field not exported by scream, or not exported during
+  // initialization, is set to 0.0 by the same kernel.
+  auto export_policy   = policy_type (0,num_cpl_exports*num_cols);
   Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
-    const auto offset = icol*info.col_stride + info.col_offset;
-
-    // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_export) {
-      cpl_exports_view_d(icol,info.cpl_indx) = info.constant_multiple*info.data[offset];
+    const int icpl   = i % num_cpl_exports;
+    const int icol   = i / num_cpl_exports;
+    const int ifield = cpl_to_scream_idx(icpl);
+
+    Real value = 0;
+    if (ifield>=0) {
+      const auto& info = col_info(ifield);
+      const auto offset = icol*info.col_stride + info.col_offset;
+
+      // if this is during initialization, check whether or not the field should be exported
+      bool do_export = (not called_during_initialization || info.transfer_during_initialization);
+      if (do_export) {
+        value = info.constant_multiple*info.data[offset];
+      }
     }
+    cpl_exports_view_d(icol,icpl) = value;
   });
 
-  // Deep copy fields from device to cpl host array
-  Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+  // Deep copy fields from device to cpl host array (unless the device uses the host array directly)
+  if (not m_cpl_exports_zero_copy) {
+    Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+  }
 }
 // =========================================================================================
 void SurfaceCouplingExporter::finalize_impl()
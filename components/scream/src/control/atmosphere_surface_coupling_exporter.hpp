@@ -117,8 +117,11 @@ protected:
   // Views storing a 2d array with dims (num_cols,num_fields) for cpl export data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
   // pointer to the whole a2x array from Fortran)
+  // Note: if the default device can access host memory, the device view is the host
+  //       view itself, and no copy is needed (m_cpl_exports_zero_copy=true).
   view_2d <DefaultDevice, Real> m_cpl_exports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_exports_view_h;
+  bool                          m_cpl_exports_zero_copy;
 
   // Array storing the field names for exports
   name_t* m_export_field_names;
@@ -133,6 +136,10 @@ protected:
   view_1d<DefaultDevice, SurfaceCouplingColumnInfo> m_column_info_d;
   decltype(m_column_info_d)::HostMirror             m_column_info_h;
 
+  // For each cpl export, the index of the corresponding scream export (or -1 if
+  // scream does not export it), so that all the cpl data is set with one kernel
+  view_1d<DefaultDevice, int>                       m_cpl_to_scream_idx_d;
+
 }; // class SurfaceCouplingExporter
 
 } // namespace scream
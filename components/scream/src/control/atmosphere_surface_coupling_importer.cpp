@@ -68,8 +68,8 @@ void SurfaceCouplingImporter::set_grids(const std::shared_ptr<const GridsManager
   // The import data is of size ncols,num_cpl_imports. All other data is of size num_scream_imports
   m_cpl_imports_view_h = decltype(m_cpl_imports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_imports);
-  m_cpl_imports_view_d = Kokkos::create_mirror_view_and_copy(DefaultDevice(),
-                                                             m_cpl_imports_view_h);
+  m_cpl_imports_view_d = Kokkos::create_mirror_view(DefaultDevice(), m_cpl_imports_view_h);
+  m_cpl_imports_zero_copy = m_cpl_imports_view_d.data()==m_cpl_imports_view_h.data();
   m_import_field_names = new name_t[m_num_scream_imports];
   std::memcpy(m_import_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_imports*32*sizeof(char));
 
@@ -147,14 +147,20 @@ void SurfaceCouplingImporter::do_import(const bool called_during_initialization)
   const int  num_cols           = m_num_cols;
   const int  num_imports        = m_num_scream_imports;
 
-  // Deep copy cpl host array to devic
-  Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
+  // Deep copy cpl host array to device (unless the device can use the host array directly)
+  if (not m_cpl_imports_zero_copy) {
+    Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
+  }
 
-  // Unpack the fields
+  // Unpack the fields. On GPU, consecutive threads handle consecutive columns of the
+  // same field (so that writes to the fields are coalesced). On CPU, each thread
+  // handles consecutive fields of the same column (so that reads from the cpl
+  // array, where the field idx strides faster, stay in cache).
+  constexpr bool on_gpu = ekat::OnGpu<KokkosTypes<DefaultDevice>::ExeSpace>::value;
   auto unpack_policy = policy_type(0,num_imports*num_cols);
   Kokkos::parallel_for(unpack_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
+    const int ifield = on_gpu ? i / num_cols : i % num_imports;
+    const int icol   = on_gpu ? i % num_cols : i / num_imports;
 
     const auto& info = col_info(ifield);
 
@@ -77,8 +77,11 @@ protected:
   // Views storing a 2d array with dims (num_cols,num_fields) for import data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
   // pointer to the whole x2a array from Fortran)
+  // Note: if the default device can access host memory, the device view is the host
+  //       view itself, and no copy is needed (m_cpl_imports_zero_copy=true).
   view_2d <DefaultDevice, Real> m_cpl_imports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_imports_view_h;
+  bool                          m_cpl_imports_zero_copy;
 
   // Array storing the field names for imports
   name_t* m_import_field_names;
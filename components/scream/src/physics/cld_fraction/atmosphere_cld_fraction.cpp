@@ -70,7 +70,7 @@ void CldFraction::run_impl (const int /* dt */)
   auto ice_cld_frac = get_field_out("cldfrac_ice").get_view<Pack**>();
   auto tot_cld_frac = get_field_out("cldfrac_tot").get_view<Pack**>();
 
-  CldFractionFunc::main(m_num_cols,m_num_levs,qi,liq_cld_frac,ice_cld_frac,tot_cld_frac);
+  CldFractionFunc::main(m_num_cols,m_num_levs,qi,liq_cld_frac,ice_cld_frac,tot_cld_frac,exec_space());
 }
 
 // =========================================================================================
@@ -37,6 +37,10 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
+  // Inputs (qi, cldfrac_liq) and outputs (cldfrac_ice, cldfrac_tot) do not
+  // overlap, and run_impl only launches one kernel, on exec_space()
+  bool supports_concurrent_run () const { return true; }
+
 protected:
 
   // The three main overrides for the subcomponent
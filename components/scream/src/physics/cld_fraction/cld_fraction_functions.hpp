@@ -32,6 +32,7 @@ struct CldFractionFunctions
   using Smask = ekat::Mask<SmallPack<Scalar>::n>;
 
   using KT = KokkosTypes<Device>;
+  using ExeSpace = typename KT::ExeSpace;
   using MemberType = typename KT::MemberType;
 
   template <typename S>
@@ -47,7 +48,8 @@ struct CldFractionFunctions
     const view_2d<const Pack>& qi, 
     const view_2d<const Pack>& liq_cld_frac, 
     const view_2d<Pack>& ice_cld_frac, 
-    const view_2d<Pack>& tot_cld_frac);
+    const view_2d<Pack>& tot_cld_frac,
+    const ExeSpace& space = ExeSpace());
 
   KOKKOS_FUNCTION
   static void calc_icefrac( 
@@ -16,14 +16,15 @@ void CldFractionFunctions<S,D>
   const view_2d<const Spack>& qi,
   const view_2d<const Spack>& liq_cld_frac,
   const view_2d<Spack>& ice_cld_frac,
-  const view_2d<Spack>& tot_cld_frac)
+  const view_2d<Spack>& tot_cld_frac,
+  const ExeSpace& space)
 {
-  using ExeSpace = typename KT::ExeSpace;
+  using TeamPolicy = typename KT::TeamPolicy;
   const Int nk_pack = ekat::npack<Spack>(nk);
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
   Kokkos::parallel_for(
     "cld fraction main loop",
-    policy,
+    TeamPolicy(space,policy.league_size(),policy.team_size()),
     KOKKOS_LAMBDA(const MemberType& team) {
 
     const Int i = team.league_rank();
@@ -37,7 +38,7 @@ void CldFractionFunctions<S,D>
 
     calc_totalfrac(team,nk,oliq_cld_frac,oice_cld_frac,otot_cld_frac);
   });
-  Kokkos::fence();
+  space.fence();
 } // main
 /*-----------------------------------------------------------------*/
 template <typename S, typename D>
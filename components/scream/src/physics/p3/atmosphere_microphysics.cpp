@@ -47,6 +47,7 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
   infrastructure.kte = m_num_levs-1;
   infrastructure.predictNc = m_params.get<bool>("do_predict_nc",true); 
   infrastructure.prescribedCCN = m_params.get<bool>("do_prescribed_ccn",true); 
+  infrastructure.skip_inactive_columns = m_params.get<bool>("skip_inactive_columns",false);
 
   // Define the different field layouts that will be used for this process
   using namespace ShortFieldTagsNames;
@@ -132,7 +133,7 @@ size_t P3Microphysics::requested_buffer_size_in_bytes() const
 
   // Number of Reals needed by the WorkspaceManager passed to p3_main
   const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
-  const size_t wsm_request   = WSM::get_total_bytes_needed(nk_pack_p1, 52, policy);
+  const size_t wsm_request   = WSM::get_total_bytes_needed(nk_pack_p1, 55, policy);
 
   return interface_request + wsm_request;
 }
@@ -189,7 +190,7 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
   // Compute workspace manager size to check used memory
   // vs. requested memory
   const auto policy  = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
-  const int wsm_size = WSM::get_total_bytes_needed(nk_pack_p1, 52, policy)/sizeof(Spack);
+  const int wsm_size = WSM::get_total_bytes_needed(nk_pack_p1, 55, policy)/sizeof(Spack);
   s_mem += wsm_size;
 
   size_t used_mem = (reinterpret_cast<Real*>(s_mem) - buffer_manager.get_memory())*sizeof(Real);
@@ -319,14 +320,14 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   }
 
   // Load tables
-  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  P3F::init_kokkos_ice_lookup_tables(m_comm, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
   P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
                           lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
                           lookup_tables.dnu_table_vals);
 
   // Setup WSM for internal local variables
   const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
-  workspace_mgr.setup(m_buffer.wsm_data, nk_pack_p1, 52, policy);
+  workspace_mgr.setup(m_buffer.wsm_data, nk_pack_p1, 55, policy);
 }
 
 // =========================================================================================
@@ -7,6 +7,9 @@
 
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <vector>
 
 namespace scream {
 namespace p3 {
@@ -48,6 +51,11 @@ struct Functions
     static constexpr const char* p3_lookup_base = SCREAM_DATA_DIR "/tables/p3_lookup_table_1.dat-v";
 
     static constexpr const char* p3_version = "4.1.1"; // TODO: Change this so that the table version and table path is a runtime option.
+
+    // Binary cache of the ice lookup table, generated by p3_tables_setup. If present,
+    // it is read instead of the text table (see init_kokkos_ice_lookup_tables).
+    static constexpr const char* p3_lookup_bin_suffix = ".bin";
+    static constexpr int p3_lookup_bin_format = 1;
   };
 
   //
@@ -205,6 +213,10 @@ struct Functions
     bool prescribedCCN;
     // Coordinates of columns, nj x 3
     view_2d<const Scalar> col_location;
+    // If true, columns where neither hydrometeors nor ice nucleation are possible
+    // only get the trivial update (mass clipping and default diagnostics), rather
+    // than going through the full column code. Results are the same.
+    bool skip_inactive_columns = false;
   };
 
   // This struct stores tendencies computed by P3 and used by other
@@ -262,6 +274,25 @@ struct Functions
   static void init_kokkos_ice_lookup_tables(
     view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
 
+  // Same as above, but only one rank per node reads the tables from file,
+  // and broadcasts them to the other ranks on the same node.
+  static void init_kokkos_ice_lookup_tables(const ekat::Comm& comm,
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
+
+  // Host-only I/O routines for the ice lookup tables. The tables are stored
+  // in double precision, in the same layout as view_ice_table/view_collect_table,
+  // with log10 already applied to the collection entries.
+  // read_ice_lookup_tables_binary returns false if the file does not exist.
+  // read_ice_lookup_tables reads the binary cache if present, and the text file otherwise.
+  static void read_ice_lookup_tables(
+    std::vector<double>& ice_table_vals, std::vector<double>& collect_table_vals);
+  static void read_ice_lookup_tables_text(const std::string& filename,
+    std::vector<double>& ice_table_vals, std::vector<double>& collect_table_vals);
+  static bool read_ice_lookup_tables_binary(const std::string& filename,
+    std::vector<double>& ice_table_vals, std::vector<double>& collect_table_vals);
+  static void write_ice_lookup_tables_binary(const std::string& filename,
+    const std::vector<double>& ice_table_vals, const std::vector<double>& collect_table_vals);
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack& mu_r, const Spack& lamr,
@@ -776,6 +807,9 @@ struct Functions
     const uview_1d<Spack>& T_atm,
     const uview_1d<Spack>& qv,
     const uview_1d<Spack>& inv_dz,
+    const uview_1d<Spack>& latent_heat_vapor,
+    const uview_1d<Spack>& latent_heat_sublim,
+    const uview_1d<Spack>& latent_heat_fusion,
     Scalar& precip_liq_surf,
     Scalar& precip_ice_surf,
     view_1d_ptr_array<Spack, 36>& zero_init);
@@ -961,6 +995,47 @@ struct Functions
     Int nj, // number of columns
     Int nk); // number of vertical cells per column
 
+  // Used by p3_main if skip_inactive_columns is set. Returns false if p3_main_part1
+  // can set neither nucleationPossible nor hydrometeorsPresent for this column.
+  KOKKOS_FUNCTION
+  static bool is_column_active(
+    const MemberType& team,
+    const Int& nk,
+    const uview_1d<const Spack>& pres,
+    const uview_1d<const Spack>& inv_exner,
+    const uview_1d<const Spack>& th_atm,
+    const uview_1d<const Spack>& qv,
+    const uview_1d<const Spack>& qc,
+    const uview_1d<const Spack>& qr,
+    const uview_1d<const Spack>& qi);
+
+  // The update p3_main does for an inactive column: the diagnostics set by
+  // p3_main_init, and the mass clipping done by p3_main_part1.
+  KOKKOS_FUNCTION
+  static void p3_main_inactive_column(
+    const MemberType& team,
+    const Int& nk,
+    const uview_1d<const Spack>& pres,
+    const uview_1d<const Spack>& inv_exner,
+    const uview_1d<Spack>& th_atm,
+    const uview_1d<Spack>& qv,
+    const uview_1d<Spack>& qc,
+    const uview_1d<Spack>& nc,
+    const uview_1d<Spack>& qr,
+    const uview_1d<Spack>& nr,
+    const uview_1d<Spack>& qi,
+    const uview_1d<Spack>& ni,
+    const uview_1d<Spack>& qm,
+    const uview_1d<Spack>& bm,
+    const uview_1d<Spack>& diag_eff_radius_qc,
+    const uview_1d<Spack>& diag_eff_radius_qi,
+    const uview_1d<Spack>& rho_qi,
+    const uview_1d<Spack>& qv2qi_depos_tend,
+    const uview_1d<Spack>& precip_liq_flux,
+    const uview_1d<Spack>& precip_ice_flux,
+    Scalar& precip_liq_surf,
+    Scalar& precip_ice_surf);
+
   KOKKOS_FUNCTION
   static void ice_supersat_conservation(Spack& qidep, Spack& qinuc, const Spack& cld_frac_i, const Spack& qv, const Spack& qv_sat_i, const Spack& latent_heat_sublim, const Spack& t_atm, const Real& dt, const Spack& qi2qv_sublim_tend, const Spack& qr2qv_evap_tend, const Smask& context = Smask(true));
 
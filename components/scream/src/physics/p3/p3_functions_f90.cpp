@@ -2063,7 +2063,7 @@ Int p3_main_f(
   // Create local workspace
   const Int nk_pack = ekat::npack<Spack>(nk);
   const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(nj, nk_pack);
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nk_pack, 52, policy);
+  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nk_pack, 55, policy);
 
   auto elapsed_microsec = P3F::p3_main(prog_state, diag_inputs, diag_outputs, infrastructure,
                                        history_only, lookup_tables, workspace_mgr, nj, nk);
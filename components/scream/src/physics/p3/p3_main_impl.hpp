@@ -39,10 +39,16 @@ void Functions<S,D>
   const uview_1d<Spack>& T_atm,
   const uview_1d<Spack>& qv,
   const uview_1d<Spack>& inv_dz,
+  const uview_1d<Spack>& latent_heat_vapor,
+  const uview_1d<Spack>& latent_heat_sublim,
+  const uview_1d<Spack>& latent_heat_fusion,
   Scalar& precip_liq_surf,
   Scalar& precip_ice_surf,
   view_1d_ptr_array<Spack, 36>& zero_init)
 {
+  constexpr Scalar latvap = C::LatVap;
+  constexpr Scalar latice = C::LatIce;
+
   precip_liq_surf = 0;
   precip_ice_surf = 0;
 
@@ -61,6 +67,9 @@ void Functions<S,D>
     T_atm(k)                 = th_atm(k) * exner(k);
     qv(k)                = max(qv(k), 0);
     inv_dz(k)            = 1 / dz(k);
+    latent_heat_vapor(k)  = latvap;
+    latent_heat_sublim(k) = latvap + latice;
+    latent_heat_fusion(k) = latice;
 
     for (size_t j = 0; j < zero_init.size(); ++j) {
       (*zero_init[j])(k) = 0;
@@ -69,6 +78,144 @@ void Functions<S,D>
   team.team_barrier();
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+bool Functions<S,D>
+::is_column_active(
+  const MemberType& team,
+  const Int& nk,
+  const uview_1d<const Spack>& pres,
+  const uview_1d<const Spack>& inv_exner,
+  const uview_1d<const Spack>& th_atm,
+  const uview_1d<const Spack>& qv,
+  const uview_1d<const Spack>& qc,
+  const uview_1d<const Spack>& qr,
+  const uview_1d<const Spack>& qi)
+{
+  using physics = scream::physics::Functions<Scalar, Device>;
+
+  constexpr Scalar T_zerodegc = C::T_zerodegc;
+  constexpr Scalar qsmall     = C::QSMALL;
+
+  const Int nk_pack = ekat::npack<Spack>(nk);
+
+  // The nucleation test mirrors the one in p3_main_part1 exactly (with T_atm and
+  // qv as set by p3_main_init), while the hydrometeor one is a superset of it,
+  // so that no active column is ever skipped.
+  Int num_active_packs = 0;
+  Kokkos::parallel_reduce(
+    Kokkos::TeamThreadRange(team, nk_pack), [&] (Int k, Int& active) {
+
+    const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+    const auto range_mask = range_pack < nk;
+
+    const Spack exner = 1 / inv_exner(k);
+    const Spack T_atm = th_atm(k) * exner;
+    const Spack qv_supersat_i = max(qv(k), 0) / physics::qv_sat(T_atm, pres(k), true, range_mask) - 1;
+    if ( (T_atm < T_zerodegc && qv_supersat_i >= -0.05).any() ) {
+      ++active;
+    } else if ( ((!(qc(k) < qsmall) || !(qr(k) < qsmall) || !(qi(k) < qsmall)) && range_mask).any() ) {
+      ++active;
+    }
+  }, num_active_packs);
+
+  return num_active_packs>0;
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::p3_main_inactive_column(
+  const MemberType& team,
+  const Int& nk,
+  const uview_1d<const Spack>& pres,
+  const uview_1d<const Spack>& inv_exner,
+  const uview_1d<Spack>& th_atm,
+  const uview_1d<Spack>& qv,
+  const uview_1d<Spack>& qc,
+  const uview_1d<Spack>& nc,
+  const uview_1d<Spack>& qr,
+  const uview_1d<Spack>& nr,
+  const uview_1d<Spack>& qi,
+  const uview_1d<Spack>& ni,
+  const uview_1d<Spack>& qm,
+  const uview_1d<Spack>& bm,
+  const uview_1d<Spack>& diag_eff_radius_qc,
+  const uview_1d<Spack>& diag_eff_radius_qi,
+  const uview_1d<Spack>& rho_qi,
+  const uview_1d<Spack>& qv2qi_depos_tend,
+  const uview_1d<Spack>& precip_liq_flux,
+  const uview_1d<Spack>& precip_ice_flux,
+  Scalar& precip_liq_surf,
+  Scalar& precip_ice_surf)
+{
+  using physics = scream::physics::Functions<Scalar, Device>;
+
+  constexpr Scalar latvap     = C::LatVap;
+  constexpr Scalar latice     = C::LatIce;
+  constexpr Scalar T_zerodegc = C::T_zerodegc;
+  constexpr Scalar qsmall     = C::QSMALL;
+  constexpr Scalar inv_cp     = C::INV_CP;
+
+  const Int nk_pack = ekat::npack<Spack>(nk);
+
+  precip_liq_surf = 0;
+  precip_ice_surf = 0;
+
+  // Same operations (and order) as p3_main_init and p3_main_part1, so that
+  // results are bfb with the full column code.
+  Kokkos::parallel_for(
+    Kokkos::TeamThreadRange(team, nk_pack), [&] (Int k) {
+
+    const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+    const auto range_mask = range_pack < nk;
+
+    // From p3_main_init
+    diag_eff_radius_qc(k) = 10.e-6;
+    diag_eff_radius_qi(k) = 25.e-6;
+    rho_qi(k)             = 0;
+    qv2qi_depos_tend(k)   = 0;
+    precip_liq_flux(k)    = 0;
+    precip_ice_flux(k)    = 0;
+
+    const Spack exner = 1 / inv_exner(k);
+    const Spack T_atm = th_atm(k) * exner;
+    qv(k) = max(qv(k), 0);
+
+    // From p3_main_part1
+    const Spack qv_supersat_i = qv(k) / physics::qv_sat(T_atm, pres(k), true, range_mask) - 1;
+
+    auto drymass = qc(k) < qsmall;
+    qv(k).set(drymass, qv(k) + qc(k));
+    th_atm(k).set(drymass, th_atm(k) - inv_exner(k) * qc(k) * latvap * inv_cp);
+    qc(k).set(drymass, 0);
+    nc(k).set(drymass, 0);
+
+    drymass = qr(k) < qsmall;
+    qv(k).set(drymass, qv(k) + qr(k));
+    th_atm(k).set(drymass, th_atm(k) - inv_exner(k) * qr(k) * latvap * inv_cp);
+    qr(k).set(drymass, 0);
+    nr(k).set(drymass, 0);
+
+    drymass = (qi(k) < qsmall || (qi(k) < 1.e-8 && qv_supersat_i < -0.1));
+    qv(k).set(drymass, qv(k) + qi(k));
+    th_atm(k).set(drymass, th_atm(k) - inv_exner(k) * qi(k) * (latvap + latice) * inv_cp);
+    qi(k).set(drymass, 0);
+    ni(k).set(drymass, 0);
+    qm(k).set(drymass, 0);
+    bm(k).set(drymass, 0);
+
+    drymass = (qi(k) >= qsmall && qi(k) < 1.e-8 && T_atm >= T_zerodegc);
+    qr(k).set(drymass, qr(k) + qi(k));
+    th_atm(k).set(drymass, th_atm(k) - inv_exner(k) * qi(k) * latice * inv_cp);
+    qi(k).set(drymass, 0);
+    ni(k).set(drymass, 0);
+    qm(k).set(drymass, 0);
+    bm(k).set(drymass, 0);
+  });
+  team.team_barrier();
+}
+
 template <typename S, typename D>
 Int Functions<S,D>
 ::p3_main(
@@ -84,12 +231,13 @@ Int Functions<S,D>
 {
   using ExeSpace = typename KT::ExeSpace;
 
-  view_2d<Spack> latent_heat_sublim("latent_heat_sublim", nj, nk), latent_heat_vapor("latent_heat_vapor", nj, nk), latent_heat_fusion("latent_heat_fusion", nj, nk);
-
-  get_latent_heat(nj, nk, latent_heat_vapor, latent_heat_sublim, latent_heat_fusion);
+  // per-column bools, shared by all threads in a team. They live in team
+  // scratch memory, so that p3_main does not allocate at every call
+  using ScratchBools = Kokkos::View<bool*, typename ExeSpace::scratch_memory_space, Kokkos::MemoryUnmanaged>;
 
   const Int nk_pack = ekat::npack<Spack>(nk);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+  auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+  policy.set_scratch_size(0, Kokkos::PerTeam(ScratchBools::shmem_size(2)));
 
   // load constants into local vars
   const     Scalar inv_dt          = 1 / infrastructure.dt;
@@ -98,9 +246,6 @@ Int Functions<S,D>
   const     Int    kbot         = kdir == -1 ? nk-1 : 0;
   constexpr bool   debug_ABORT  = false;
 
-  // per-column bools
-  view_2d<bool> bools("bools", nj, 2);
-
   // we do not want to measure init stuff
   auto start = std::chrono::steady_clock::now();
 
@@ -112,6 +257,34 @@ Int Functions<S,D>
 
     const Int i = team.league_rank();
 
+    // Columns with no possible microphysics only need a trivial update
+    if (infrastructure.skip_inactive_columns &&
+        !is_column_active(team, nk,
+                          ekat::subview(diagnostic_inputs.pres, i),
+                          ekat::subview(diagnostic_inputs.inv_exner, i),
+                          ekat::subview(prognostic_state.th, i),
+                          ekat::subview(prognostic_state.qv, i),
+                          ekat::subview(prognostic_state.qc, i),
+                          ekat::subview(prognostic_state.qr, i),
+                          ekat::subview(prognostic_state.qi, i))) {
+      p3_main_inactive_column(
+        team, nk,
+        ekat::subview(diagnostic_inputs.pres, i), ekat::subview(diagnostic_inputs.inv_exner, i),
+        ekat::subview(prognostic_state.th, i), ekat::subview(prognostic_state.qv, i),
+        ekat::subview(prognostic_state.qc, i), ekat::subview(prognostic_state.nc, i),
+        ekat::subview(prognostic_state.qr, i), ekat::subview(prognostic_state.nr, i),
+        ekat::subview(prognostic_state.qi, i), ekat::subview(prognostic_state.ni, i),
+        ekat::subview(prognostic_state.qm, i), ekat::subview(prognostic_state.bm, i),
+        ekat::subview(diagnostic_outputs.diag_eff_radius_qc, i),
+        ekat::subview(diagnostic_outputs.diag_eff_radius_qi, i),
+        ekat::subview(diagnostic_outputs.rho_qi, i),
+        ekat::subview(diagnostic_outputs.qv2qi_depos_tend, i),
+        ekat::subview(diagnostic_outputs.precip_liq_flux, i),
+        ekat::subview(diagnostic_outputs.precip_ice_flux, i),
+        diagnostic_outputs.precip_liq_surf(i), diagnostic_outputs.precip_ice_surf(i));
+      return;
+    }
+
     auto workspace = workspace_mgr.get_workspace(team);
 
     //
@@ -134,13 +307,16 @@ Int Functions<S,D>
       rhofacr, rhofaci, acn, qv_sat_l, qv_sat_i, sup, qv_supersat_i,
       tmparr1, exner, diag_equiv_reflectivity, diag_vm_qi, diag_diam_qi, pratot, prctot,
 
+      // Latent heats, constant in this version of p3
+      latent_heat_vapor, latent_heat_sublim, latent_heat_fusion,
+
       // p3_tend_out, may not need these
       qtend_ignore, ntend_ignore,
 
       // Variables still used in F90 but removed from C++ interface
       mu_c, lamc, precip_total_tend, nevapr, qr_evap_tend;
 
-    workspace.template take_many_and_reset<46>(
+    workspace.template take_many_and_reset<49>(
       {
         "mu_r", "T_atm", "lamr", "logn0r", "nu", "cdist", "cdist1", "cdistr",
         "inv_cld_frac_i", "inv_cld_frac_l", "inv_cld_frac_r", "qc_incld", "qr_incld", "qi_incld", "qm_incld",
@@ -148,7 +324,8 @@ Int Functions<S,D>
         "inv_dz", "inv_rho", "ze_ice", "ze_rain", "prec", "rho",
         "rhofacr", "rhofaci", "acn", "qv_sat_l", "qv_sat_i", "sup", "qv_supersat_i",
         "tmparr1", "exner", "diag_equiv_reflectivity", "diag_vm_qi", "diag_diam_qi",
-        "pratot", "prctot", "qtend_ignore", "ntend_ignore",
+        "pratot", "prctot", "latent_heat_vapor", "latent_heat_sublim", "latent_heat_fusion",
+        "qtend_ignore", "ntend_ignore",
         "mu_c", "lamc", "precip_total_tend", "nevapr", "qr_evap_tend"
       },
       {
@@ -158,7 +335,8 @@ Int Functions<S,D>
         &inv_dz, &inv_rho, &ze_ice, &ze_rain, &prec, &rho,
         &rhofacr, &rhofaci, &acn, &qv_sat_l, &qv_sat_i, &sup, &qv_supersat_i,
         &tmparr1, &exner, &diag_equiv_reflectivity, &diag_vm_qi, &diag_diam_qi,
-        &pratot, &prctot, &qtend_ignore, &ntend_ignore, 
+        &pratot, &prctot, &latent_heat_vapor, &latent_heat_sublim, &latent_heat_fusion,
+        &qtend_ignore, &ntend_ignore,
         &mu_c, &lamc, &precip_total_tend, &nevapr, &qr_evap_tend
       });
       
@@ -195,15 +373,13 @@ Int Functions<S,D>
     const auto oliq_ice_exchange   = ekat::subview(history_only.liq_ice_exchange, i);
     const auto ovap_liq_exchange   = ekat::subview(history_only.vap_liq_exchange, i);
     const auto ovap_ice_exchange   = ekat::subview(history_only.vap_ice_exchange, i);
-    const auto olatent_heat_vapor  = ekat::subview(latent_heat_vapor, i);
-    const auto olatent_heat_sublim = ekat::subview(latent_heat_sublim, i);
-    const auto olatent_heat_fusion = ekat::subview(latent_heat_fusion, i);
     const auto oqv_prev            = ekat::subview(diagnostic_inputs.qv_prev, i);
     const auto ot_prev             = ekat::subview(diagnostic_inputs.t_prev, i);
 
     // Need to watch out for race conditions with these shared variables
-    bool &nucleationPossible  = bools(i, 0);
-    bool &hydrometeorsPresent = bools(i, 1);
+    ScratchBools bools(team.team_scratch(0), 2);
+    bool &nucleationPossible  = bools(0);
+    bool &hydrometeorsPresent = bools(1);
 
     view_1d_ptr_array<Spack, 36> zero_init = {
       &mu_r, &lamr, &logn0r, &nu, &cdist, &cdist1, &cdistr,
@@ -220,12 +396,13 @@ Int Functions<S,D>
       ocld_frac_i, ocld_frac_l, ocld_frac_r, oinv_exner, oth, odz, diag_equiv_reflectivity,
       ze_ice, ze_rain, odiag_eff_radius_qc, odiag_eff_radius_qi, inv_cld_frac_i, inv_cld_frac_l,
       inv_cld_frac_r, exner, T_atm, oqv, inv_dz,
+      latent_heat_vapor, latent_heat_sublim, latent_heat_fusion,
       diagnostic_outputs.precip_liq_surf(i), diagnostic_outputs.precip_ice_surf(i), zero_init);
 
     p3_main_part1(
       team, nk, infrastructure.predictNc, infrastructure.prescribedCCN, infrastructure.dt,
       opres, odpres, odz, onc_nuceat_tend, onccn_prescribed, oinv_exner, exner, inv_cld_frac_l, inv_cld_frac_i,
-      inv_cld_frac_r, olatent_heat_vapor, olatent_heat_sublim, olatent_heat_fusion,
+      inv_cld_frac_r, latent_heat_vapor, latent_heat_sublim, latent_heat_fusion,
       T_atm, rho, inv_rho, qv_sat_l, qv_sat_i, qv_supersat_i, rhofacr,
       rhofaci, acn, oqv, oth, oqc, onc, oqr, onr, oqi, oni, oqm,
       obm, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld, nr_incld,
@@ -244,8 +421,8 @@ Int Functions<S,D>
       lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, lookup_tables.revap_table_vals, opres, odpres, odz, onc_nuceat_tend, oinv_exner,
       exner, inv_cld_frac_l, inv_cld_frac_i, inv_cld_frac_r, oni_activated, oinv_qc_relvar, ocld_frac_i,
       ocld_frac_l, ocld_frac_r, oqv_prev, ot_prev, T_atm, rho, inv_rho, qv_sat_l, qv_sat_i, qv_supersat_i, rhofacr, rhofaci, acn,
-      oqv, oth, oqc, onc, oqr, onr, oqi, oni, oqm, obm, olatent_heat_vapor,
-      olatent_heat_sublim, olatent_heat_fusion, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld,
+      oqv, oth, oqc, onc, oqr, onr, oqi, oni, oqm, obm, latent_heat_vapor,
+      latent_heat_sublim, latent_heat_fusion, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld,
       nr_incld, ni_incld, bm_incld, mu_c, nu, lamc, cdist, cdist1, cdistr,
       mu_r, lamr, logn0r, oqv2qi_depos_tend, precip_total_tend, nevapr, qr_evap_tend,
       ovap_liq_exchange, ovap_ice_exchange, oliq_ice_exchange,
@@ -288,7 +465,7 @@ Int Functions<S,D>
 
     // homogeneous freezing of cloud and rain
     homogeneous_freezing(
-      T_atm, oinv_exner, olatent_heat_fusion, team, nk, ktop, kbot, kdir, oqc, onc, oqr, onr, oqi,
+      T_atm, oinv_exner, latent_heat_fusion, team, nk, ktop, kbot, kdir, oqc, onc, oqr, onr, oqi,
       oni, oqm, obm, oth);
 
     //
@@ -298,7 +475,7 @@ Int Functions<S,D>
     p3_main_part3(
       team, nk_pack, lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, oinv_exner, ocld_frac_l, ocld_frac_r, ocld_frac_i,
       rho, inv_rho, rhofaci, oqv, oth, oqc, onc, oqr, onr, oqi, oni,
-      oqm, obm, olatent_heat_vapor, olatent_heat_sublim, mu_c, nu, lamc, mu_r, lamr,
+      oqm, obm, latent_heat_vapor, latent_heat_sublim, mu_c, nu, lamc, mu_r, lamr,
       ovap_liq_exchange, ze_rain, ze_ice, diag_vm_qi, odiag_eff_radius_qi, diag_diam_qi,
       orho_qi, diag_equiv_reflectivity, odiag_eff_radius_qc);
 
@@ -319,6 +496,7 @@ Int Functions<S,D>
     check_values(oqv, tmparr1, ktop, kbot, infrastructure.it, debug_ABORT, 900,
                  team, ocol_location);
 #endif
+
   });
   Kokkos::fence();
 
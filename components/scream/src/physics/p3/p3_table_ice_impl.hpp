@@ -3,6 +3,9 @@
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 
 namespace scream {
@@ -13,26 +16,80 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
-void Functions<S,D>
-::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+namespace p3_tables_impl {
 
-  using DeviceIcetable = typename view_ice_table::non_const_type;
-  using DeviceColtable = typename view_collect_table::non_const_type;
+// FNV-1a hash of the table entries, used to validate the binary cache
+inline std::uint64_t checksum (const std::vector<double>& ice_table_vals,
+                               const std::vector<double>& collect_table_vals)
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const auto* v : {&ice_table_vals, &collect_table_vals}) {
+    const auto bytes = reinterpret_cast<const unsigned char*>(v->data());
+    const auto nbytes = v->size()*sizeof(double);
+    for (size_t i=0; i<nbytes; ++i) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
 
-  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
-  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+// Header of the binary table file. It is followed by the ice table
+// entries and by the collection table entries (all doubles).
+struct BinaryHeader {
+  char          magic[8];
+  std::int32_t  format;
+  char          version[16];
+  std::int32_t  dims[6];
+  std::uint64_t checksum;
+};
+
+constexpr const char* magic = "P3TABLE";
+
+template <typename P3C>
+void fill_dims (std::int32_t (&dims)[6]) {
+  dims[0] = P3C::densize;
+  dims[1] = P3C::rimsize;
+  dims[2] = P3C::isize;
+  dims[3] = P3C::ice_table_size;
+  dims[4] = P3C::rcollsize;
+  dims[5] = P3C::collect_table_size;
+}
 
-  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
-  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+template <typename P3C, typename IceView, typename CollView>
+void copy_to_views (const std::vector<double>& ice, const std::vector<double>& coll,
+                    const IceView& ice_table_vals, const CollView& collect_table_vals)
+{
+  int ice_idx = 0, coll_idx = 0;
+  for (int jj = 0; jj < P3C::densize; ++jj) {
+    for (int ii = 0; ii < P3C::rimsize; ++ii) {
+      for (int i = 0; i < P3C::isize; ++i) {
+        for (int j = 0; j < P3C::ice_table_size; ++j) {
+          ice_table_vals(jj, ii, i, j) = ice[ice_idx++];
+        }
+        for (int j = 0; j < P3C::rcollsize; ++j) {
+          for (int k = 0; k < P3C::collect_table_size; ++k) {
+            collect_table_vals(jj, ii, i, j, k) = coll[coll_idx++];
+          }
+        }
+      }
+    }
+  }
+}
 
-  //
-  // read in ice microphysics table into host views
-  //
+} // namespace p3_tables_impl
 
-  std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+template <typename S, typename D>
+void Functions<S,D>
+::read_ice_lookup_tables_text(const std::string& filename,
+                              std::vector<double>& ice_table_vals,
+                              std::vector<double>& collect_table_vals)
+{
+  const int ice_size  = P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size;
+  const int coll_size = P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size;
 
   std::ifstream in(filename);
+  EKAT_REQUIRE_MSG(in.good(), "Error! Could not open P3 lookup table file " << filename << "\n");
 
   // read header
   std::string version, version_val;
@@ -40,17 +97,23 @@ void Functions<S,D>
   EKAT_REQUIRE_MSG(version == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
   EKAT_REQUIRE_MSG(version_val == P3C::p3_version, "Bad " << filename << ", expected version " << P3C::p3_version << ", but got " << version_val);
 
-  // read tables
+  ice_table_vals.clear();
+  collect_table_vals.clear();
+  ice_table_vals.reserve(ice_size);
+  collect_table_vals.reserve(coll_size);
+
+  // read tables. Within each (density,rime) block, the file lists the ice
+  // entries first, and then the collection entries, so each table is
+  // filled in its (row-major) storage order.
   double dum_s; int dum_i; // dum_s needs to be double to stream correctly
   for (int jj = 0; jj < P3C::densize; ++jj) {
     for (int ii = 0; ii < P3C::rimsize; ++ii) {
       for (int i = 0; i < P3C::isize; ++i) {
         in >> dum_i >> dum_i;
-        int j_idx = 0;
         for (int j = 0; j < 15; ++j) {
           in >> dum_s;
           if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
+            ice_table_vals.push_back(dum_s);
           }
         }
       }
@@ -58,17 +121,170 @@ void Functions<S,D>
       for (int i = 0; i < P3C::isize; ++i) {
         for (int j = 0; j < P3C::rcollsize; ++j) {
           in >> dum_i >> dum_i;
-          int k_idx = 0;
           for (int k = 0; k < 6; ++k) {
             in >> dum_s;
             if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+              collect_table_vals.push_back(std::log10(dum_s));
             }
           }
         }
       }
     }
   }
+  EKAT_REQUIRE_MSG(not in.fail(), "Error! Something went wrong while reading " << filename << "\n");
+}
+
+template <typename S, typename D>
+bool Functions<S,D>
+::read_ice_lookup_tables_binary(const std::string& filename,
+                                std::vector<double>& ice_table_vals,
+                                std::vector<double>& collect_table_vals)
+{
+  using namespace p3_tables_impl;
+
+  std::ifstream in(filename, std::ios::binary);
+  if (not in.good()) {
+    return false;
+  }
+
+  BinaryHeader header;
+  in.read(reinterpret_cast<char*>(&header), sizeof(BinaryHeader));
+
+  std::int32_t dims[6];
+  fill_dims<P3C>(dims);
+
+  const std::string regen_msg = "Please, re-generate it with p3_tables_setup, or remove it to use the text table.\n";
+  EKAT_REQUIRE_MSG(in.good() && std::strncmp(header.magic,magic,sizeof(header.magic))==0,
+      "Error! " << filename << " is not a P3 binary lookup table.\n" << regen_msg);
+  EKAT_REQUIRE_MSG(header.format == P3C::p3_lookup_bin_format,
+      "Error! Unsupported format " << header.format << " in " << filename
+      << " (expected " << P3C::p3_lookup_bin_format << ").\n" << regen_msg);
+  EKAT_REQUIRE_MSG(std::strncmp(header.version,P3C::p3_version,sizeof(header.version))==0,
+      "Error! Bad " << filename << ", expected version " << P3C::p3_version << ".\n" << regen_msg);
+  EKAT_REQUIRE_MSG(std::equal(dims,dims+6,header.dims),
+      "Error! Table dimensions in " << filename << " do not match the P3 ones.\n" << regen_msg);
+
+  ice_table_vals.resize(P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size);
+  collect_table_vals.resize(P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size);
+  in.read(reinterpret_cast<char*>(ice_table_vals.data()), ice_table_vals.size()*sizeof(double));
+  in.read(reinterpret_cast<char*>(collect_table_vals.data()), collect_table_vals.size()*sizeof(double));
+  EKAT_REQUIRE_MSG(in.good(), "Error! " << filename << " is truncated.\n" << regen_msg);
+
+  EKAT_REQUIRE_MSG(header.checksum == checksum(ice_table_vals,collect_table_vals),
+      "Error! Checksum mismatch in " << filename << ".\n" << regen_msg);
+
+  return true;
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::write_ice_lookup_tables_binary(const std::string& filename,
+                                 const std::vector<double>& ice_table_vals,
+                                 const std::vector<double>& collect_table_vals)
+{
+  using namespace p3_tables_impl;
+
+  EKAT_REQUIRE_MSG(ice_table_vals.size()==size_t(P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size) &&
+                   collect_table_vals.size()==size_t(P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size),
+      "Error! Input ice tables have the wrong size.\n");
+
+  BinaryHeader header;
+  std::memset(&header,0,sizeof(BinaryHeader));
+  std::strncpy(header.magic,magic,sizeof(header.magic));
+  std::strncpy(header.version,P3C::p3_version,sizeof(header.version)-1);
+  header.format = P3C::p3_lookup_bin_format;
+  fill_dims<P3C>(header.dims);
+  header.checksum = checksum(ice_table_vals,collect_table_vals);
+
+  std::ofstream out(filename, std::ios::binary);
+  EKAT_REQUIRE_MSG(out.good(), "Error! Could not open " << filename << " for writing.\n");
+  out.write(reinterpret_cast<const char*>(&header), sizeof(BinaryHeader));
+  out.write(reinterpret_cast<const char*>(ice_table_vals.data()), ice_table_vals.size()*sizeof(double));
+  out.write(reinterpret_cast<const char*>(collect_table_vals.data()), collect_table_vals.size()*sizeof(double));
+  EKAT_REQUIRE_MSG(out.good(), "Error! Something went wrong while writing " << filename << "\n");
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::read_ice_lookup_tables(std::vector<double>& ice_table_vals,
+                         std::vector<double>& collect_table_vals)
+{
+  const std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+  if (not read_ice_lookup_tables_binary(filename + P3C::p3_lookup_bin_suffix,ice_table_vals,collect_table_vals)) {
+    read_ice_lookup_tables_text(filename,ice_table_vals,collect_table_vals);
+  }
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+
+  using DeviceIcetable = typename view_ice_table::non_const_type;
+  using DeviceColtable = typename view_collect_table::non_const_type;
+
+  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
+  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+
+  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+
+  //
+  // read in ice microphysics table into host views
+  //
+
+  std::vector<double> ice, coll;
+  read_ice_lookup_tables(ice,coll);
+
+  p3_tables_impl::copy_to_views<P3C>(ice,coll,ice_table_vals_h,collect_table_vals_h);
+
+  // deep copy to device
+  Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
+  Kokkos::deep_copy(collect_table_vals_d, collect_table_vals_h);
+  ice_table_vals    = ice_table_vals_d;
+  collect_table_vals = collect_table_vals_d;
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(const ekat::Comm& comm,
+                                view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+
+  using DeviceIcetable = typename view_ice_table::non_const_type;
+  using DeviceColtable = typename view_collect_table::non_const_type;
+
+  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
+  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+
+  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+
+  // Only one rank per node hits the file system
+  MPI_Comm mpi_node_comm;
+  MPI_Comm_split_type(comm.mpi_comm(),MPI_COMM_TYPE_SHARED,comm.rank(),MPI_INFO_NULL,&mpi_node_comm);
+  ekat::Comm node_comm(mpi_node_comm);
+
+  std::vector<double> ice (ice_table_vals_h.size());
+  std::vector<double> coll (collect_table_vals_h.size());
+  int success = 1;
+  std::string err_msg;
+  if (node_comm.am_i_root()) {
+    // Don't throw yet, or the other ranks will hang in the broadcast
+    try {
+      read_ice_lookup_tables(ice,coll);
+    } catch (std::exception& e) {
+      success = 0;
+      err_msg = e.what();
+    }
+  }
+  node_comm.broadcast(&success,1,node_comm.root_rank());
+  EKAT_REQUIRE_MSG(success==1,
+      "Error! Could not read P3 ice lookup tables on node root rank.\n" << err_msg);
+
+  node_comm.broadcast(ice.data(),ice.size(),node_comm.root_rank());
+  node_comm.broadcast(coll.data(),coll.size(),node_comm.root_rank());
+  MPI_Comm_free(&mpi_node_comm);
+
+  p3_tables_impl::copy_to_views<P3C>(ice,coll,ice_table_vals_h,collect_table_vals_h);
 
   // deep copy to device
   Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
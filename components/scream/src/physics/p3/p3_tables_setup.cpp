@@ -1,8 +1,17 @@
-// This is a tiny program that calls p3_init() to generate tables used by p3
+// This is a tiny program that calls p3_init() to generate tables used by p3,
+// and writes the binary cache of the ice lookup table
 
 #include "physics/p3/p3_f90.hpp"
+#include "physics/p3/p3_functions.hpp"
 
 int main(int /* argc */, char** /* argv */) {
+  using P3F = scream::p3::Functions<scream::Real,scream::DefaultDevice>;
+
   scream::p3::p3_init(/* write_tables = */ true);
+
+  const std::string filename = std::string(P3F::P3C::p3_lookup_base) + P3F::P3C::p3_version;
+  std::vector<double> ice_table_vals, collect_table_vals;
+  P3F::read_ice_lookup_tables_text(filename, ice_table_vals, collect_table_vals);
+  P3F::write_ice_lookup_tables_binary(filename + P3F::P3C::p3_lookup_bin_suffix, ice_table_vals, collect_table_vals);
   return 0;
 }
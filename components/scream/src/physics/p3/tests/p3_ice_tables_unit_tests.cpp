@@ -8,7 +8,10 @@
 
 #include "p3_unit_tests_common.hpp"
 
+#include <cstdio>
+#include <fstream>
 #include <thread>
+#include <unistd.h>
 #include <array>
 #include <algorithm>
 #include <random>
@@ -61,6 +64,50 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
     }
   }
 
+  static void test_binary_lookup_tables()
+  {
+    using P3C = typename Functions::P3C;
+
+    // Read the text tables, write them in binary format, and read them back
+    const std::string text_file = std::string(P3C::p3_lookup_base) + P3C::p3_version;
+    // Note: tests with different thread counts may run concurrently in the same folder
+    const std::string bin_file  = "p3_lookup_table_1_test_" + std::to_string(getpid()) + ".bin";
+
+    std::vector<double> ice, coll, ice_bin, coll_bin;
+    Functions::read_ice_lookup_tables_text(text_file, ice, coll);
+    Functions::write_ice_lookup_tables_binary(bin_file, ice, coll);
+    REQUIRE(Functions::read_ice_lookup_tables_binary(bin_file, ice_bin, coll_bin));
+    REQUIRE(ice_bin == ice);
+    REQUIRE(coll_bin == coll);
+
+    // A missing file is not an error, while a corrupted one is
+    REQUIRE(not Functions::read_ice_lookup_tables_binary("missing_p3_table.bin", ice_bin, coll_bin));
+    {
+      std::fstream f(bin_file, std::ios::binary | std::ios::in | std::ios::out);
+      f.seekp(-1, std::ios::end);
+      f.put(char(0x7f));
+    }
+    REQUIRE_THROWS(Functions::read_ice_lookup_tables_binary(bin_file, ice_bin, coll_bin));
+    std::remove(bin_file.c_str());
+
+    // Reading one rank per node gives the same tables
+    view_ice_table ice_table_vals, ice_table_vals_comm;
+    view_collect_table collect_table_vals, collect_table_vals_comm;
+    Functions::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals);
+    Functions::init_kokkos_ice_lookup_tables(ekat::Comm(MPI_COMM_WORLD), ice_table_vals_comm, collect_table_vals_comm);
+
+    const auto ice_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ice_table_vals);
+    const auto coll_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), collect_table_vals);
+    const auto ice_comm_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ice_table_vals_comm);
+    const auto coll_comm_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), collect_table_vals_comm);
+    for (size_t i = 0; i < ice_h.size(); ++i) {
+      REQUIRE(ice_h.data()[i] == ice_comm_h.data()[i]);
+    }
+    for (size_t i = 0; i < coll_h.size(); ++i) {
+      REQUIRE(coll_h.data()[i] == coll_comm_h.data()[i]);
+    }
+  }
+
   template <typename View>
   static void init_table_linear_dimension(View& table, int linear_dimension)
   {
@@ -346,6 +393,7 @@ TEST_CASE("p3_ice_tables", "[p3_functions]")
   using TTI = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestTableIce;
 
   TTI::test_read_lookup_tables_bfb();
+  TTI::test_binary_lookup_tables();
   TTI::run_phys();
   TTI::run_bfb();
 }
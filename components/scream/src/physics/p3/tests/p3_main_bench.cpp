@@ -0,0 +1,199 @@
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "physics/p3/p3_functions.hpp"
+#include "physics/p3/p3_f90.hpp"
+#include "physics/p3/p3_ic_cases.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <chrono>
+#include <vector>
+
+/*
+ * Microbenchmark for the per-call cost of p3_main, meant for small
+ * column counts per rank, where fixed per-call costs (allocations,
+ * extra kernel launches) are not negligible compared to the physics.
+ *
+ * Inputs are set once from the 'mixed' IC case, and the state is reset
+ * (outside of the timed region) before each call, so that every call
+ * does the same amount of work. Besides the time of a full p3_main call,
+ * it also reports the cost of the per-call temporaries that p3_main used
+ * to allocate (latent heats and per-column bools, plus the get_latent_heat
+ * launch), so that the two numbers can be compared on the same machine.
+ */
+
+namespace {
+
+using namespace scream;
+using namespace scream::p3;
+
+using P3F   = Functions<Real,DefaultDevice>;
+using Spack = P3F::Spack;
+using KT    = P3F::KT;
+
+using view_2d = P3F::view_2d<Spack>;
+
+view_2d to_device (const FortranData::Array2& a, const std::string& name, const Int nk_pack)
+{
+  view_2d v(name, a.extent(0), nk_pack);
+  auto v_h = Kokkos::create_mirror_view(v);
+  for (size_t i = 0; i < a.extent(0); ++i) {
+    for (size_t k = 0; k < a.extent(1); ++k) {
+      v_h(i, k / Spack::n)[k % Spack::n] = a(i, k);
+    }
+  }
+  Kokkos::deep_copy(v, v_h);
+  return v;
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+void run (const Int ncol, const Int nlev, const Int repeat, const bool skip_inactive)
+{
+  const Int nk_pack    = ekat::npack<Spack>(nlev);
+  const Int nk_pack_p1 = ekat::npack<Spack>(nlev+1);
+
+  p3_init();
+  auto d = ic::Factory::create(ic::Factory::mixed, ncol, nlev);
+
+  // Inputs
+  const auto pres            = to_device(d->pres, "pres", nk_pack);
+  const auto dz              = to_device(d->dz, "dz", nk_pack);
+  const auto nc_nuceat_tend  = to_device(d->nc_nuceat_tend, "nc_nuceat_tend", nk_pack);
+  const auto nccn_prescribed = to_device(d->nccn_prescribed, "nccn_prescribed", nk_pack);
+  const auto ni_activated    = to_device(d->ni_activated, "ni_activated", nk_pack);
+  const auto inv_qc_relvar   = to_device(d->inv_qc_relvar, "inv_qc_relvar", nk_pack);
+  const auto dpres           = to_device(d->dpres, "dpres", nk_pack);
+  const auto inv_exner       = to_device(d->inv_exner, "inv_exner", nk_pack);
+  const auto cld_frac_i      = to_device(d->cld_frac_i, "cld_frac_i", nk_pack);
+  const auto cld_frac_l      = to_device(d->cld_frac_l, "cld_frac_l", nk_pack);
+  const auto cld_frac_r      = to_device(d->cld_frac_r, "cld_frac_r", nk_pack);
+  const auto qv_prev         = to_device(d->qv_prev, "qv_prev", nk_pack);
+  const auto t_prev          = to_device(d->t_prev, "t_prev", nk_pack);
+
+  // State, and a pristine copy used to reset it before each call
+  std::vector<view_2d> state0 = {
+    to_device(d->qc, "qc", nk_pack), to_device(d->nc, "nc", nk_pack),
+    to_device(d->qr, "qr", nk_pack), to_device(d->nr, "nr", nk_pack),
+    to_device(d->qi, "qi", nk_pack), to_device(d->qm, "qm", nk_pack),
+    to_device(d->ni, "ni", nk_pack), to_device(d->bm, "bm", nk_pack),
+    to_device(d->qv, "qv", nk_pack), to_device(d->th_atm, "th_atm", nk_pack)
+  };
+  std::vector<view_2d> state;
+  for (const auto& v : state0) {
+    state.push_back(view_2d(v.label(), ncol, nk_pack));
+  }
+
+  // Outputs
+  view_2d qv2qi_depos_tend("qv2qi_depos_tend", ncol, nk_pack),
+          diag_eff_radius_qc("diag_eff_radius_qc", ncol, nk_pack),
+          diag_eff_radius_qi("diag_eff_radius_qi", ncol, nk_pack),
+          rho_qi("rho_qi", ncol, nk_pack),
+          precip_liq_flux("precip_liq_flux", ncol, nk_pack_p1),
+          precip_ice_flux("precip_ice_flux", ncol, nk_pack_p1),
+          liq_ice_exchange("liq_ice_exchange", ncol, nk_pack),
+          vap_liq_exchange("vap_liq_exchange", ncol, nk_pack),
+          vap_ice_exchange("vap_ice_exchange", ncol, nk_pack);
+  P3F::view_1d<Real> precip_liq_surf("precip_liq_surf", ncol), precip_ice_surf("precip_ice_surf", ncol);
+  P3F::view_2d<Real> col_location("col_location", ncol, 3);
+
+  P3F::P3PrognosticState prog_state{state[0], state[1], state[2], state[3], state[4],
+                                    state[5], state[6], state[7], state[8], state[9]};
+  P3F::P3DiagnosticInputs diag_inputs{nc_nuceat_tend, nccn_prescribed, ni_activated, inv_qc_relvar, cld_frac_i,
+                                      cld_frac_l, cld_frac_r, pres, dz, dpres,
+                                      inv_exner, qv_prev, t_prev};
+  P3F::P3DiagnosticOutputs diag_outputs{qv2qi_depos_tend, precip_liq_surf,
+                                        precip_ice_surf, diag_eff_radius_qc, diag_eff_radius_qi,
+                                        rho_qi, precip_liq_flux, precip_ice_flux};
+  P3F::P3Infrastructure infrastructure{300, 1, 1, ncol, 1, nlev, true, false, col_location};
+  infrastructure.skip_inactive_columns = skip_inactive;
+  P3F::P3HistoryOnly history_only{liq_ice_exchange, vap_liq_exchange, vap_ice_exchange};
+
+  P3F::P3LookupTables lookup_tables;
+  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
+                          lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
+                          lookup_tables.dnu_table_vals);
+
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(ncol, nk_pack);
+  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nk_pack_p1, 55, policy);
+
+  using clock = std::chrono::steady_clock;
+  double p3_main_usec = 0, temporaries_usec = 0;
+  for (Int r = 0; r < repeat+1; ++r) {
+    for (size_t n = 0; n < state.size(); ++n) {
+      Kokkos::deep_copy(state[n], state0[n]);
+    }
+    Kokkos::fence();
+
+    // p3_main fences before returning
+    auto start = clock::now();
+    P3F::p3_main(prog_state, diag_inputs, diag_outputs, infrastructure,
+                 history_only, lookup_tables, workspace_mgr, ncol, nlev);
+    auto finish = clock::now();
+
+    // The temporaries p3_main used to set up at every call
+    auto start_tmp = clock::now();
+    {
+      view_2d latent_heat_sublim("latent_heat_sublim", ncol, nlev),
+              latent_heat_vapor("latent_heat_vapor", ncol, nlev),
+              latent_heat_fusion("latent_heat_fusion", ncol, nlev);
+      P3F::get_latent_heat(ncol, nlev, latent_heat_vapor, latent_heat_sublim, latent_heat_fusion);
+      P3F::view_2d<bool> bools("bools", ncol, 2);
+      Kokkos::fence();
+    }
+    auto finish_tmp = clock::now();
+
+    // Skip the first call, which includes one-time costs
+    if (r > 0) {
+      p3_main_usec     += std::chrono::duration<double,std::micro>(finish-start).count();
+      temporaries_usec += std::chrono::duration<double,std::micro>(finish_tmp-start_tmp).count();
+    }
+  }
+
+  printf("p3_main_bench: ncol=%d, nlev=%d, repeat=%d, skip inactive columns=%s\n",
+         ncol, nlev, repeat, skip_inactive ? "yes" : "no");
+  printf("  p3_main, per call:                      %12.3f us\n", p3_main_usec/repeat);
+  printf("  removed per-call temporaries, per call: %12.3f us\n", temporaries_usec/repeat);
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  Int ncol = 4;
+  Int nlev = 72;
+  Int repeat = 100;
+  bool skip_inactive = false;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      ncol = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-k", "--nlev")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nlev = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-a", "--skip-inactive")) {
+      skip_inactive = true;
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      ++i;
+      repeat = std::atoi(argv[i]);
+    }
+  }
+  EKAT_REQUIRE_MSG(ncol > 0 && nlev > 0 && repeat > 0,
+      "Usage: " << argv[0] << " [-i <cols>] [-k <nlev>] [-r <repeat>] [-a]\n");
+
+  scream::initialize_scream_session(argc, argv); {
+    run(ncol, nlev, repeat, skip_inactive);
+  } scream::finalize_scream_session();
+
+  return 0;
+}
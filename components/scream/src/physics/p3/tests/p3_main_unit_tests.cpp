@@ -5,6 +5,8 @@
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
 #include "physics/p3/p3_functions.hpp"
 #include "physics/p3/p3_functions_f90.hpp"
+#include "physics/p3/p3_f90.hpp"
+#include "physics/p3/p3_ic_cases.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 
 #include "p3_unit_tests_common.hpp"
@@ -41,12 +43,132 @@ static void run_phys_p3_main()
   // TODO
 }
 
+static void run_phys_skip_inactive_columns()
+{
+  // Run p3_main on the same state with and without skip_inactive_columns,
+  // and check that results are identical. Columns are taken from the 'mixed'
+  // IC case; odd columns are made warm and free of hydrometeors (except for
+  // some sub-qsmall cloud liquid, which p3_main_part1 clips), so that they are
+  // inactive.
+  constexpr Int nj = 6, nk = 72;
+  const Int nk_pack    = ekat::npack<Spack>(nk);
+  const Int nk_pack_p1 = ekat::npack<Spack>(nk+1);
+
+  p3_init();
+  auto d = ic::Factory::create(ic::Factory::mixed, nj, nk);
+  for (Int i = 1; i < nj; i += 2) {
+    for (Int k = 0; k < nk; ++k) {
+      d->th_atm(i,k) = 300 * d->inv_exner(i,k);
+      d->qv(i,k) = 1e-6;
+      d->qc(i,k) = k == nk-1 ? C::QSMALL/2 : 0;
+      d->nc(i,k) = k == nk-1 ? 1e6 : 0;
+      d->qr(i,k) = d->nr(i,k) = 0;
+      d->qi(i,k) = d->ni(i,k) = d->qm(i,k) = d->bm(i,k) = 0;
+    }
+  }
+
+  auto to_device = [&] (const FortranData::Array2& a, const std::string& name) {
+    view_2d<Spack> v(name, nj, nk_pack);
+    auto v_h = Kokkos::create_mirror_view(v);
+    for (Int i = 0; i < nj; ++i) {
+      for (Int k = 0; k < nk; ++k) {
+        v_h(i, k / Spack::n)[k % Spack::n] = a(i, k);
+      }
+    }
+    Kokkos::deep_copy(v, v_h);
+    return v;
+  };
+
+  const auto pres            = to_device(d->pres, "pres");
+  const auto dz              = to_device(d->dz, "dz");
+  const auto nc_nuceat_tend  = to_device(d->nc_nuceat_tend, "nc_nuceat_tend");
+  const auto nccn_prescribed = to_device(d->nccn_prescribed, "nccn_prescribed");
+  const auto ni_activated    = to_device(d->ni_activated, "ni_activated");
+  const auto inv_qc_relvar   = to_device(d->inv_qc_relvar, "inv_qc_relvar");
+  const auto dpres           = to_device(d->dpres, "dpres");
+  const auto inv_exner       = to_device(d->inv_exner, "inv_exner");
+  const auto cld_frac_i      = to_device(d->cld_frac_i, "cld_frac_i");
+  const auto cld_frac_l      = to_device(d->cld_frac_l, "cld_frac_l");
+  const auto cld_frac_r      = to_device(d->cld_frac_r, "cld_frac_r");
+  const auto qv_prev         = to_device(d->qv_prev, "qv_prev");
+  const auto t_prev          = to_device(d->t_prev, "t_prev");
+
+  typename Functions::P3LookupTables lookup_tables;
+  Functions::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  Functions::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
+                                lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
+                                lookup_tables.dnu_table_vals);
+
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+  typename Functions::WorkspaceManager workspace_mgr(nk_pack_p1, 55, policy);
+
+  // All the views p3_main writes, for each of the two runs
+  std::vector<view_2d<Spack>> outputs[2];
+  view_1d<Scalar> precip_surf[2][2];
+  for (int skip : {0, 1}) {
+    auto& out = outputs[skip];
+    out = {
+      to_device(d->qc, "qc"), to_device(d->nc, "nc"), to_device(d->qr, "qr"), to_device(d->nr, "nr"),
+      to_device(d->qi, "qi"), to_device(d->qm, "qm"), to_device(d->ni, "ni"), to_device(d->bm, "bm"),
+      to_device(d->qv, "qv"), to_device(d->th_atm, "th_atm"),
+      view_2d<Spack>("qv2qi_depos_tend", nj, nk_pack), view_2d<Spack>("diag_eff_radius_qc", nj, nk_pack),
+      view_2d<Spack>("diag_eff_radius_qi", nj, nk_pack), view_2d<Spack>("rho_qi", nj, nk_pack),
+      view_2d<Spack>("precip_liq_flux", nj, nk_pack_p1), view_2d<Spack>("precip_ice_flux", nj, nk_pack_p1),
+      view_2d<Spack>("liq_ice_exchange", nj, nk_pack), view_2d<Spack>("vap_liq_exchange", nj, nk_pack),
+      view_2d<Spack>("vap_ice_exchange", nj, nk_pack)
+    };
+    precip_surf[skip][0] = view_1d<Scalar>("precip_liq_surf", nj);
+    precip_surf[skip][1] = view_1d<Scalar>("precip_ice_surf", nj);
+
+    typename Functions::P3PrognosticState prog_state{out[0], out[1], out[2], out[3], out[4],
+                                                     out[5], out[6], out[7], out[8], out[9]};
+    typename Functions::P3DiagnosticInputs diag_inputs{nc_nuceat_tend, nccn_prescribed, ni_activated, inv_qc_relvar, cld_frac_i,
+                                                       cld_frac_l, cld_frac_r, pres, dz, dpres,
+                                                       inv_exner, qv_prev, t_prev};
+    typename Functions::P3DiagnosticOutputs diag_outputs{out[10], precip_surf[skip][0], precip_surf[skip][1],
+                                                         out[11], out[12], out[13], out[14], out[15]};
+    typename Functions::P3Infrastructure infrastructure{300, 1, 1, nj, 1, nk, true, false,
+                                                        view_2d<Scalar>("col_location", nj, 3)};
+    infrastructure.skip_inactive_columns = skip==1;
+    typename Functions::P3HistoryOnly history_only{out[16], out[17], out[18]};
+
+    Functions::p3_main(prog_state, diag_inputs, diag_outputs, infrastructure,
+                       history_only, lookup_tables, workspace_mgr, nj, nk);
+  }
+
+  for (size_t n = 0; n < outputs[0].size(); ++n) {
+    const auto full_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), outputs[0][n]);
+    const auto skip_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), outputs[1][n]);
+    for (size_t i = 0; i < full_h.extent(0); ++i) {
+      for (size_t k = 0; k < full_h.extent(1); ++k) {
+        for (Int s = 0; s < Spack::n; ++s) {
+          REQUIRE(full_h(i, k)[s] == skip_h(i, k)[s]);
+        }
+      }
+    }
+  }
+  for (int n : {0, 1}) {
+    const auto full_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), precip_surf[0][n]);
+    const auto skip_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), precip_surf[1][n]);
+    for (Int i = 0; i < nj; ++i) {
+      REQUIRE(full_h(i) == skip_h(i));
+    }
+  }
+
+  // The sub-qsmall cloud liquid in the inactive columns was clipped
+  const auto qc_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), outputs[1][0]);
+  for (Int i = 1; i < nj; i += 2) {
+    REQUIRE(qc_h(i, (nk-1) / Spack::n)[(nk-1) % Spack::n] == 0);
+  }
+}
+
 static void run_phys()
 {
   run_phys_p3_main_part1();
   run_phys_p3_main_part2();
   run_phys_p3_main_part3();
   run_phys_p3_main();
+  run_phys_skip_inactive_columns();
 }
 
 static void run_bfb_p3_main_part1()
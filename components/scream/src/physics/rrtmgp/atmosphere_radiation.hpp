@@ -178,6 +178,9 @@ public:
     // 3d size (ncol, nlay, n[sw,lw]gpts)
     real3d cld_tau_sw_gpt;
     real3d cld_tau_lw_gpt;
+
+    // Workspace for the daytime-only shortwave arrays (see rrtmgp::get_sw_day_buffer_size)
+    real1d sw_day_buffer;
   };
 
 protected:
@@ -8,6 +8,8 @@
 #include "cpp/rte/mo_rte_sw.h"
 #include "cpp/rte/mo_rte_lw.h"
 
+#include <Kokkos_Core.hpp>
+
 namespace scream {
     namespace rrtmgp {
 
@@ -209,7 +211,8 @@ namespace scream {
                 real3d &sw_bnd_flux_up, real3d &sw_bnd_flux_dn, real3d &sw_bnd_flux_dn_dir,
                 real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
                 const Real tsi_scaling,
-                const std::shared_ptr<spdlog::logger>& logger) {
+                const std::shared_ptr<spdlog::logger>& logger,
+                Real* sw_day_buffer) {
 
 #ifdef SCREAM_RRTMGP_DEBUG
             // Sanity check inputs, and possibly repair
@@ -321,7 +324,7 @@ namespace scream {
                 k_dist_sw, p_lay, t_lay, p_lev, t_lev, gas_concs, 
                 sfc_alb_dir, sfc_alb_dif, mu0, aerosol_sw, clouds_sw_gpt,
                 fluxes_sw, clrsky_fluxes_sw,
-                tsi_scaling, logger
+                tsi_scaling, logger, sw_day_buffer
             );
 
             // Do longwave
@@ -551,6 +554,18 @@ namespace scream {
         }
 
 
+        int get_sw_day_buffer_size(const int ncol, const int nlay, const int nbnd, const int ngpt, const int ngas) {
+            return 2*ncol                   // day indices (stored as ints) and mu0
+                 + 3*ncol*nlay              // p_lay, t_lay and limited t_lay
+                 + 4*ncol*(nlay+1)          // p_lev and fluxes
+                 + ncol*nlay*ngas           // gas concentrations
+                 + 3*ncol*nlay*nbnd         // aerosol optics
+                 + 6*ncol*nlay*ngpt         // cloud and gas optics
+                 + 2*nbnd*ncol              // surface albedos
+                 + ncol*ngpt                // toa flux
+                 + 3*ncol*(nlay+1)*nbnd;    // fluxes by band
+        }
+
         void rrtmgp_sw(
                 const int ncol, const int nlay,
                 GasOpticsRRTMGP &k_dist,
@@ -560,7 +575,8 @@ namespace scream {
                 OpticalProps2str &aerosol, OpticalProps2str &clouds,
                 FluxesByband &fluxes, FluxesByband &clrsky_fluxes,
                 const Real tsi_scaling,
-                const std::shared_ptr<spdlog::logger>& logger) {
+                const std::shared_ptr<spdlog::logger>& logger,
+                Real* sw_day_buffer) {
 
             // Get problem sizes
             int nbnd = k_dist.get_nband();
@@ -593,65 +609,76 @@ namespace scream {
                 bnd_flux_dn_dir(icol,ilev,ibnd) = 0;
             });
  
-            // Get daytime indices
-            auto dayIndices = int1d("dayIndices", ncol);
-            memset(dayIndices, -1);
-            // Loop below has to be done on host, so create host copies
-            // TODO: there is probably a way to do this on the device
-            auto dayIndices_h = dayIndices.createHostCopy();
-            auto mu0_h = mu0.createHostCopy();
+            // Carve the daytime arrays out of the workspace. If the caller did not
+            // provide one, allocate it here.
+            real1d sw_day_buffer_alloc;
+            if (sw_day_buffer == nullptr) {
+                sw_day_buffer_alloc = real1d("sw_day_buffer", get_sw_day_buffer_size(ncol, nlay, nbnd, ngpt, ngas));
+                sw_day_buffer = sw_day_buffer_alloc.data();
+            }
+            Real* mem = sw_day_buffer;
+
+            // Get daytime indices. The compaction is done on device with a scan,
+            // so that only the number of daytime columns comes back to the host.
+            auto dayIndices = int1d("dayIndices", reinterpret_cast<int*>(mem), ncol);
+            mem += ncol;
             int nday = 0;
-            for (int icol = 1; icol <= ncol; icol++) {
-                if (mu0_h(icol) > 0) {
-                    nday++;
-                    dayIndices_h(nday) = icol;
+            Kokkos::parallel_scan(Kokkos::RangePolicy<>(0, ncol), KOKKOS_LAMBDA(const int i, int& iday, const bool final) {
+                if (mu0(i+1) > 0) {
+                    if (final) {
+                        dayIndices(iday+1) = i+1;
+                    }
+                    ++iday;
                 }
-            }
-            // Copy data back to the device
-            dayIndices_h.deep_copy_to(dayIndices);
+            }, nday);
             if (nday == 0) { 
                 // No daytime columns in this chunk, skip the rest of this routine
                 return;
             }
 
             // Subset mu0
-            auto mu0_day = real1d("mu0_day", nday);
+            auto mu0_day = real1d("mu0_day", mem, nday);
+            mem += mu0_day.totElems();
             parallel_for(Bounds<1>(nday), YAKL_LAMBDA(int iday) {
                 mu0_day(iday) = mu0(dayIndices(iday));
             });
 
             // subset state variables
-            auto p_lay_day = real2d("p_lay_day", nday, nlay);
-            auto t_lay_day = real2d("t_lay_day", nday, nlay);
+            auto p_lay_day = real2d("p_lay_day", mem, nday, nlay);
+            mem += p_lay_day.totElems();
+            auto t_lay_day = real2d("t_lay_day", mem, nday, nlay);
+            mem += t_lay_day.totElems();
             parallel_for(Bounds<2>(nlay,nday), YAKL_LAMBDA(int ilay, int iday) {
                 p_lay_day(iday,ilay) = p_lay(dayIndices(iday),ilay);
                 t_lay_day(iday,ilay) = t_lay(dayIndices(iday),ilay);
             });
-            auto p_lev_day = real2d("p_lev_day", nday, nlay+1);
-            auto t_lev_day = real2d("t_lev_day", nday, nlay+1);
+            auto p_lev_day = real2d("p_lev_day", mem, nday, nlay+1);
+            mem += p_lev_day.totElems();
             parallel_for(Bounds<2>(nlay+1,nday), YAKL_LAMBDA(int ilev, int iday) {
                 p_lev_day(iday,ilev) = p_lev(dayIndices(iday),ilev);
-                t_lev_day(iday,ilev) = t_lev(dayIndices(iday),ilev);
             });
 
-            // Subset gases
-            auto gas_names = gas_concs.get_gas_names();
-            GasConcs gas_concs_day;
-            gas_concs_day.init(gas_names, nday, nlay);
-            for (int igas = 1; igas <= ngas; igas++) {
-                auto vmr_day = real2d("vmr_day", nday, nlay);
-                auto vmr     = real2d("vmr"    , ncol, nlay);
-                gas_concs.get_vmr(gas_names(igas), vmr);
-                parallel_for(Bounds<2>(nlay,nday), YAKL_LAMBDA(int ilay, int iday) {
-                    vmr_day(iday,ilay) = vmr(dayIndices(iday),ilay);
-                });
-                gas_concs_day.set_vmr(gas_names(igas), vmr_day);
-            }
+            // Subset gases. All gases are gathered in one kernel, directly into
+            // the concentrations array of gas_concs_day.
+            GasConcs gas_concs_day = gas_concs;
+            gas_concs_day.ncol = nday;
+            gas_concs_day.concs = real3d("concs_day", mem, nday, nlay, ngas);
+            mem += gas_concs_day.concs.totElems();
+            auto concs     = gas_concs.concs;
+            auto concs_day = gas_concs_day.concs;
+            parallel_for(Bounds<3>(ngas,nlay,nday), YAKL_LAMBDA(int igas, int ilay, int iday) {
+                concs_day(iday,ilay,igas) = concs(dayIndices(iday),ilay,igas);
+            });
 
             // Subset aerosol optics
             OpticalProps2str aerosol_day;
             aerosol_day.init(k_dist.get_band_lims_wavenumber());
-            aerosol_day.alloc_2str(nday, nlay);
+            aerosol_day.tau = real3d("tau", mem, nday, nlay, nbnd);
+            mem += aerosol_day.tau.totElems();
+            aerosol_day.ssa = real3d("ssa", mem, nday, nlay, nbnd);
+            mem += aerosol_day.ssa.totElems();
+            aerosol_day.g   = real3d("g"  , mem, nday, nlay, nbnd);
+            mem += aerosol_day.g.totElems();
             parallel_for(Bounds<3>(nbnd,nlay,nday), YAKL_LAMBDA(int ibnd, int ilay, int iday) {
                 aerosol_day.tau(iday,ilay,ibnd) = aerosol.tau(dayIndices(iday),ilay,ibnd);
                 aerosol_day.ssa(iday,ilay,ibnd) = aerosol.ssa(dayIndices(iday),ilay,ibnd);
@@ -662,7 +689,12 @@ namespace scream {
             // TODO: nbnd -> ngpt once we pass sub-sampled cloud state
             OpticalProps2str clouds_day;
             clouds_day.init(k_dist.get_band_lims_wavenumber(), k_dist.get_band_lims_gpoint());
-            clouds_day.alloc_2str(nday, nlay);
+            clouds_day.tau = real3d("tau", mem, nday, nlay, ngpt);
+            mem += clouds_day.tau.totElems();
+            clouds_day.ssa = real3d("ssa", mem, nday, nlay, ngpt);
+            mem += clouds_day.ssa.totElems();
+            clouds_day.g   = real3d("g"  , mem, nday, nlay, ngpt);
+            mem += clouds_day.g.totElems();
             parallel_for(Bounds<3>(ngpt,nlay,nday), YAKL_LAMBDA(int igpt, int ilay, int iday) {
                 clouds_day.tau(iday,ilay,igpt) = clouds.tau(dayIndices(iday),ilay,igpt);
                 clouds_day.ssa(iday,ilay,igpt) = clouds.ssa(dayIndices(iday),ilay,igpt);
@@ -672,20 +704,28 @@ namespace scream {
             // RRTMGP assumes surface albedos have a screwy dimension ordering
             // for some strange reason, so we need to transpose these; also do
             // daytime subsetting in the same kernel
-            real2d sfc_alb_dir_T("sfc_alb_dir", nbnd, nday);
-            real2d sfc_alb_dif_T("sfc_alb_dif", nbnd, nday);
+            real2d sfc_alb_dir_T("sfc_alb_dir", mem, nbnd, nday);
+            mem += sfc_alb_dir_T.totElems();
+            real2d sfc_alb_dif_T("sfc_alb_dif", mem, nbnd, nday);
+            mem += sfc_alb_dif_T.totElems();
             parallel_for(Bounds<2>(nbnd,nday), YAKL_LAMBDA(int ibnd, int icol) {
                 sfc_alb_dir_T(ibnd,icol) = sfc_alb_dir(dayIndices(icol),ibnd);
                 sfc_alb_dif_T(ibnd,icol) = sfc_alb_dif(dayIndices(icol),ibnd);
             });
 
             // Temporaries we need for daytime-only fluxes
-            auto flux_up_day = real2d("flux_up_day", nday, nlay+1);
-            auto flux_dn_day = real2d("flux_dn_day", nday, nlay+1);
-            auto flux_dn_dir_day = real2d("flux_dn_dir_day", nday, nlay+1);
-            auto bnd_flux_up_day = real3d("bnd_flux_up_day", nday, nlay+1, nbnd);
-            auto bnd_flux_dn_day = real3d("bnd_flux_dn_day", nday, nlay+1, nbnd);
-            auto bnd_flux_dn_dir_day = real3d("bnd_flux_dn_dir_day", nday, nlay+1, nbnd);
+            auto flux_up_day = real2d("flux_up_day", mem, nday, nlay+1);
+            mem += flux_up_day.totElems();
+            auto flux_dn_day = real2d("flux_dn_day", mem, nday, nlay+1);
+            mem += flux_dn_day.totElems();
+            auto flux_dn_dir_day = real2d("flux_dn_dir_day", mem, nday, nlay+1);
+            mem += flux_dn_dir_day.totElems();
+            auto bnd_flux_up_day = real3d("bnd_flux_up_day", mem, nday, nlay+1, nbnd);
+            mem += bnd_flux_up_day.totElems();
+            auto bnd_flux_dn_day = real3d("bnd_flux_dn_day", mem, nday, nlay+1, nbnd);
+            mem += bnd_flux_dn_day.totElems();
+            auto bnd_flux_dn_dir_day = real3d("bnd_flux_dn_dir_day", mem, nday, nlay+1, nbnd);
+            mem += bnd_flux_dn_dir_day.totElems();
             FluxesByband fluxes_day;
             fluxes_day.flux_up         = flux_up_day;
             fluxes_day.flux_dn         = flux_dn_day;
@@ -694,18 +734,32 @@ namespace scream {
             fluxes_day.bnd_flux_dn     = bnd_flux_dn_day;
             fluxes_day.bnd_flux_dn_dir = bnd_flux_dn_dir_day;
 
-            // Allocate space for optical properties
+            // Space for optical properties
             OpticalProps2str optics;
-            optics.alloc_2str(nday, nlay, k_dist);
+            optics.init(k_dist.get_band_lims_wavenumber(), k_dist.get_band_lims_gpoint());
+            optics.tau = real3d("tau", mem, nday, nlay, ngpt);
+            mem += optics.tau.totElems();
+            optics.ssa = real3d("ssa", mem, nday, nlay, ngpt);
+            mem += optics.ssa.totElems();
+            optics.g   = real3d("g"  , mem, nday, nlay, ngpt);
+            mem += optics.g.totElems();
 
             // Limit temperatures for gas optics look-up tables
-            auto t_lay_limited = real2d("t_lay_limited", nday, nlay);
+            auto t_lay_limited = real2d("t_lay_limited", mem, nday, nlay);
+            mem += t_lay_limited.totElems();
             limit_to_bounds(t_lay_day, k_dist_sw.get_temp_min(), k_dist_sw.get_temp_max(), t_lay_limited);
 
             // Do gas optics
-            real2d toa_flux("toa_flux", nday, ngpt);
-            auto p_lay_host = p_lay.createHostCopy();
-            bool top_at_1 = p_lay_host(1, 1) < p_lay_host(1, nlay);
+            real2d toa_flux("toa_flux", mem, nday, ngpt);
+            mem += toa_flux.totElems();
+            assert (mem-sw_day_buffer <= get_sw_day_buffer_size(ncol, nlay, nbnd, ngpt, ngas));
+
+            // Only the vertical ordering is needed on host, so don't copy all of p_lay
+            int top_at_1_int = 0;
+            Kokkos::parallel_reduce(Kokkos::RangePolicy<>(0, 1), KOKKOS_LAMBDA(const int, int& top) {
+                top = p_lay(1, 1) < p_lay(1, nlay) ? 1 : 0;
+            }, top_at_1_int);
+            bool top_at_1 = top_at_1_int==1;
 
             k_dist.gas_optics(nday, nlay, top_at_1, p_lay_day, p_lev_day, t_lay_limited, gas_concs_day, optics, toa_flux);
 
@@ -58,6 +58,9 @@ namespace scream {
          * Main driver code to run RRTMGP.
          * The input logger is in charge of outputing info to
          * screen and/or to file (or neither), depending on how it was set up.
+         * If not null, sw_day_buffer must point to get_sw_day_buffer_size(...) reals
+         * of device memory, used for the daytime-only shortwave arrays. Otherwise,
+         * that memory is allocated at every call.
          */
         extern void rrtmgp_main(
                 const int ncol, const int nlay,
@@ -74,11 +77,17 @@ namespace scream {
                 real3d &sw_bnd_flux_up, real3d &sw_bnd_flux_dn, real3d &sw_bnd_flux_dn_dir,
                 real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
                 const Real tsi_scaling,
-                const std::shared_ptr<spdlog::logger>& logger);
+                const std::shared_ptr<spdlog::logger>& logger,
+                Real* sw_day_buffer = nullptr);
         /*
          * Perform any clean-up tasks
          */
         extern void rrtmgp_finalize();
+        /*
+         * Number of reals needed by rrtmgp_sw for the daytime-only copies of its
+         * inputs and outputs, for chunks of up to ncol columns.
+         */
+        extern int get_sw_day_buffer_size(const int ncol, const int nlay, const int nbnd, const int ngpt, const int ngas);
         /*
          * Shortwave driver (called by rrtmgp_main)
          */
@@ -89,7 +98,8 @@ namespace scream {
                 real2d &sfc_alb_dir, real2d &sfc_alb_dif, real1d &mu0,
                 OpticalProps2str &aerosol, OpticalProps2str &clouds,
                 FluxesByband &fluxes, FluxesByband &clrsky_fluxes, const Real tsi_scaling,
-                const std::shared_ptr<spdlog::logger>& logger);
+                const std::shared_ptr<spdlog::logger>& logger,
+                Real* sw_day_buffer = nullptr);
         /*
          * Longwave driver (called by rrtmgp_main)
          */
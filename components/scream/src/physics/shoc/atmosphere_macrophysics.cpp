@@ -447,12 +447,16 @@ void SHOCMacrophysics::run_impl (const int dt)
   const auto scan_policy    = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(m_num_cols, nlev_packs);
   const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
 
+  // NOTE: all SHOC kernels below run in order on the same execution space
+  //       instance, and npbl was computed at initialization, so there is no need
+  //       to synchronize with the host in here. This way, SHOC can be queued
+  //       behind the kernels of the previous processes.
+
   // Preprocessing of SHOC inputs. Kernel contains a parallel_scan,
   // so a special TeamPolicy is required.
   Kokkos::parallel_for("shoc_preprocess",
                        scan_policy,
                        shoc_preprocess);
-  Kokkos::fence();
 
   // For now set the host timestep to the shoc timestep. This forces
   // number of SHOC timesteps (nadv) to be 1.
@@ -475,7 +479,6 @@ void SHOCMacrophysics::run_impl (const int dt)
   Kokkos::parallel_for("shoc_postprocess",
                        default_policy,
                        shoc_postprocess);
-  Kokkos::fence();
 }
 // =========================================================================================
 void SHOCMacrophysics::finalize_impl()
@@ -773,6 +773,9 @@ struct Functions
     const uview_1d<const Spack>& dz_zt,
     const uview_1d<Spack>&       rdp_zt);
 
+  // Computes the maximum number of levels in the pbl (npbl) from the reference
+  // pressure profile. This requires a device-to-host copy, so it is meant to be
+  // called once, at initialization, and its result passed to every shoc_main call.
   static Int shoc_init(
     const Int&                  nbot_shoc,
     const Int&                  ntop_shoc,
@@ -916,7 +919,9 @@ struct Functions
     const view_2d<Spack>& tkh);
 #endif
 
-  // Return microseconds elapsed
+  // Return microseconds elapsed on the host. This function does not fence, so
+  // that SHOC can be queued behind the kernels of the previous processes: callers
+  // that need the results on the host (or a timing of the device work) must fence.
   static Int shoc_main(
     const Int&               shcol,                // Number of SHOC columns in the array
     const Int&               nlev,                 // Number of levels
@@ -971,6 +976,25 @@ struct Functions
     const uview_1d<Scalar>& d,
     const uview_2d<Spack>&  var);
 
+  // In-place alternative to vd_shoc_solve, for rhs stored with contiguous levels.
+  // vd_shoc_factor overwrites dl and d with the LU factorization of the matrix,
+  // then vd_shoc_solve_factored solves for the nrhs<=Spack::n rhs pointed to by x,
+  // one per pack entry (call it from a single thread).
+  KOKKOS_FUNCTION
+  static void vd_shoc_factor(
+    const MemberType&       team,
+    const uview_1d<Scalar>& du,
+    const uview_1d<Scalar>& dl,
+    const uview_1d<Scalar>& d);
+
+  KOKKOS_FUNCTION
+  static void vd_shoc_solve_factored(
+    const uview_1d<const Scalar>& du,
+    const uview_1d<const Scalar>& dl,
+    const uview_1d<const Scalar>& d,
+    Scalar* const*                x,
+    const Int&                    nrhs);
+
   KOKKOS_FUNCTION
   static void pblintd_surf_temp(const Int& nlev, const Int& nlevi, const Int& npbl,
       const uview_1d<const Spack>& z, const Scalar& ustar,
@@ -610,7 +610,6 @@ Int Functions<S,D>::shoc_main(
 
     shoc_output.pblh(i) = pblh_s;
   });
-  Kokkos::fence();
 #else
   const auto u_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, Kokkos::ALL(), 0, Kokkos::ALL());
   const auto v_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, Kokkos::ALL(), 1, Kokkos::ALL());
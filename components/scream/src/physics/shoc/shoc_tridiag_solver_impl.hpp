@@ -95,6 +95,68 @@ void Functions<S,D>::vd_shoc_solve(
 #endif
 }
 
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_factor(
+  const MemberType&       team,
+  const uview_1d<Scalar>& du,
+  const uview_1d<Scalar>& dl,
+  const uview_1d<Scalar>& d)
+{
+  // Thomas algorithm: store the multipliers in dl, and the pivots in d
+  const Int nlev = d.extent_int(0);
+  Kokkos::single(Kokkos::PerTeam(team), [&] () {
+    for (Int k=1; k<nlev; ++k) {
+      dl(k) /= d(k-1);
+      d(k)  -= dl(k)*du(k-1);
+    }
+  });
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_solve_factored(
+  const uview_1d<const Scalar>& du,
+  const uview_1d<const Scalar>& dl,
+  const uview_1d<const Scalar>& d,
+  Scalar* const*                x,
+  const Int&                    nrhs)
+{
+  const Int nlev = d.extent_int(0);
+
+  // Each rhs goes in one pack entry, so that the recursions in the level index
+  // of all rhs proceed together. Unused entries are zero, and never stored.
+  const auto load = [&] (const Int& k) {
+    Spack xk(0);
+    for (Int s=0; s<nrhs; ++s) {
+      xk[s] = x[s][k];
+    }
+    return xk;
+  };
+  const auto store = [&] (const Int& k, const Spack& xk) {
+    for (Int s=0; s<nrhs; ++s) {
+      x[s][k] = xk[s];
+    }
+  };
+
+  // Forward substitution
+  Spack xprev = load(0);
+  for (Int k=1; k<nlev; ++k) {
+    const Spack xk = load(k) - dl(k)*xprev;
+    store(k,xk);
+    xprev = xk;
+  }
+
+  // Backward substitution
+  xprev /= d(nlev-1);
+  store(nlev-1,xprev);
+  for (Int k=nlev-2; k>=0; --k) {
+    const Spack xk = (load(k) - du(k)*xprev) / d(k);
+    store(k,xk);
+    xprev = xk;
+  }
+}
+
 } // namespace shoc
 } // namespace scream
 
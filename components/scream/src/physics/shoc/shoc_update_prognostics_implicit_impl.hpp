@@ -58,33 +58,15 @@ void Functions<S,D>::update_prognostics_implicit(
   auto dl = Kokkos::subview(dl_workspace, Kokkos::make_pair(0,nlev));
   auto d  = Kokkos::subview(d_workspace,  Kokkos::make_pair(0,nlev));
 
-  // 2d allocations for solver RHS
-  const int num_wind_transpose_packs = ekat::npack<Spack>(2);
-  const int num_qtracers_transpose_packs = ekat::npack<Spack>(num_qtracers+3);
-
-  const int n_wind_slots = num_wind_transpose_packs*Spack::n;
-  const int n_trac_slots = num_qtracers_transpose_packs*Spack::n;
-
-  const auto wind_slot    = workspace.template take_macro_block<Scalar>("wind_slot",n_wind_slots);
-  const auto tracers_slot = workspace.template take_macro_block<Scalar>("tracers_slot",n_trac_slots);
-
-  // Reshape 2d views
-  const auto wind_rhs     = uview_2d<Spack>(reinterpret_cast<Spack*>(wind_slot.data()),
-                                            nlev, num_wind_transpose_packs);
-  const auto qtracers_rhs  = uview_2d<Spack>(reinterpret_cast<Spack*>(tracers_slot.data()),
-                                            nlev, num_qtracers_transpose_packs);
-
   // scalarized versions of some views will be needed
   const auto rdp_zt_s       = ekat::scalarize(rdp_zt);
   const auto rho_zi_s       = ekat::scalarize(rho_zi);
   const auto u_wind_s       = ekat::scalarize(u_wind);
   const auto v_wind_s       = ekat::scalarize(v_wind);
-  const auto wind_rhs_s     = ekat::scalarize(wind_rhs);
   const auto thetal_s       = ekat::scalarize(thetal);
   const auto qw_s           = ekat::scalarize(qw);
   const auto tke_s          = ekat::scalarize(tke);
   const auto qtracers_s     = ekat::scalarize(qtracers);
-  const auto qtracers_rhs_s = ekat::scalarize(qtracers_rhs);
   const auto wtracer_sfc_s  = ekat::scalarize(wtracer_sfc);
 
   // linearly interpolate tkh, tk, and air density onto the interface grids
@@ -145,6 +127,26 @@ void Functions<S,D>::update_prognostics_implicit(
     });
   }
 
+#if defined(EKAT_DEFAULT_BFB) || defined(EAMXX_ENABLE_GPU)
+  // 2d allocations for solver RHS
+  const int num_wind_transpose_packs = ekat::npack<Spack>(2);
+  const int num_qtracers_transpose_packs = ekat::npack<Spack>(num_qtracers+3);
+
+  const int n_wind_slots = num_wind_transpose_packs*Spack::n;
+  const int n_trac_slots = num_qtracers_transpose_packs*Spack::n;
+
+  const auto wind_slot    = workspace.template take_macro_block<Scalar>("wind_slot",n_wind_slots);
+  const auto tracers_slot = workspace.template take_macro_block<Scalar>("tracers_slot",n_trac_slots);
+
+  // Reshape 2d views
+  const auto wind_rhs     = uview_2d<Spack>(reinterpret_cast<Spack*>(wind_slot.data()),
+                                            nlev, num_wind_transpose_packs);
+  const auto qtracers_rhs  = uview_2d<Spack>(reinterpret_cast<Spack*>(tracers_slot.data()),
+                                            nlev, num_qtracers_transpose_packs);
+
+  const auto wind_rhs_s     = ekat::scalarize(wind_rhs);
+  const auto qtracers_rhs_s = ekat::scalarize(qtracers_rhs);
+
   // Store RHS values in wind_rhs and qtracers_rhs for 1st and 2nd solve respectively
   team.team_barrier();
   Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&] (const Int& k) {
@@ -197,11 +199,60 @@ void Functions<S,D>::update_prognostics_implicit(
     tke_s(k)    = qtracers_rhs_s(k, num_qtracers+2);
   });
 
-
-  // Release temporary variables from the workspace
   team.team_barrier();
   workspace.template release_macro_block<Scalar>(tracers_slot,n_trac_slots);
   workspace.template release_macro_block<Scalar>(wind_slot,n_wind_slots);
+#else
+  // On CPU, levels of each tracer are contiguous, so we can solve for each rhs
+  // in place, rather than transposing all tracers to/from a (nlev,num_qtracers) rhs.
+  // Each thread solves for Spack::n rhs at a time, one per pack entry, to retain
+  // the vectorization across rhs of the transposed solve.
+  const Int num_rhs = num_qtracers+3;
+  const auto get_rhs = [&] (const Int& q) -> Scalar* {
+    if (q<num_qtracers) {
+      return &qtracers_s(q,0);
+    } else if (q==num_qtracers) {
+      return thetal_s.data();
+    } else if (q==num_qtracers+1) {
+      return qw_s.data();
+    }
+    return tke_s.data();
+  };
+
+  // march u_wind and v_wind one step forward using implicit solver
+  team.team_barrier();
+  vd_shoc_decomp(team, nlev, tk_zi, tmpi, rdp_zt, dtime, ksrf, du, dl, d);
+  team.team_barrier();
+  vd_shoc_factor(team, du, dl, d);
+  team.team_barrier();
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, ekat::npack<Spack>(2)), [&] (const Int& c) {
+    Scalar* x[Spack::n];
+    const Int nrhs = ekat::impl::min<Int>(Spack::n, 2-c*Spack::n);
+    for (Int s=0; s<nrhs; ++s) {
+      x[s] = c*Spack::n+s==0 ? u_wind_s.data() : v_wind_s.data();
+    }
+    vd_shoc_solve_factored(du, dl, d, x, nrhs);
+  });
+
+  // march temperature, total water, tke,and tracers one step forward using implicit solver.
+  // Fluxes applied explicitly, so zero fluxes out for implicit solver decomposition.
+  team.team_barrier();
+  vd_shoc_decomp(team, nlev, tkh_zi, tmpi, rdp_zt, dtime, 0, du, dl, d);
+  team.team_barrier();
+  vd_shoc_factor(team, du, dl, d);
+  team.team_barrier();
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, ekat::npack<Spack>(num_rhs)), [&] (const Int& c) {
+    Scalar* x[Spack::n];
+    const Int nrhs = ekat::impl::min<Int>(Spack::n, num_rhs-c*Spack::n);
+    for (Int s=0; s<nrhs; ++s) {
+      x[s] = get_rhs(c*Spack::n+s);
+    }
+    vd_shoc_solve_factored(du, dl, d, x, nrhs);
+  });
+#endif
+
+  // Release temporary variables from the workspace
+  team.team_barrier();
   workspace.template release_many_contiguous<3,Scalar>(
     {&du_workspace, &dl_workspace, &d_workspace});
   workspace.template release_many_contiguous<5>(
@@ -79,6 +79,80 @@ struct UnitWrap::UnitTest<D>::TestVdShocDecompandSolve {
     }
   } // run_bfb
 
+  // Check that the in-place solve (vd_shoc_factor+vd_shoc_solve_factored),
+  // working on level-contiguous rhs, matches vd_shoc_solve.
+  static void run_property()
+  {
+    const Int nlev  = 72;
+    const Int n_rhs = 43;
+    const Int nlev_packs = ekat::npack<Spack>(nlev);
+    const Int n_rhs_packs = ekat::npack<Spack>(n_rhs);
+
+    auto engine = setup_random_test();
+    std::uniform_real_distribution<Real> off_diag_pdf(-1,0), rhs_pdf(0,1);
+
+    // A diagonally dominant system (as the one from vd_shoc_decomp)
+    view_1d<Scalar> du("du",nlev), dl("dl",nlev), d("d",nlev);
+    auto du_h = Kokkos::create_mirror_view(du);
+    auto dl_h = Kokkos::create_mirror_view(dl);
+    auto d_h  = Kokkos::create_mirror_view(d);
+    for (Int k=0; k<nlev; ++k) {
+      du_h(k) = k==nlev-1 ? 0 : off_diag_pdf(engine);
+      dl_h(k) = k==0      ? 0 : off_diag_pdf(engine);
+      d_h(k)  = 1 - du_h(k) - dl_h(k);
+    }
+
+    // Same rhs, in (lev,rhs) and (rhs,lev) layouts
+    view_2d<Spack> var_lev_major("",nlev,n_rhs_packs), var_rhs_major("",n_rhs,nlev_packs);
+    auto var_lev_major_h = Kokkos::create_mirror_view(var_lev_major);
+    auto var_rhs_major_h = Kokkos::create_mirror_view(var_rhs_major);
+    auto lev_major_s = ekat::scalarize(var_lev_major_h);
+    auto rhs_major_s = ekat::scalarize(var_rhs_major_h);
+    for (Int k=0; k<nlev; ++k) {
+      for (Int q=0; q<n_rhs; ++q) {
+        lev_major_s(k,q) = rhs_major_s(q,k) = rhs_pdf(engine);
+      }
+    }
+
+    Kokkos::deep_copy(du,du_h);
+    Kokkos::deep_copy(dl,dl_h);
+    Kokkos::deep_copy(d,d_h);
+    Kokkos::deep_copy(var_lev_major,var_lev_major_h);
+    Kokkos::deep_copy(var_rhs_major,var_rhs_major_h);
+
+    view_1d<Scalar> du2("du2",nlev), dl2("dl2",nlev), d2("d2",nlev);
+    Kokkos::deep_copy(du2,du);
+    Kokkos::deep_copy(dl2,dl);
+    Kokkos::deep_copy(d2,d);
+
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, nlev_packs);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      Functions::vd_shoc_solve(team, du, dl, d, var_lev_major);
+
+      Functions::vd_shoc_factor(team, du2, dl2, d2);
+      team.team_barrier();
+      const auto var_s = ekat::scalarize(var_rhs_major);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, n_rhs_packs), [&] (const Int& c) {
+        Scalar* x[Spack::n];
+        const Int nrhs = ekat::impl::min<Int>(Spack::n, n_rhs-c*Spack::n);
+        for (Int s=0; s<nrhs; ++s) {
+          x[s] = &var_s(c*Spack::n+s,0);
+        }
+        Functions::vd_shoc_solve_factored(du2, dl2, d2, x, nrhs);
+      });
+    });
+    Kokkos::fence();
+
+    Kokkos::deep_copy(var_lev_major_h,var_lev_major);
+    Kokkos::deep_copy(var_rhs_major_h,var_rhs_major);
+    const Scalar tol = 1e3*std::numeric_limits<Scalar>::epsilon();
+    for (Int k=0; k<nlev; ++k) {
+      for (Int q=0; q<n_rhs; ++q) {
+        REQUIRE (std::abs(lev_major_s(k,q)-rhs_major_s(q,k)) <= tol*std::abs(lev_major_s(k,q)));
+      }
+    }
+  } // run_property
+
 };
 
 } // namespace unit_test
@@ -87,6 +161,13 @@ struct UnitWrap::UnitTest<D>::TestVdShocDecompandSolve {
 
 namespace {
 
+TEST_CASE("vd_shoc_solve_property", "[shoc]")
+{
+  using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestVdShocDecompandSolve;
+
+  TestStruct::run_property();
+}
+
 TEST_CASE("vd_shoc_solve_bfb", "[shoc]")
 {
   using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestVdShocDecompandSolve;
@@ -67,7 +67,7 @@ void SPA::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
   //       take this information directly from the spa data file.
   m_spa_data_file = m_params.get<std::string>("spa_data_file");
   scorpio::register_file(m_spa_data_file,scorpio::Read);
-  m_num_src_levs = scorpio::get_dimlen_c2f(m_spa_data_file.c_str(),"lev");
+  m_num_src_levs = scorpio::get_dimlen(m_spa_data_file,"lev");
   scorpio::eam_pio_closefile(m_spa_data_file);
   SPAHorizInterp.m_comm = m_comm;
 
@@ -182,11 +182,18 @@ void SPA::initialize_impl (const RunType /* run_type */)
   SPAData_start = SPAFunc::SPAInput(m_dofs_gids.size(), m_num_src_levs+2, m_nswbands, m_nlwbands);
   SPAData_end   = SPAFunc::SPAInput(m_dofs_gids.size(), m_num_src_levs+2, m_nswbands, m_nlwbands);
 
+  // Optionally, read the data for the next month while time-stepping within the current
+  // month, so that month boundaries do not stall the model on file reads.
+  m_prefetch_data = m_params.get<bool>("spa_prefetch_data",false);
+  if (m_prefetch_data) {
+    SPAData_prefetch = SPAFunc::SPAPrefetch(m_dofs_gids.size(), m_num_src_levs+2, m_nswbands, m_nlwbands);
+  }
+
   // Update the local time state information and load the first set of SPA data for interpolation:
   auto ts = timestamp();
   SPATimeState.inited = false;
   SPATimeState.current_month = ts.get_month();
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  update_spa_timestate(ts);
 
   // Set property checks for fields in this process
   using Interval = FieldWithinIntervalCheck;
@@ -200,6 +207,16 @@ void SPA::initialize_impl (const RunType /* run_type */)
   add_postcondition_check<Interval>(get_field_out("aero_tau_lw"),m_grid,0.0,1.0,true);
 }
 
+// =========================================================================================
+void SPA::run_prologue_impl (const int dt)
+{
+  // Update time state and if the month has changed, update the data.
+  // This may read from file, so it is done here rather than in run_impl.
+  // Note: run_impl sees the step size of the subcycles, and so does this.
+  auto ts = timestamp()+dt/get_num_subcycles();
+  update_spa_timestate(ts);
+}
+
 // =========================================================================================
 void SPA::run_impl (const int dt)
 {
@@ -207,13 +224,24 @@ void SPA::run_impl (const int dt)
   auto ts = timestamp()+dt;
   /* Update the SPATimeState to reflect the current time, note the addition of dt */
   SPATimeState.t_now = ts.frac_of_year_in_days();
-  /* Update time state and if the month has changed, update the data.*/
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
 
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Pack**>();
   SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
-                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out);
+                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out,
+                    exec_space());
+}
+
+// =========================================================================================
+void SPA::update_spa_timestate (const util::TimeStamp& ts)
+{
+  if (m_prefetch_data) {
+    SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,
+                                  SPAData_start,SPAData_end,SPAData_prefetch);
+  } else {
+    SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,
+                                  SPAData_start,SPAData_end);
+  }
 }
 
 // =========================================================================================
@@ -50,6 +50,10 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
+  // The input (p_mid) is not among the outputs, and the data is read from file in
+  // run_prologue_impl, so run_impl only launches kernels, on exec_space()
+  bool supports_concurrent_run () const { return true; }
+
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
     // Used to store temporary data during spa_main
@@ -63,9 +67,13 @@ protected:
   // The three main overrides for the subcomponent
   void initialize_impl (const RunType run_type);
   void initialize_spa_impl ();
+  void run_prologue_impl (const int dt);
   void run_impl        (const int dt);
   void finalize_impl   ();
 
+  // Updates the time state, and the data at the beginning/end of the month, if needed
+  void update_spa_timestate (const util::TimeStamp& ts);
+
   // Computes total number of bytes needed for local variables
   size_t requested_buffer_size_in_bytes() const;
 
@@ -100,6 +108,10 @@ protected:
   SPAFunc::SPAInput         SPAData_end;
   SPAFunc::SPAOutput        SPAData_out;
 
+  // If true, the data for the month after next is read ahead of time, over several steps
+  bool                      m_prefetch_data;
+  SPAFunc::SPAPrefetch      SPAData_prefetch;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 }; // class SPA 
 
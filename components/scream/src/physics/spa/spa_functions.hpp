@@ -11,6 +11,10 @@
 #include "ekat/ekat_workspace.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
 
+#include <map>
+#include <string>
+#include <vector>
+
 namespace scream {
 namespace spa {
 
@@ -34,6 +38,7 @@ struct SPAFunctions
   using Spack = SmallPack<Scalar>;
 
   using KT = KokkosTypes<Device>;
+  using ExeSpace = typename KT::ExeSpace;
   using MemberType = typename KT::MemberType;
 
   using WorkspaceManager = typename ekat::WorkspaceManager<Spack, Device>;
@@ -160,6 +165,25 @@ struct SPAFunctions
     ekat::Comm m_comm;
 
   }; // SPAHorizInterp
+
+  struct SPAPrefetch {
+    // This structure holds the state of the read of a time slice of SPA data that
+    // happens ahead of time, in stages spread over several time steps (see
+    // advance_spa_prefetch), so that steps crossing a month boundary only need
+    // to swap buffers.
+    SPAPrefetch() = default;
+    SPAPrefetch(const int ncols_, const int nlevs_, const int nswbands_, const int nlwbands_)
+     : data(ncols_,nlevs_,nswbands_,nlwbands_)
+    {}
+    // Zero-based time index of the slice being prefetched (-1 if none)
+    int time_index = -1;
+    // Number of prefetch stages completed so far
+    int num_stages_done = 0;
+    // Source resolution data read so far, as flattened host views
+    std::map<std::string,view_1d_host<Real>> src_views;
+    // The prefetched data, on the simulation grid, ready once all stages are done
+    SPAInput data;
+  }; // SPAPrefetch
   /* ------------------------------------------------------------------------------------------- */
   // SPA routines
   static void spa_main(
@@ -169,7 +193,8 @@ struct SPAFunctions
     const SPAInput&   data_beg,
     const SPAInput&   data_end,
     const SPAInput&   data_tmp,         // Temporary
-    const SPAOutput&  data_out);
+    const SPAOutput&  data_out,
+    const ExeSpace&   space = ExeSpace());
 
   static void get_remap_weights_from_file(
     const std::string&       remap_file_name,
@@ -190,6 +215,26 @@ struct SPAFunctions
           SPAHorizInterp& spa_horiz_interp,
           SPAInput&       spa_data);
 
+  // The two halves of update_spa_data_from_file: read some of the variables
+  // from file (at source resolution), and remap/pad all of them to spa_data.
+  static void read_spa_source_data(
+    const std::string&                         spa_data_file_name,
+    const int                                  time_index,
+    const std::vector<std::string>&            var_names,
+    const int                                  nswbands,
+    const int                                  nlwbands,
+          SPAHorizInterp&                      spa_horiz_interp,
+          std::map<std::string,view_1d_host<Real>>& src_views);
+
+  static void remap_spa_source_data(
+    const int                                       nswbands,
+    const int                                       nlwbands,
+          SPAHorizInterp&                           spa_horiz_interp,
+    const std::map<std::string,view_1d_host<Real>>& src_views,
+          SPAInput&                                 spa_data);
+
+  static const std::vector<std::string>& get_spa_source_var_names();
+
   static void update_spa_timestate(
     const std::string&     spa_data_file_name,
     const int              nswbands,
@@ -200,24 +245,52 @@ struct SPAFunctions
           SPAInput&        spa_beg,
           SPAInput&        spa_end);
 
+  // Same as above, but at a month boundary the data for the new month comes from
+  // the old spa_end, and the one for the following month from the prefetch, which
+  // is then restarted for the month after. At all other steps, the prefetch is
+  // advanced by one stage.
+  static void update_spa_timestate(
+    const std::string&     spa_data_file_name,
+    const int              nswbands,
+    const int              nlwbands,
+    const util::TimeStamp& ts,
+          SPAHorizInterp&  spa_horiz_interp,
+          SPATimeState&    time_state,
+          SPAInput&        spa_beg,
+          SPAInput&        spa_end,
+          SPAPrefetch&     prefetch);
+
+  // Performs up to max_stages stages of the pending prefetch, and returns true
+  // if the prefetched data is ready.
+  static bool advance_spa_prefetch(
+    const std::string&     spa_data_file_name,
+    const int              nswbands,
+    const int              nlwbands,
+          SPAHorizInterp&  spa_horiz_interp,
+          SPAPrefetch&     prefetch,
+    const int              max_stages);
+
   // The following three are called during spa_main
   static void perform_time_interpolation (
       const SPATimeState& time_state,
       const SPAInput&  data_beg,
       const SPAInput&  data_end,
-      const SPAInput&  data_out);
+      const SPAInput&  data_out,
+      const ExeSpace&  space = ExeSpace());
 
   static void compute_source_pressure_levels (
       const view_1d<const Real>& ps_src,
       const view_2d<      Spack>& p_src,
       const view_1d<const Spack>& hyam,
-      const view_1d<const Spack>& hybm);
+      const view_1d<const Spack>& hybm,
+      const ExeSpace& space = ExeSpace());
 
   static void perform_vertical_interpolation (
       const view_2d<const Spack>& p_src,
       const view_2d<const Spack>& p_tgt,
       const SPAData&  data_in,
-      const SPAData&  data_out);
+      const SPAData&  data_out,
+      const ExeSpace& space = ExeSpace());
 
   // Return the subcolumn of the proper variable, where ivar
   // is a condensed idx for var and possibly band. In particular:
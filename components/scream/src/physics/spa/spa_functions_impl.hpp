@@ -12,6 +12,7 @@
 #include "ekat/ekat_pack_utils.hpp"
 #include "ekat/ekat_parse_yaml_file.hpp"
 
+#include <limits>
 #include <numeric>
 
 #include "share/util/scream_timing.hpp"
@@ -95,7 +96,8 @@ void SPAFunctions<S,D>
   const SPAInput&   data_beg,
   const SPAInput&   data_end,
   const SPAInput&   data_tmp,
-  const SPAOutput&  data_out)
+  const SPAOutput&  data_out,
+  const ExeSpace&   space)
 {
   // Beg/End/Tmp month must have all sizes matching
   EKAT_REQUIRE_MSG (
@@ -126,13 +128,13 @@ void SPAFunctions<S,D>
       "       SPAInput and SPAOutput data structs must have the same number columns.\n");
 
   // Step 1. Perform time interpolation
-  perform_time_interpolation(time_state,data_beg,data_end,data_tmp);
+  perform_time_interpolation(time_state,data_beg,data_end,data_tmp,space);
 
   // Step 2. Compute source pressure levels
-  compute_source_pressure_levels(data_tmp.PS, p_src, data_beg.hyam, data_beg.hybm);
+  compute_source_pressure_levels(data_tmp.PS, p_src, data_beg.hyam, data_beg.hybm, space);
 
   // Step 3. Perform vertical interpolation
-  perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out);
+  perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out, space);
 }
 
 /*-----------------------------------------------------------------*/
@@ -142,13 +144,14 @@ void SPAFunctions<S,D>
   const SPATimeState& time_state,
   const SPAInput&  data_beg,
   const SPAInput&  data_end,
-  const SPAInput&  data_out)
+  const SPAInput&  data_out,
+  const ExeSpace&  space)
 {
   // NOTE: we *assume* data_beg and data_end have the *same* hybrid v coords.
   //       IF this ever ceases to be the case, you can interp those too.
 
-  using ExeSpace = typename KT::ExeSpace;
   using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+  using TeamPolicy = typename KT::TeamPolicy;
 
   // Gather time stamp info
   auto& t_now = time_state.t_now;
@@ -177,7 +180,8 @@ void SPAFunctions<S,D>
       "  t_beg  : " + std::to_string(t_beg) + "\n"
       "  delta_t: " + std::to_string(delta_t) + "\n");
 
-  Kokkos::parallel_for("spa_time_interp_loop", policy,
+  Kokkos::parallel_for("spa_time_interp_loop",
+    TeamPolicy(space,policy.league_size(),policy.team_size()),
     KOKKOS_LAMBDA(const MemberType& team) {
 
     // The policy is over ncols*num_vars, so retrieve icol/ivar
@@ -202,7 +206,7 @@ void SPAFunctions<S,D>
       var_out(k) = linear_interp(var_beg(k),var_end(k),delta_t_fraction);
     });
   });
-  Kokkos::fence();
+  space.fence();
 }
 
 template<typename S, typename D>
@@ -211,10 +215,11 @@ compute_source_pressure_levels(
   const view_1d<const Real>& ps_src,
   const view_2d<      Spack>& p_src,
   const view_1d<const Spack>& hyam,
-  const view_1d<const Spack>& hybm)
+  const view_1d<const Spack>& hybm,
+  const ExeSpace& space)
 {
-  using ExeSpace = typename KT::ExeSpace;
   using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+  using TeamPolicy = typename KT::TeamPolicy;
   using C = scream::physics::Constants<Real>;
 
   constexpr auto P0 = C::P0;
@@ -223,7 +228,8 @@ compute_source_pressure_levels(
   const int num_vert_packs = p_src.extent(1);
   const auto policy = ESU::get_default_team_policy(ncols, num_vert_packs);
 
-  Kokkos::parallel_for("spa_compute_p_src_loop", policy,
+  Kokkos::parallel_for("spa_compute_p_src_loop",
+    TeamPolicy(space,policy.league_size(),policy.team_size()),
     KOKKOS_LAMBDA (const MemberType& team) {
     const int icol = team.league_rank();
     Kokkos::parallel_for(Kokkos::TeamThreadRange(team,num_vert_packs),
@@ -239,10 +245,11 @@ perform_vertical_interpolation(
   const view_2d<const Spack>& p_src,
   const view_2d<const Spack>& p_tgt,
   const SPAData& input,
-  const SPAData& output)
+  const SPAData& output,
+  const ExeSpace& space)
 {
-  using ExeSpace = typename KT::ExeSpace;
   using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+  using TeamPolicy = typename KT::TeamPolicy;
   using LIV = ekat::LinInterp<Real,Spack::n>;
 
   // Makes no sense to have different number of bands
@@ -264,7 +271,8 @@ perform_vertical_interpolation(
   const auto policy_setup = ESU::get_default_team_policy(ncols, num_vert_packs);
 
   // Setup the linear interpolation object
-  Kokkos::parallel_for("spa_vert_interp_setup_loop", policy_setup,
+  Kokkos::parallel_for("spa_vert_interp_setup_loop",
+    TeamPolicy(space,policy_setup.league_size(),policy_setup.team_size()),
     KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
 
     const int icol = team.league_rank();
@@ -273,12 +281,13 @@ perform_vertical_interpolation(
     vert_interp.setup(team, ekat::subview(p_src,icol),
                             ekat::subview(p_tgt,icol));
   });
-  Kokkos::fence();
+  space.fence();
 
   // Now use the interpolation object in || over all variables.
   const int outer_iters = ncols*num_vars;
   const auto policy_interp = ESU::get_default_team_policy(outer_iters, num_vert_packs);
-  Kokkos::parallel_for("spa_vert_interp_loop", policy_interp,
+  Kokkos::parallel_for("spa_vert_interp_loop",
+    TeamPolicy(space,policy_interp.league_size(),policy_interp.team_size()),
     KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
 
     const int icol = team.league_rank() / num_vars;
@@ -292,7 +301,7 @@ perform_vertical_interpolation(
 
     vert_interp.lin_interp(team, x1, x2, y1, y2, icol);
   });
-  Kokkos::fence();
+  space.fence();
 }
 
 /*-----------------------------------------------------------------*/
@@ -406,6 +415,37 @@ void SPAFunctions<S,D>
           SPAInput&             spa_data)
 {
   start_timer("EAMxx::SPA::update_spa_data_from_file");
+  // Read all the variables at once, then remap them to the simulation grid.
+  std::map<std::string,view_1d_host<Real>> src_views;
+  read_spa_source_data(spa_data_file_name,time_index,get_spa_source_var_names(),
+                       nswbands,nlwbands,spa_horiz_interp,src_views);
+  remap_spa_source_data(nswbands,nlwbands,spa_horiz_interp,src_views,spa_data);
+  stop_timer("EAMxx::SPA::update_spa_data_from_file");
+
+} // END update_spa_data_from_file
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+const std::vector<std::string>& SPAFunctions<S,D>
+::get_spa_source_var_names()
+{
+  static const std::vector<std::string> names =
+    {"hyam","hybm","PS","CCN3","AER_G_SW","AER_SSA_SW","AER_TAU_SW","AER_TAU_LW"};
+  return names;
+}
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::read_spa_source_data(
+    const std::string&                         spa_data_file_name,
+    const int                                  time_index, // zero-based
+    const std::vector<std::string>&            var_names,
+    const int                                  nswbands,
+    const int                                  nlwbands,
+          SPAHorizInterp&                      spa_horiz_interp,
+          std::map<std::string,view_1d_host<Real>>& src_views)
+{
   // Ensure all ranks are operating independently when reading the file, so there's a copy on all ranks
   auto comm = spa_horiz_interp.m_comm;
 
@@ -414,51 +454,25 @@ void SPAFunctions<S,D>
   auto unique_src_dofs = spa_horiz_map.get_unique_source_dofs();
   const int num_local_cols = spa_horiz_map.get_num_unique_dofs();
   scorpio::register_file(spa_data_file_name,scorpio::Read);
-  const int source_data_nlevs = scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"lev");
+  const int source_data_nlevs = scorpio::get_dimlen(spa_data_file_name,"lev");
+  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen(spa_data_file_name,"swband"),"ERROR update_spa_data_from_file: Number of SW bands in simulation doesn't match the SPA data file");
+  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen(spa_data_file_name,"lwband"),"ERROR update_spa_data_from_file: Number of LW bands in simulation doesn't match the SPA data file");
   scorpio::eam_pio_closefile(spa_data_file_name);
 
-  // Construct local arrays to read data into
-  // Note, all of the views being created here are meant to hold the source resolution
-  // data that will need to be horizontally interpolated to the simulation grid using the remap
-  // data.  For example, 
-  //   We will first define the data surface pressure PS_v and read that from file.
-  //   then we will use the horizontal interpolation structure, spa_horiz_interp, to
-  //   interpolate PS_v onto the simulation grid: PS_v -> spa_data.PS
-  //   and so on for the other variables.
+  // Note, all of the views being read here hold the source resolution data, which
+  // will need to be horizontally interpolated to the simulation grid using the remap
+  // data (see remap_spa_source_data).
   start_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
-  std::vector<std::string> fnames = {"hyam","hybm","PS","CCN3","AER_G_SW","AER_SSA_SW","AER_TAU_SW","AER_TAU_LW"};
   ekat::ParameterList spa_data_in_params;
-  spa_data_in_params.set("Field Names",fnames);
+  spa_data_in_params.set("Field Names",var_names);
   spa_data_in_params.set("Filename",spa_data_file_name);
   spa_data_in_params.set("Skip_Grid_Checks",true);  // We need to skip grid checks because multiple ranks may want the same column of source data.
   AtmosphereInput spa_data_input(comm,spa_data_in_params);
-  
+
   // Construct the grid needed for input:
   auto grid = std::make_shared<PointGrid>("grid",num_local_cols,source_data_nlevs,comm);
   grid->set_dofs(unique_src_dofs);
 
-  // Check that padding matches source size:
-  EKAT_REQUIRE(source_data_nlevs+2 == spa_data.data.nlevs);
-  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"swband"),"ERROR update_spa_data_from_file: Number of SW bands in simulation doesn't match the SPA data file");
-  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen_c2f(spa_data_file_name.c_str(),"lwband"),"ERROR update_spa_data_from_file: Number of LW bands in simulation doesn't match the SPA data file");
-
-  // Constuct views to read source data in from file
-  typename view_1d<Real>::HostMirror hyam_v_h("hyam",source_data_nlevs);
-  typename view_1d<Real>::HostMirror hybm_v_h("hybm",source_data_nlevs);
-  view_1d<Real> PS_v("PS",num_local_cols);
-  view_2d<Real> CCN3_v("CCN3",num_local_cols,source_data_nlevs);
-  view_3d<Real> AER_G_SW_v("AER_G_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_SSA_SW_v("AER_SSA_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_SW_v("AER_TAU_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_LW_v("AER_TAU_LW",num_local_cols,nlwbands,source_data_nlevs);
-
-  auto PS_v_h         = Kokkos::create_mirror_view(PS_v);
-  auto CCN3_v_h       = Kokkos::create_mirror_view(CCN3_v);      
-  auto AER_G_SW_v_h   = Kokkos::create_mirror_view(AER_G_SW_v);
-  auto AER_SSA_SW_v_h = Kokkos::create_mirror_view(AER_SSA_SW_v);
-  auto AER_TAU_SW_v_h = Kokkos::create_mirror_view(AER_TAU_SW_v);
-  auto AER_TAU_LW_v_h = Kokkos::create_mirror_view(AER_TAU_LW_v);
-
   // Set up input structure to read data from file.
   using namespace ShortFieldTagsNames;
   FieldLayout scalar1d_layout { {LEV}, {source_data_nlevs} };
@@ -468,44 +482,67 @@ void SPAFunctions<S,D>
   FieldLayout scalar3d_lwband_layout { {COL,LWBND, LEV}, {num_local_cols, nlwbands, source_data_nlevs} };
   std::map<std::string,view_1d_host<Real>> host_views;
   std::map<std::string,FieldLayout>  layouts;
-  // Define each input variable we need
-  host_views["hyam"] = view_1d_host<Real>(hyam_v_h.data(),hyam_v_h.size());
-  layouts.emplace("hyam", scalar1d_layout);
-  host_views["hybm"] = view_1d_host<Real>(hybm_v_h.data(),hybm_v_h.size());
-  layouts.emplace("hybm", scalar1d_layout);
-  //
-  host_views["PS"] = view_1d_host<Real>(PS_v_h.data(),PS_v_h.size());
-  layouts.emplace("PS", scalar2d_layout_mid);
-  //
-  host_views["CCN3"] = view_1d_host<Real>(CCN3_v_h.data(),CCN3_v_h.size());
-  layouts.emplace("CCN3",scalar3d_layout_mid);
-  //
-  host_views["AER_G_SW"] = view_1d_host<Real>(AER_G_SW_v_h.data(),AER_G_SW_v_h.size());
-  layouts.emplace("AER_G_SW",scalar3d_swband_layout);
-  //
-  host_views["AER_SSA_SW"] = view_1d_host<Real>(AER_SSA_SW_v_h.data(),AER_SSA_SW_v_h.size());
-  layouts.emplace("AER_SSA_SW",scalar3d_swband_layout);
-  //
-  host_views["AER_TAU_SW"] = view_1d_host<Real>(AER_TAU_SW_v_h.data(),AER_TAU_SW_v_h.size());
-  layouts.emplace("AER_TAU_SW",scalar3d_swband_layout);
-  //
-  host_views["AER_TAU_LW"] = view_1d_host<Real>(AER_TAU_LW_v_h.data(),AER_TAU_LW_v_h.size());
-  layouts.emplace("AER_TAU_LW",scalar3d_lwband_layout);
-  //
-  
+  for (const auto& name : var_names) {
+    if (name=="hyam" || name=="hybm") {
+      layouts.emplace(name,scalar1d_layout);
+    } else if (name=="PS") {
+      layouts.emplace(name,scalar2d_layout_mid);
+    } else if (name=="CCN3") {
+      layouts.emplace(name,scalar3d_layout_mid);
+    } else if (name=="AER_TAU_LW") {
+      layouts.emplace(name,scalar3d_lwband_layout);
+    } else {
+      layouts.emplace(name,scalar3d_swband_layout);
+    }
+    // Reuse the views from a previous read, if their size still matches
+    auto& v = src_views[name];
+    if (v.size()!=static_cast<size_t>(layouts.at(name).size())) {
+      v = view_1d_host<Real>(name,layouts.at(name).size());
+    }
+    host_views[name] = v;
+  }
+
   // Now that we have all the variables defined we can use the scorpio_input class to grab the data.
   spa_data_input.init(grid,host_views,layouts);
   spa_data_input.read_variables(time_index);
   spa_data_input.finalize();
   stop_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+} // END read_spa_source_data
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::remap_spa_source_data(
+    const int                                       nswbands,
+    const int                                       nlwbands,
+          SPAHorizInterp&                           spa_horiz_interp,
+    const std::map<std::string,view_1d_host<Real>>& src_views,
+          SPAInput&                                 spa_data)
+{
+  auto& spa_horiz_map = spa_horiz_interp.horiz_map;
+  const int num_local_cols = spa_horiz_map.get_num_unique_dofs();
+  const int source_data_nlevs = src_views.at("hyam").size();
+
+  // Check that padding matches source size:
+  EKAT_REQUIRE(source_data_nlevs+2 == spa_data.data.nlevs);
+
   start_timer("EAMxx::SPA::update_spa_data_from_file::apply_remap");
-  // Copy data from host back to the device views.
-  Kokkos::deep_copy(PS_v,PS_v_h);
-  Kokkos::deep_copy(CCN3_v      , CCN3_v_h);      
-  Kokkos::deep_copy(AER_G_SW_v  , AER_G_SW_v_h);
-  Kokkos::deep_copy(AER_SSA_SW_v, AER_SSA_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_SW_v, AER_TAU_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_LW_v, AER_TAU_LW_v_h);
+  // Copy data from host to device views.
+  using PS_h_t   = typename view_1d<Real>::HostMirror;
+  using CCN3_h_t = typename view_2d<Real>::HostMirror;
+  using AER_h_t  = typename view_3d<Real>::HostMirror;
+  view_1d<Real> PS_v("PS",num_local_cols);
+  view_2d<Real> CCN3_v("CCN3",num_local_cols,source_data_nlevs);
+  view_3d<Real> AER_G_SW_v("AER_G_SW",num_local_cols,nswbands,source_data_nlevs);
+  view_3d<Real> AER_SSA_SW_v("AER_SSA_SW",num_local_cols,nswbands,source_data_nlevs);
+  view_3d<Real> AER_TAU_SW_v("AER_TAU_SW",num_local_cols,nswbands,source_data_nlevs);
+  view_3d<Real> AER_TAU_LW_v("AER_TAU_LW",num_local_cols,nlwbands,source_data_nlevs);
+  Kokkos::deep_copy(PS_v,         PS_h_t(src_views.at("PS").data(),num_local_cols));
+  Kokkos::deep_copy(CCN3_v,       CCN3_h_t(src_views.at("CCN3").data(),num_local_cols,source_data_nlevs));
+  Kokkos::deep_copy(AER_G_SW_v,   AER_h_t(src_views.at("AER_G_SW").data(),num_local_cols,nswbands,source_data_nlevs));
+  Kokkos::deep_copy(AER_SSA_SW_v, AER_h_t(src_views.at("AER_SSA_SW").data(),num_local_cols,nswbands,source_data_nlevs));
+  Kokkos::deep_copy(AER_TAU_SW_v, AER_h_t(src_views.at("AER_TAU_SW").data(),num_local_cols,nswbands,source_data_nlevs));
+  Kokkos::deep_copy(AER_TAU_LW_v, AER_h_t(src_views.at("AER_TAU_LW").data(),num_local_cols,nlwbands,source_data_nlevs));
 
   // Apply the remap to this data
   spa_horiz_map.apply_remap(PS_v,spa_data.PS); // Note PS is not padded, so remap can be applied right away
@@ -589,6 +626,8 @@ void SPAFunctions<S,D>
   // a padded version of the data.
   //   hya/b[0] = 0.0, note this is handled by deep copy above
   //   hya/b[N+2] = BIG number so always bigger than likely pmid for target
+  const auto& hyam_v_h = src_views.at("hyam");
+  const auto& hybm_v_h = src_views.at("hybm");
   auto hyam_h       = Kokkos::create_mirror_view(spa_data.hyam);
   auto hybm_h       = Kokkos::create_mirror_view(spa_data.hybm);
   Kokkos::deep_copy(hyam_h,0.0);
@@ -605,9 +644,7 @@ void SPAFunctions<S,D>
   hybm_h(pack)[kidx] = 0.0;
   Kokkos::deep_copy(spa_data.hyam,hyam_h);
   Kokkos::deep_copy(spa_data.hybm,hybm_h);
-  stop_timer("EAMxx::SPA::update_spa_data_from_file");
-
-} // END update_spa_data_from_file
+} // END remap_spa_source_data
 
 /*-----------------------------------------------------------------*/
 template<typename S, typename D>
@@ -648,6 +685,95 @@ void SPAFunctions<S,D>
 
 } // END updata_spa_timestate
 
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+bool SPAFunctions<S,D>
+::advance_spa_prefetch(
+  const std::string&     spa_data_file_name,
+  const int              nswbands,
+  const int              nlwbands,
+        SPAHorizInterp&  spa_horiz_interp,
+        SPAPrefetch&     prefetch,
+  const int              max_stages)
+{
+  // The prefetch is split in stages, so that its cost can be spread over several
+  // time steps: one stage for each variable read from file, plus a final one
+  // that remaps (and pads) the data to the simulation grid.
+  if (prefetch.time_index<0) {
+    return false;
+  }
+  const auto& var_names = get_spa_source_var_names();
+  const int num_vars   = var_names.size();
+  const int num_stages = num_vars+1;
+  for (int n=0; n<max_stages && prefetch.num_stages_done<num_stages; ++n) {
+    const int stage = prefetch.num_stages_done;
+    if (stage<num_vars) {
+      read_spa_source_data(spa_data_file_name,prefetch.time_index,{var_names[stage]},
+                           nswbands,nlwbands,spa_horiz_interp,prefetch.src_views);
+    } else {
+      remap_spa_source_data(nswbands,nlwbands,spa_horiz_interp,prefetch.src_views,prefetch.data);
+    }
+    ++prefetch.num_stages_done;
+  }
+  return prefetch.num_stages_done==num_stages;
+} // END advance_spa_prefetch
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::update_spa_timestate(
+  const std::string&     spa_data_file_name,
+  const int              nswbands,
+  const int              nlwbands,
+  const util::TimeStamp& ts,
+        SPAHorizInterp&  spa_horiz_interp,
+        SPATimeState&    time_state, 
+        SPAInput&        spa_beg,
+        SPAInput&        spa_end,
+        SPAPrefetch&     prefetch)
+{
+  const auto month = ts.get_month();
+  if (month == time_state.current_month and time_state.inited) {
+    // Not a month boundary: move the pending prefetch (if any) one stage forward.
+    advance_spa_prefetch(spa_data_file_name,nswbands,nlwbands,spa_horiz_interp,prefetch,1);
+    return;
+  }
+
+  auto next = [](const int m) { return m==12 ? 1 : m+1; };
+
+  // The prefetched slice is the one for the month after the new one, as long as
+  // we simply moved on to the following month (e.g., not after a restart).
+  const bool use_prefetch = time_state.inited and month==next(time_state.current_month)
+                            and prefetch.time_index==next(month)-1;
+
+  // Update the SPA time state information
+  time_state.current_month = month;
+  time_state.t_beg_month = util::TimeStamp({ts.get_year(),month,1}, {0,0,0}).frac_of_year_in_days();
+  time_state.days_this_month = util::days_in_month(ts.get_year(),month);
+
+  if (use_prefetch) {
+    // Complete the prefetch, in case the month did not have enough steps to do it.
+    advance_spa_prefetch(spa_data_file_name,nswbands,nlwbands,spa_horiz_interp,prefetch,
+                         std::numeric_limits<int>::max());
+    // Swap buffers: the old end of month data is the new beginning of month data,
+    // the prefetched data is the new end of month data, and the old beginning of
+    // month buffer becomes the target of the next prefetch.
+    std::swap(spa_beg,spa_end);
+    std::swap(spa_end,prefetch.data);
+  } else {
+    // NOTE: we use zero-based time indexing here.
+    update_spa_data_from_file(spa_data_file_name,month-1,nswbands,nlwbands,spa_horiz_interp,spa_beg);
+    update_spa_data_from_file(spa_data_file_name,next(month)-1,nswbands,nlwbands,spa_horiz_interp,spa_end);
+  }
+
+  // Start prefetching the month after next. The actual reads happen in the following steps.
+  prefetch.time_index = next(next(month))-1;
+  prefetch.num_stages_done = 0;
+
+  // If time state was not initialized it is now:
+  time_state.inited = true;
+} // END update_spa_timestate (with prefetch)
+
 template<typename S,typename D>
 KOKKOS_INLINE_FUNCTION
 auto SPAFunctions<S,D>::
@@ -23,6 +23,8 @@ using view_1d = typename KokkosTypes<DefaultDevice>::template view_1d<S>;
 Real ps_func(const int t, const int ncols);
 Real ccn3_func(const int t, const int klev, const int ncols);
 Real aer_func(const int t, const int bnd, const int klev, const int ncols, const int mode);
+template<typename ViewT>
+bool views_are_equal(const ViewT& v1, const ViewT& v2);
 
 TEST_CASE("spa_read_data","spa")
 {
@@ -111,7 +113,32 @@ TEST_CASE("spa_read_data","spa")
       }
     }
   }
-  
+
+  // Reading a slice in stages, as done when prefetching the next month, must give
+  // exactly the same data as reading it in one go.
+  SPAFunc::SPAPrefetch prefetch(dofs_gids.size(), nlevs+2, nswbands, nlwbands);
+  const int num_stages = SPAFunc::get_spa_source_var_names().size()+1;
+  for (int time_index = 0;time_index<max_time; time_index++) {
+    SPAFunc::update_spa_data_from_file(spa_data_file, time_index, nswbands, nlwbands,
+                                       spa_horiz_interp, spa_data);
+    prefetch.time_index = time_index;
+    prefetch.num_stages_done = 0;
+    int num_calls = 1;
+    while (not SPAFunc::advance_spa_prefetch(spa_data_file, nswbands, nlwbands,
+                                             spa_horiz_interp, prefetch, 1)) {
+      ++num_calls;
+    }
+    REQUIRE(num_calls==num_stages);
+    REQUIRE(views_are_equal(prefetch.data.PS,spa_data.PS));
+    REQUIRE(views_are_equal(prefetch.data.hyam,spa_data.hyam));
+    REQUIRE(views_are_equal(prefetch.data.hybm,spa_data.hybm));
+    REQUIRE(views_are_equal(prefetch.data.data.CCN3,spa_data.data.CCN3));
+    REQUIRE(views_are_equal(prefetch.data.data.AER_G_SW,spa_data.data.AER_G_SW));
+    REQUIRE(views_are_equal(prefetch.data.data.AER_SSA_SW,spa_data.data.AER_SSA_SW));
+    REQUIRE(views_are_equal(prefetch.data.data.AER_TAU_SW,spa_data.data.AER_TAU_SW));
+    REQUIRE(views_are_equal(prefetch.data.data.AER_TAU_LW,spa_data.data.AER_TAU_LW));
+  }
+
   // All Done 
   scorpio::eam_pio_finalize();
 } // run_property
@@ -157,6 +184,29 @@ Real aer_func(const int t, const int bnd, const int klev, const int ncols, const
   }
   return aer_out;
 } // aer_func
+//
+template<typename ViewT>
+bool views_are_equal(const ViewT& v1, const ViewT& v2)
+{
+  auto v1_h = Kokkos::create_mirror_view(v1);
+  auto v2_h = Kokkos::create_mirror_view(v2);
+  Kokkos::deep_copy(v1_h,v1);
+  Kokkos::deep_copy(v2_h,v2);
+  if (v1.span()!=v2.span()) {
+    return false;
+  }
+  // Compare the raw scalars, so that packed views are handled too
+  using value_type = typename ViewT::non_const_value_type;
+  const size_t n = v1.span()*sizeof(value_type)/sizeof(Real);
+  const Real* d1 = reinterpret_cast<const Real*>(v1_h.data());
+  const Real* d2 = reinterpret_cast<const Real*>(v2_h.data());
+  for (size_t i=0;i<n;++i) {
+    if (d1[i]!=d2[i]) {
+      return false;
+    }
+  }
+  return true;
+} // views_are_equal
 
 } // namespace
 
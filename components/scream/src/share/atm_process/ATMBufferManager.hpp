@@ -19,6 +19,21 @@ struct ATMBufferManager {
     m_allocated = false;
   }
 
+  // Create a manager exposing the chunk [offset,offset+num_bytes) of the
+  // memory of src. Processes running concurrently must use different chunks.
+  ATMBufferManager(const ATMBufferManager& src, const size_t offset, const size_t num_bytes)
+  {
+    ekat::error::runtime_check(src.allocated(), "Error! Source buffer manager is not allocated.\n");
+    ekat::error::runtime_check(offset%sizeof(Real)==0 && num_bytes%sizeof(Real)==0,
+                               "Error! Buffer chunk offset and size must be divisible by sizeof(Real).\n");
+    ekat::error::runtime_check(offset+num_bytes<=src.allocated_bytes(),
+                               "Error! Buffer chunk exceeds the source buffer size.\n");
+
+    m_size      = num_bytes/sizeof(Real);
+    m_buffer    = view_1d<Real>(src.get_memory()+offset/sizeof(Real),m_size);
+    m_allocated = true;
+  }
+
   ~ATMBufferManager() = default;
 
   // Each ATM process should request the number of bytes
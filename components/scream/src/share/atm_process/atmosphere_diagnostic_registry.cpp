@@ -0,0 +1,81 @@
+#include "share/atm_process/atmosphere_diagnostic_registry.hpp"
+
+namespace scream
+{
+
+void AtmosphereDiagnosticRegistry::
+add_diagnostic (const std::string& name, const std::string& grid_name,
+                const diag_ptr_type& diag,
+                const std::vector<std::string>& depends_on)
+{
+  EKAT_REQUIRE_MSG (diag!=nullptr,
+      "Error! Invalid pointer for diagnostic '" + name + "'.\n");
+  EKAT_REQUIRE_MSG (not has_diagnostic(name,grid_name),
+      "Error! Diagnostic already stored in the registry.\n"
+      "  - diag name: " + name + "\n"
+      "  - grid name: " + grid_name + "\n");
+  for (const auto& dep : depends_on) {
+    EKAT_REQUIRE_MSG (has_diagnostic(dep,grid_name),
+        "Error! Diagnostic depends on a diagnostic not stored in the registry.\n"
+        "  - diag name: " + name + "\n"
+        "  - grid name: " + grid_name + "\n"
+        "  - dep name : " + dep + "\n");
+  }
+
+  auto& entry = m_diags[key_type(name,grid_name)];
+  entry.diag = diag;
+  entry.depends_on = depends_on;
+}
+
+bool AtmosphereDiagnosticRegistry::
+has_diagnostic (const std::string& name, const std::string& grid_name) const
+{
+  return m_diags.find(key_type(name,grid_name))!=m_diags.end();
+}
+
+auto AtmosphereDiagnosticRegistry::
+get_diagnostic (const std::string& name, const std::string& grid_name) const
+ -> diag_ptr_type
+{
+  check_has_diagnostic(name,grid_name);
+  return m_diags.at(key_type(name,grid_name)).diag;
+}
+
+void AtmosphereDiagnosticRegistry::
+compute_diagnostic (const std::string& name, const std::string& grid_name)
+{
+  check_has_diagnostic(name,grid_name);
+  auto& entry = m_diags.at(key_type(name,grid_name));
+  for (const auto& dep : entry.depends_on) {
+    compute_diagnostic(dep,grid_name);
+  }
+
+  const auto& inputs = entry.diag->get_fields_in();
+  std::vector<util::TimeStamp> inputs_ts;
+  inputs_ts.reserve(inputs.size());
+  for (const auto& f : inputs) {
+    inputs_ts.push_back(f.get_header().get_tracking().get_time_stamp());
+  }
+
+  if (entry.evaluated && inputs_ts==entry.inputs_ts) {
+    // Nothing changed since last evaluation
+    ++m_num_skipped;
+    return;
+  }
+
+  entry.diag->compute_diagnostic();
+  entry.evaluated = true;
+  entry.inputs_ts = inputs_ts;
+  ++m_num_evaluations;
+}
+
+void AtmosphereDiagnosticRegistry::
+check_has_diagnostic (const std::string& name, const std::string& grid_name) const
+{
+  EKAT_REQUIRE_MSG (has_diagnostic(name,grid_name),
+      "Error! Diagnostic not found in the registry.\n"
+      "  - diag name: " + name + "\n"
+      "  - grid name: " + grid_name + "\n");
+}
+
+} // namespace scream
@@ -0,0 +1,83 @@
+#ifndef SCREAM_ATMOSPHERE_DIAGNOSTIC_REGISTRY_HPP
+#define SCREAM_ATMOSPHERE_DIAGNOSTIC_REGISTRY_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A registry of atmosphere diagnostics, shared by all the output streams.
+ *
+ * Different output streams may request the same diagnostic. Rather than
+ * having each stream create (and evaluate) its own copy, streams can store
+ * their diagnostics in a registry, which holds one instance per diagnostic
+ * and grid. Streams can then look up the diagnostic, and reuse it.
+ *
+ * The registry also keeps track of the timestamps of the diagnostic inputs
+ * at the time of its last evaluation. When asked to compute a diagnostic,
+ * the registry skips the evaluation if none of the inputs timestamps changed.
+ * Hence, a diagnostic is evaluated at most once per time step, regardless of
+ * how many streams request it. Notice that this relies on the inputs timestamps
+ * being updated whenever the inputs change, which is what the AD does.
+ *
+ * Note: since the diagnostic inputs are fields from a particular field manager,
+ *       streams that remap fields to a different grid (and hence use their own
+ *       field manager) should not share their diagnostics with other streams.
+ */
+
+class AtmosphereDiagnosticRegistry
+{
+public:
+  using diag_ptr_type = std::shared_ptr<AtmosphereDiagnostic>;
+
+  AtmosphereDiagnosticRegistry () = default;
+  ~AtmosphereDiagnosticRegistry () = default;
+
+  // Store a diagnostic, together with the list of other diagnostics (on the same grid)
+  // it depends on. Those will be computed before this diagnostic.
+  void add_diagnostic (const std::string& name, const std::string& grid_name,
+                       const diag_ptr_type& diag,
+                       const std::vector<std::string>& depends_on = {});
+
+  bool has_diagnostic (const std::string& name, const std::string& grid_name) const;
+
+  diag_ptr_type get_diagnostic (const std::string& name, const std::string& grid_name) const;
+
+  // Compute the diagnostic (after computing the diagnostics it depends on),
+  // unless none of its inputs changed since the last evaluation.
+  void compute_diagnostic (const std::string& name, const std::string& grid_name);
+
+  // How many times diagnostics were actually computed (or skipped)
+  int num_evaluations () const { return m_num_evaluations; }
+  int num_skipped_evaluations () const { return m_num_skipped; }
+
+protected:
+  using key_type = std::pair<std::string,std::string>;
+
+  struct DiagEntry {
+    diag_ptr_type                 diag;
+    std::vector<std::string>      depends_on;
+
+    // Timestamps of the diag inputs at the time of the last evaluation
+    bool                          evaluated = false;
+    std::vector<util::TimeStamp>  inputs_ts;
+  };
+
+  void check_has_diagnostic (const std::string& name, const std::string& grid_name) const;
+
+  std::map<key_type,DiagEntry>   m_diags;
+
+  int m_num_evaluations = 0;
+  int m_num_skipped     = 0;
+};
+
+} // namespace scream
+
+#endif // SCREAM_ATMOSPHERE_DIAGNOSTIC_REGISTRY_HPP
@@ -60,6 +60,12 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
   // Info for mass and energy conservation checks
   m_column_conservation_check_data.has_check =
       m_params.get<bool>("enable_column_conservation_checks", false);
+
+  // In lazy mode, the results of the fused checks are retrieved at the next step,
+  // so that the checks do not require a host-device sync at every step.
+  const bool lazy_checks = m_params.get("lazy_property_checks",false);
+  m_precondition_checks  = std::make_shared<PropertyCheckBatch>(lazy_checks);
+  m_postcondition_checks = std::make_shared<PropertyCheckBatch>(lazy_checks);
 }
 
 void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type) {
@@ -75,12 +81,22 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 }
 
 void AtmosphereProcess::run (const int dt) {
+  run_begin (dt);
+  run_subcycles (dt);
+  run_end (dt);
+}
+
+void AtmosphereProcess::run_begin (const int dt) {
   start_timer (m_timer_prefix + this->name() + "::run");
   if (m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
   }
 
+  run_prologue_impl(dt);
+}
+
+void AtmosphereProcess::run_subcycles (const int dt) {
   EKAT_REQUIRE_MSG ( (dt % m_num_subcycles)==0,
       "Error! The number of subcycle iterations does not exactly divide the time step.\n"
       "  - Atm proc name: " + this->name() + "\n"
@@ -105,12 +121,20 @@ void AtmosphereProcess::run (const int dt) {
       run_column_conservation_check();
     }
   }
+}
 
+void AtmosphereProcess::run_end (const int dt) {
   if (m_params.get("enable_postcondition_checks", true)) {
     // Run 'post-condition' property checks stored in this AP
     run_postcondition_checks();
   }
 
+  // Processes usually write to device views obtained at initialization, which
+  // the fields cannot see. And we can't rely on the time stamps to detect the
+  // change, since all processes in a step stamp their outputs with the same
+  // time. So explicitly flag the outputs as modified on device.
+  flag_computed_fields_modified ();
+
   m_time_stamp += dt;
   if (m_update_time_stamps) {
     // Update all output fields time stamps
@@ -120,6 +144,14 @@ void AtmosphereProcess::run (const int dt) {
 }
 
 void AtmosphereProcess::finalize (/* what inputs? */) {
+  // Lazy checks of the last step are still pending
+  for (const auto& it : m_precondition_checks->flush()) {
+    run_property_check(it.pc, it.cfh, PropertyCheckCategory::Precondition, it.result);
+  }
+  for (const auto& it : m_postcondition_checks->flush()) {
+    run_property_check(it.pc, it.cfh, PropertyCheckCategory::Postcondition, it.result);
+  }
+
   finalize_impl(/* what inputs? */);
 }
 
@@ -223,8 +255,16 @@ void AtmosphereProcess::set_computed_group (const FieldGroup& group) {
 
 void AtmosphereProcess::run_property_check (const prop_check_ptr&       property_check,
                                             const CheckFailHandling     check_fail_handling,
-                                            const PropertyCheckCategory property_check_category) const {
+                                            const PropertyCheckCategory property_check_category,
+                                            const CheckResult           known_result) const {
   auto res_and_msg = property_check->check();
+  if (known_result!=CheckResult::Pass && res_and_msg.result==CheckResult::Pass) {
+    // The check failed in a lazy batch, at the previous step, and the fields changed since then.
+    // Note: lazy batches never contain checks that can repair.
+    res_and_msg.result = known_result;
+    res_and_msg.msg = "Check failed at the previous step (lazy property checks).\n"
+                      "  The field values that caused the failure are no longer available.\n";
+  }
 
   // string for output
   std::string pre_post_str;
@@ -263,20 +303,27 @@ void AtmosphereProcess::run_property_check (const prop_check_ptr&       property
   }
 }
 
+void AtmosphereProcess::run_property_checks (PropertyCheckBatch&         checks,
+                                             const PropertyCheckCategory property_check_category) const {
+  for (const auto& it : checks.get_unfused_checks()) {
+    run_property_check(it.second, it.first, property_check_category);
+  }
+
+  // The fused checks are run with a single kernel. Only the checks that did not pass
+  // need to be run individually, to retrieve the location of the offending entries.
+  for (const auto& it : checks.run()) {
+    run_property_check(it.pc, it.cfh, property_check_category, it.result);
+  }
+}
+
 void AtmosphereProcess::run_precondition_checks () const {
   // Run all pre-condition property checks
-  for (const auto& it : m_precondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Precondition);
-  }
+  run_property_checks(*m_precondition_checks, PropertyCheckCategory::Precondition);
 }
 
 void AtmosphereProcess::run_postcondition_checks () const {
   // Run all post-condition property checks
-  for (const auto& it : m_postcondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Postcondition);
-  }
+  run_property_checks(*m_postcondition_checks, PropertyCheckCategory::Postcondition);
 }
 
 void AtmosphereProcess::run_column_conservation_check () const {
@@ -358,6 +405,20 @@ void AtmosphereProcess::update_time_stamps () {
   }
 }
 
+void AtmosphereProcess::flag_computed_fields_modified () {
+  for (auto& f : m_fields_out) {
+    f.modify<Device>();
+  }
+  for (auto& g : m_groups_out) {
+    if (g.m_bundle) {
+      g.m_bundle->modify<Device>();
+    }
+    for (auto& f : g.m_fields) {
+      f.second->modify<Device>();
+    }
+  }
+}
+
 void AtmosphereProcess::add_me_as_provider (const Field& f) {
   f.get_header_ptr()->get_tracking().add_provider(weak_from_this());
 }
@@ -492,7 +553,7 @@ add_precondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Atmosphere process name: " + name() + "\n"
         "  - Property check name: " + pc->name() + "\n");
   }
-  m_precondition_checks.push_back(std::make_pair(cfh,pc));
+  m_precondition_checks->add_check(cfh,pc);
 }
 
 void AtmosphereProcess::
@@ -510,7 +571,7 @@ add_postcondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Atmosphere process name: " + name() + "\n"
         "  - Property check name: " + pc->name() + "\n");
   }
-  m_postcondition_checks.push_back(std::make_pair(cfh,pc));
+  m_postcondition_checks->add_check(cfh,pc);
 }
 
 void AtmosphereProcess::
@@ -7,6 +7,7 @@
 #include "share/field/field_identifier.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/property_checks/property_check.hpp"
+#include "share/property_checks/property_check_batch.hpp"
 #include "share/field/field_request.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
@@ -113,6 +114,26 @@ public:
   void run (const int dt);
   void finalize   (/* what inputs? */);
 
+  // The run method, split in three phases. The group runs these separately for processes
+  // running concurrently (see AtmosphereProcessGroup): run_begin and run_end take care of
+  // timers, property checks, logging, time stamps, and run_prologue_impl, and must be called
+  // on the main thread. Only run_subcycles can be called on a different thread.
+  void run_begin (const int dt);
+  void run_subcycles (const int dt);
+  void run_end (const int dt);
+
+  // Whether this process can run concurrently with other processes. If true, run_impl
+  // must launch all its kernels on exec_space(), must not use timers, the logger,
+  // or MPI, and must not sync fields between host and device. Work that needs any
+  // of these (e.g., reading data from file) can be done in run_prologue_impl.
+  virtual bool supports_concurrent_run () const { return false; }
+
+  // The execution space instance for the kernels launched in run_impl. This is the
+  // default instance, unless the process runs concurrently with other processes.
+  using exec_space_type = KokkosTypes<DefaultDevice>::ExeSpace;
+  const exec_space_type& exec_space () const { return m_exec_space; }
+  void set_exec_space (const exec_space_type& exec_space) { m_exec_space = exec_space; }
+
   // Return the MPI communicator
   const ekat::Comm& get_comm () const { return m_comm; }
 
@@ -365,12 +386,20 @@ protected:
   // (of size dt). This method is called before the timestamp is updated.
   virtual void run_impl(const int dt) = 0;
 
+  // Override this method for work that must be done on the main thread at the
+  // beginning of each step (of size dt), before the subcycles, even if the process
+  // runs concurrently with other processes (e.g., I/O, or MPI calls).
+  virtual void run_prologue_impl(const int /* dt */) {}
+
   // Override this method to finalize the derived class
   virtual void finalize_impl(/* what inputs? */) = 0;
 
   // This provides access to this process's timestamp.
   const TimeStamp& timestamp() const { return m_time_stamp; }
 
+  // Flag all computed fields/groups as modified on device (see Field::modify)
+  void flag_computed_fields_modified ();
+
   // These three methods modify the FieldTracking of the input field (see field_tracking.hpp)
   void update_time_stamps ();
   void add_me_as_provider (const Field& f);
@@ -463,9 +492,17 @@ private:
   void compute_column_conservation_checks_data (const int dt);
 
   // Run an individual property check. The input property_check_category_name
+  // If known_result is not Pass, the check already failed when run in a batch
+  // (see below), possibly at a previous step (for lazy batches).
   void run_property_check (const prop_check_ptr&       property_check,
                            const CheckFailHandling     check_fail_handling,
-                           const PropertyCheckCategory property_check_category) const;
+                           const PropertyCheckCategory property_check_category,
+                           const CheckResult           known_result = CheckResult::Pass) const;
+
+  // Run a batch of property checks, fusing those that can be fused in one kernel.
+  // Checks that do not pass are run again individually, to get a detailed message.
+  void run_property_checks (PropertyCheckBatch&         checks,
+                            const PropertyCheckCategory property_check_category) const;
 
   // NOTE: all these members are private, so that derived classes cannot
   //       bypass checks from the base class by accessing the members directly.
@@ -494,9 +531,9 @@ private:
   std::set<GroupRequest>   m_required_group_requests;
   std::set<GroupRequest>   m_computed_group_requests;
 
-  // List of property checks for fields
-  std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_precondition_checks;
-  std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_postcondition_checks;
+  // Property checks for fields. Checks that allow it are run with a single kernel.
+  std::shared_ptr<PropertyCheckBatch> m_precondition_checks;
+  std::shared_ptr<PropertyCheckBatch> m_postcondition_checks;
 
   // Column local mass and energy conservation check
   std::pair<CheckFailHandling,prop_check_ptr> m_column_conservation_check;
@@ -525,6 +562,9 @@ private:
   // Whether we need to update time stamps at the end of the run method
   bool m_update_time_stamps = true;
 
+  // The execution space instance to use in run_impl
+  exec_space_type m_exec_space;
+
   // Log level for when property checks perform a repair
   ekat::logger::LogLevel  m_repair_log_level;
 };
@@ -338,15 +338,71 @@ void AtmProcDAG::cleanup () {
 }
 
 void AtmProcDAG::
-add_nodes (const group_type& atm_procs)
+get_fields_usage (const group_type& atm_procs,
+                  std::vector<std::set<FieldIdentifier>>& used,
+                  std::vector<std::set<FieldIdentifier>>& computed)
+{
+  cleanup ();
+
+  std::vector<int> first_nodes;
+  add_nodes(atm_procs,&first_nodes);
+  first_nodes.push_back(m_nodes.size());
+
+  const int num_procs = atm_procs.get_num_processes();
+  used.clear();
+  used.resize(num_procs);
+  computed.clear();
+  computed.resize(num_procs);
+  for (int i=0; i<num_procs; ++i) {
+    for (int id=first_nodes[i]; id<first_nodes[i+1]; ++id) {
+      const auto& node = m_nodes[id];
+      add_fids(node.computed,computed[i]);
+      add_fids(node.gr_computed,computed[i]);
+      add_fids(node.required,used[i]);
+      add_fids(node.gr_required,used[i]);
+    }
+    used[i].insert(computed[i].begin(),computed[i].end());
+  }
+}
+
+void AtmProcDAG::
+add_fids (const std::set<int>& fids, std::set<FieldIdentifier>& fids_set) const
+{
+  for (int fid_id : fids) {
+    const auto& fid = m_fids[fid_id];
+    auto it = m_gr_fid_to_group.find(fid);
+    if (it==m_gr_fid_to_group.end()) {
+      fids_set.insert(fid);
+    } else {
+      for (const auto& it_f : it->second.m_fields) {
+        fids_set.insert(it_f.second->get_header().get_identifier());
+      }
+    }
+  }
+}
+
+void AtmProcDAG::
+add_nodes (const group_type& atm_procs,
+           std::vector<int>* first_nodes)
 {
   const int num_procs = atm_procs.get_num_processes();
   const bool sequential = (atm_procs.get_schedule_type()==ScheduleType::Sequential);
 
-  EKAT_REQUIRE_MSG (sequential, "Error! Parallel splitting dag not yet supported.\n");
+  // In parallel splitting, all processes see the state from before the group,
+  // so a process cannot provide a field to another process in the same group.
+  // We reset the providers before each process, and merge the outputs of all
+  // processes once the whole group has been processed.
+  const auto providers_before = m_fid_to_last_provider;
+  auto providers_after = m_fid_to_last_provider;
 
   int id = m_nodes.size();
   for (int i=0; i<num_procs; ++i) {
+    if (not sequential) {
+      m_fid_to_last_provider = providers_before;
+    }
+    if (first_nodes!=nullptr) {
+      first_nodes->push_back(m_nodes.size());
+    }
     const auto proc = atm_procs.get_process(i);
     const bool is_group = (proc->type()==AtmosphereProcessType::Group);
     if (is_group) {
@@ -357,6 +413,7 @@ add_nodes (const group_type& atm_procs)
       // Note: no need to add remappers for this process, because
       //       the sub-group will have its remappers taken care of
       add_nodes(*group);
+      id = m_nodes.size();
     } else {
       // Create a node for the process
       // Node& node = m_nodes[proc->name()];
@@ -461,6 +518,19 @@ add_nodes (const group_type& atm_procs)
       }
       ++id;
     }
+
+    if (not sequential) {
+      for (const auto& it : m_fid_to_last_provider) {
+        auto prev = providers_before.find(it.first);
+        if (prev==providers_before.end() || prev->second!=it.second) {
+          providers_after[it.first] = it.second;
+        }
+      }
+    }
+  }
+
+  if (not sequential) {
+    m_fid_to_last_provider = providers_after;
   }
 }
 
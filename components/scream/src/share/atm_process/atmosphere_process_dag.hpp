@@ -21,6 +21,13 @@ public:
 
   void write_dag (const std::string& fname, const int verbosity = VERB_MAX) const;
 
+  // Create the dag of the group, and retrieve the fields used (required or computed)
+  // and computed by each of its processes. Nested groups are flattened, and bundled
+  // groups are expanded into their member fields.
+  void get_fields_usage (const group_type& atm_procs,
+                         std::vector<std::set<FieldIdentifier>>& used,
+                         std::vector<std::set<FieldIdentifier>>& computed);
+
   bool has_unmet_dependencies () const { return m_has_unmet_deps; }
   const std::map<int,std::set<int>>& unmet_deps () const {
     return m_unmet_deps;
@@ -30,7 +37,12 @@ protected:
 
   void cleanup ();
 
-  void add_nodes (const group_type& atm_procs);
+  // If first_nodes is not null, the id of the first node of each process is stored in it
+  void add_nodes (const group_type& atm_procs,
+                  std::vector<int>* first_nodes = nullptr);
+
+  // Add fids to the set, expanding bundled groups into their members
+  void add_fids (const std::set<int>& fids, std::set<FieldIdentifier>& fids_set) const;
 
   // Add fid to list of fields in the dag, and return its position.
   // If already stored, simply return its position
@@ -1,13 +1,135 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
+#include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/util/scream_array_utils.hpp"
 
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
 #include <memory>
+#include <thread>
 
 namespace scream {
 
+namespace {
+
+// Collect all the fields computed by an atm process, including group members.
+std::map<FieldIdentifier,Field>
+get_fields_computed (const AtmosphereProcess& proc)
+{
+  std::map<FieldIdentifier,Field> fields;
+  for (const auto& f : proc.get_fields_out()) {
+    fields.emplace(f.get_header().get_identifier(),f);
+  }
+  for (const auto& g : proc.get_groups_out()) {
+    for (const auto& it : g.m_fields) {
+      fields.emplace(it.second->get_header().get_identifier(),*it.second);
+    }
+  }
+  return fields;
+}
+
+// Whether kernels can be dispatched from several host threads at once,
+// each thread using its own instance of the default execution space.
+bool concurrent_dispatch_supported ()
+{
+  using ES = KokkosTypes<DefaultDevice>::ExeSpace;
+  if (not Kokkos::SpaceAccessibility<ES,Kokkos::HostSpace>::accessible) {
+    // Device backends: each instance has its own stream/queue
+    return true;
+  }
+#if defined(KOKKOS_ENABLE_SERIAL) && KOKKOS_VERSION>=40000
+  // Separate Serial instances can be used concurrently since Kokkos 4.0
+  return std::is_same<ES,Kokkos::Serial>::value;
+#else
+  // Host-parallel backends (OpenMP, Threads) cannot be entered by several threads
+  return false;
+#endif
+}
+
+// Computes acc += f - f0
+void accumulate_increment (const Field& acc, const Field& f, const Field& f0)
+{
+  using KT = KokkosTypes<DefaultDevice>;
+
+  const auto& layout = f.get_header().get_identifier().get_layout();
+  const auto extents = layout.extents();
+  KT::RangePolicy policy(0,layout.size());
+  switch (layout.rank()) {
+    case 1:
+    {
+      auto a  = acc.get_view<Real*>();
+      auto v  = f.get_view<const Real*>();
+      auto v0 = f0.get_view<const Real*>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+        a(i) += v(i) - v0(i);
+      });
+      break;
+    }
+    case 2:
+    {
+      auto a  = acc.get_view<Real**>();
+      auto v  = f.get_view<const Real**>();
+      auto v0 = f0.get_view<const Real**>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j;
+        unflatten_idx(idx,extents,i,j);
+        a(i,j) += v(i,j) - v0(i,j);
+      });
+      break;
+    }
+    case 3:
+    {
+      auto a  = acc.get_view<Real***>();
+      auto v  = f.get_view<const Real***>();
+      auto v0 = f0.get_view<const Real***>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k;
+        unflatten_idx(idx,extents,i,j,k);
+        a(i,j,k) += v(i,j,k) - v0(i,j,k);
+      });
+      break;
+    }
+    case 4:
+    {
+      auto a  = acc.get_view<Real****>();
+      auto v  = f.get_view<const Real****>();
+      auto v0 = f0.get_view<const Real****>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k,l;
+        unflatten_idx(idx,extents,i,j,k,l);
+        a(i,j,k,l) += v(i,j,k,l) - v0(i,j,k,l);
+      });
+      break;
+    }
+    case 5:
+    {
+      auto a  = acc.get_view<Real*****>();
+      auto v  = f.get_view<const Real*****>();
+      auto v0 = f0.get_view<const Real*****>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k,l,m;
+        unflatten_idx(idx,extents,i,j,k,l,m);
+        a(i,j,k,l,m) += v(i,j,k,l,m) - v0(i,j,k,l,m);
+      });
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Error! Unsupported field rank in parallel schedule accumulation.\n"
+          "  - field name: " + f.name() + "\n"
+          "  - field rank: " + std::to_string(layout.rank()) + "\n");
+  }
+}
+
+// Concurrently running processes get separate chunks of the buffer.
+// Pad each chunk, so that all chunks are suitably aligned for packs.
+size_t padded_buffer_size (const size_t num_bytes) {
+  constexpr size_t align = 128;
+  return ((num_bytes+align-1)/align)*align;
+}
+
+} // anonymous namespace
+
 AtmosphereProcessGroup::
 AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
@@ -25,7 +147,13 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
       m_group_schedule_type = ScheduleType::Sequential;
     } else if (m_params.get<std::string>("schedule_type") == "Parallel") {
       m_group_schedule_type = ScheduleType::Parallel;
-      ekat::error::runtime_abort("Error! Parallel schedule not yet implemented.\n");
+      m_concurrent_execution = m_params.get<bool>("enable_concurrent_execution",false);
+      if (m_concurrent_execution && not concurrent_dispatch_supported()) {
+        m_concurrent_execution = false;
+        log (LogLevel::warn,
+            "WARNING: concurrent execution of atm processes is not supported by the Kokkos backend.\n"
+            "  Processes in group '" + m_params.name() + "' will run one at a time.\n");
+      }
     } else {
       ekat::error::runtime_abort("Error! Invalid 'schedule_type'. Available choices are 'Parallel' and 'Sequential'.\n");
     }
@@ -43,25 +171,10 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
   // so we don't expect users to register the APG in the factory.
   apf.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
   for (int i=0; i<m_group_size; ++i) {
-    // The comm to be passed to the processes construction is
-    //  - the same as the comm of this APG, if num_entries=1 or sched_type=Sequential
-    //  - a sub-comm of this APG's comm otherwise
+    // The comm to be passed to the processes construction is the same as the comm of
+    // this APG. Even with Parallel schedule, all processes run on all ranks: parallelism
+    // happens on-node (see run_parallel).
     ekat::Comm proc_comm = m_comm;
-    if (m_group_schedule_type==ScheduleType::Parallel) {
-      // This is what's going to happen when we implment this:
-      //  - the processes in the group are going to be run in parallel
-      //  - each rank is assigned ONE atm process
-      //  - all the atm processes not assigned to this rank will be filled with
-      //    an instance of "RemoteProcessStub" (to be implemented),
-      //    which is a do-nothing class, only responsible to keep track of dependencies
-      //  - the input parameter list should specify for each atm process the number
-      //    of mpi ranks dedicated to it. Obviously, these numbers should add up
-      //    to the size of the input communicator.
-      //  - this class is then responsible of 'combining' the results togehter,
-      //    including remapping input/output fields to/from the sub-comm
-      //    distribution.
-      ekat::error::runtime_abort("Error! Parallel schedule type not yet implemented.\n");
-    }
 
     // Check if the i-th entry is a "named" atm proc or a group defined on the fly.
     // In the first case, the i-th entry of the string list is just a string,
@@ -293,6 +406,9 @@ setup_column_conservation_checks (const std::shared_ptr<MassAndEnergyColumnConse
 }
 
 void AtmosphereProcessGroup::initialize_impl (const RunType run_type) {
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    setup_parallel_schedule ();
+  }
   for (auto& atm_proc : m_atm_processes) {
     atm_proc->initialize(timestamp(),run_type);
 #ifdef SCREAM_HAS_MEMORY_USAGE
@@ -335,8 +451,217 @@ void AtmosphereProcessGroup::run_sequential (const Real dt) {
   }
 }
 
-void AtmosphereProcessGroup::run_parallel (const Real /* dt */) {
-  EKAT_REQUIRE_MSG (false,"Error! Parallel splitting not yet implemented.\n");
+void AtmosphereProcessGroup::run_parallel (const Real dt) {
+  // Same as in run_sequential
+  const bool do_update = do_update_time_stamp() &&
+                      (get_subcycle_iter()==get_num_subcycles()-1);
+  for (auto atm_proc : m_atm_processes) {
+    atm_proc->set_update_time_stamps(do_update);
+  }
+
+  // Save the shared fields state at the beginning of the step.
+  // Note: processes in m_concurrent_procs do not compute shared fields.
+  for (auto& sf : m_shared_fields) {
+    sf.backup.deep_copy(sf.f);
+    sf.accum.deep_copy(sf.f);
+    sf.dirty = false;
+  }
+
+  // Processes not computing shared fields cannot interfere with each other,
+  // nor with the processes that use the shared fields, since they run first.
+  // Those that support it run on separate threads, each one on its own
+  // execution space instance. Everything else (timers, property checks,
+  // logging, time stamps) is done on this thread.
+  std::vector<int> threaded_procs;
+  for (int iproc : m_concurrent_procs) {
+    auto proc = m_atm_processes[iproc];
+    if (m_concurrent_execution && proc->supports_concurrent_run() &&
+        not proc->has_column_conservation_check()) {
+      threaded_procs.push_back(iproc);
+    } else {
+      proc->run(dt);
+    }
+  }
+
+  if (threaded_procs.size()>1) {
+    // Kernels launched so far on the default instance must be done
+    Kokkos::fence();
+
+    const int num_threads = threaded_procs.size();
+    for (int iproc : threaded_procs) {
+      m_atm_processes[iproc]->run_begin(dt);
+    }
+    std::vector<std::exception_ptr> errors(num_threads);
+    std::vector<std::thread> threads;
+    for (int i=0; i<num_threads; ++i) {
+      threads.emplace_back([&,i]() {
+        try {
+          auto proc = m_atm_processes[threaded_procs[i]];
+          proc->run_subcycles(dt);
+          proc->exec_space().fence();
+        } catch (...) {
+          errors[i] = std::current_exception();
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    for (const auto& e : errors) {
+      if (e) {
+        std::rethrow_exception(e);
+      }
+    }
+    for (int iproc : threaded_procs) {
+      m_atm_processes[iproc]->run_end(dt);
+    }
+  } else if (threaded_procs.size()==1) {
+    m_atm_processes[threaded_procs[0]]->run(dt);
+  }
+  if (m_concurrent_execution) {
+    // Processes may have used their own execution space instance, so make
+    // sure they are done before the next processes use their outputs.
+    Kokkos::fence();
+  }
+
+  // Processes computing shared fields run one at a time. Each one of them
+  // must see the shared fields as they were at the beginning of the step,
+  // and its increments are accumulated.
+  for (int iproc : m_serial_procs) {
+    for (int isf : m_proc_shared_fields[iproc]) {
+      auto& sf = m_shared_fields[isf];
+      if (sf.dirty) {
+        sf.f.deep_copy(sf.backup);
+        sf.dirty = false;
+      }
+    }
+
+    m_atm_processes[iproc]->run(dt);
+
+    for (int isf : m_proc_shared_fields_out[iproc]) {
+      auto& sf = m_shared_fields[isf];
+      if (sf.num_writers==1) {
+        // No need to accumulate: this is the final value (and it's bfb).
+        sf.accum.deep_copy(sf.f);
+      } else {
+        accumulate_increment(sf.accum,sf.f,sf.backup);
+      }
+      sf.dirty = true;
+    }
+  }
+
+  // Set the final value of the shared fields
+  for (auto& sf : m_shared_fields) {
+    sf.f.deep_copy(sf.accum);
+  }
+}
+
+void AtmosphereProcessGroup::
+classify_processes (std::vector<int>& concurrent_procs,
+                    std::vector<int>& serial_procs,
+                    std::vector<std::set<FieldIdentifier>>& used,
+                    std::vector<std::set<FieldIdentifier>>& computed) const
+{
+  // A field is 'shared' if it is computed by one process, and used
+  // (required or computed) by another process in the group.
+  // Processes that compute shared fields must see a 'fresh' version of them.
+  // All other processes can run at the same time, since they only write
+  // fields that nobody else in the group looks at.
+  AtmProcDAG dag;
+  dag.get_fields_usage(*this,used,computed);
+
+  concurrent_procs.clear();
+  serial_procs.clear();
+  for (int i=0; i<m_group_size; ++i) {
+    bool computes_shared = false;
+    for (const auto& fid : computed[i]) {
+      for (int j=0; j<m_group_size && not computes_shared; ++j) {
+        computes_shared = j!=i && used[j].count(fid)==1;
+      }
+      if (computes_shared) {
+        break;
+      }
+    }
+    if (computes_shared) {
+      serial_procs.push_back(i);
+    } else {
+      concurrent_procs.push_back(i);
+    }
+  }
+}
+
+std::vector<int> AtmosphereProcessGroup::get_threaded_procs_candidates () const
+{
+  std::vector<int> candidates;
+  if (m_concurrent_execution) {
+    std::vector<int> concurrent_procs, serial_procs;
+    std::vector<std::set<FieldIdentifier>> used, computed;
+    classify_processes(concurrent_procs,serial_procs,used,computed);
+    for (int i : concurrent_procs) {
+      if (m_atm_processes[i]->supports_concurrent_run()) {
+        candidates.push_back(i);
+      }
+    }
+  }
+  return candidates;
+}
+
+void AtmosphereProcessGroup::setup_parallel_schedule ()
+{
+  std::vector<std::set<FieldIdentifier>> used, computed;
+  classify_processes(m_concurrent_procs,m_serial_procs,used,computed);
+
+  // Processes that may run on separate threads get their own execution space instance
+  for (int i : get_threaded_procs_candidates()) {
+    auto instances = Kokkos::Experimental::partition_space(exec_space_type(),1);
+    m_atm_processes[i]->set_exec_space(instances[0]);
+  }
+
+  // Gather the fields computed by serial processes, which are used by other processes
+  std::map<FieldIdentifier,int> shared_idx;
+  m_proc_shared_fields.clear();
+  m_proc_shared_fields.resize(m_group_size);
+  m_proc_shared_fields_out.clear();
+  m_proc_shared_fields_out.resize(m_group_size);
+  m_shared_fields.clear();
+  for (int i : m_serial_procs) {
+    const auto fields_out = get_fields_computed(*m_atm_processes[i]);
+    for (const auto& fid : computed[i]) {
+      bool used_by_others = false;
+      for (int j=0; j<m_group_size && not used_by_others; ++j) {
+        used_by_others = j!=i && used[j].count(fid)==1;
+      }
+      if (not used_by_others) {
+        continue;
+      }
+
+      if (shared_idx.count(fid)==0) {
+        EKAT_REQUIRE_MSG (fid.data_type()==DataType::RealType,
+            "Error! Parallel schedule only supports shared fields of Real type.\n"
+            "  - field name: " + fid.name() + "\n"
+            "  - atm group : " + name() + "\n");
+        SharedField sf;
+        sf.f = fields_out.at(fid);
+        sf.backup = sf.f.clone();
+        sf.accum  = sf.f.clone();
+        shared_idx[fid] = m_shared_fields.size();
+        m_shared_fields.push_back(sf);
+      }
+      const int isf = shared_idx.at(fid);
+      ++m_shared_fields[isf].num_writers;
+      m_proc_shared_fields_out[i].push_back(isf);
+    }
+  }
+
+  // For each serial process, gather all the shared fields it uses (in or out).
+  for (int i : m_serial_procs) {
+    for (const auto& fid : used[i]) {
+      auto found = shared_idx.find(fid);
+      if (found!=shared_idx.end()) {
+        m_proc_shared_fields[i].push_back(found->second);
+      }
+    }
+  }
 }
 
 void AtmosphereProcessGroup::finalize_impl (/* what inputs? */) {
@@ -357,6 +682,7 @@ set_required_field (const Field& f) {
     // In parallel splitting, all required fields are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_field(f);
+    return;
   }
 
   // Find the first process that requires this group
@@ -425,6 +751,7 @@ set_required_group (const FieldGroup& group) {
     // In parallel splitting, all required group are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_group(group);
+    return;
   }
 
   // Find the first process that requires this group
@@ -595,8 +922,23 @@ process_required_field (const FieldRequest& req) {
 size_t AtmosphereProcessGroup::requested_buffer_size_in_bytes () const
 {
   size_t buf_size = 0;
-  for (const auto& proc : m_atm_processes) {
-    buf_size = std::max(buf_size,proc->requested_buffer_size_in_bytes());
+  if (m_group_schedule_type==ScheduleType::Parallel && m_concurrent_execution) {
+    // Processes that may run on separate threads cannot share memory
+    const auto threaded_procs = get_threaded_procs_candidates();
+    size_t threaded_size = 0;
+    for (int i=0; i<m_group_size; ++i) {
+      const auto size = m_atm_processes[i]->requested_buffer_size_in_bytes();
+      if (ekat::contains(threaded_procs,i)) {
+        threaded_size += padded_buffer_size(size);
+      } else {
+        buf_size = std::max(buf_size,size);
+      }
+    }
+    buf_size = std::max(buf_size,threaded_size);
+  } else {
+    for (const auto& proc : m_atm_processes) {
+      buf_size = std::max(buf_size,proc->requested_buffer_size_in_bytes());
+    }
   }
 
   return buf_size;
@@ -604,8 +946,22 @@ size_t AtmosphereProcessGroup::requested_buffer_size_in_bytes () const
 
 void AtmosphereProcessGroup::
 init_buffers(const ATMBufferManager& buffer_manager) {
-  for (auto& atm_proc : m_atm_processes) {
-    atm_proc->init_buffers(buffer_manager);
+  if (m_group_schedule_type==ScheduleType::Parallel && m_concurrent_execution) {
+    const auto threaded_procs = get_threaded_procs_candidates();
+    size_t offset = 0;
+    for (int i=0; i<m_group_size; ++i) {
+      if (ekat::contains(threaded_procs,i)) {
+        const auto size = padded_buffer_size(m_atm_processes[i]->requested_buffer_size_in_bytes());
+        m_atm_processes[i]->init_buffers(ATMBufferManager(buffer_manager,offset,size));
+        offset += size;
+      } else {
+        m_atm_processes[i]->init_buffers(buffer_manager);
+      }
+    }
+  } else {
+    for (auto& atm_proc : m_atm_processes) {
+      atm_proc->init_buffers(buffer_manager);
+    }
   }
 }
 
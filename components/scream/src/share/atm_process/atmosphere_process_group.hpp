@@ -24,6 +24,20 @@ namespace scream
  *  The only caveat is required fields in sequential scheduling: if an atm proc
  *  requires a field that is computed by a previous atm proc in the group,
  *  that field is not exposed as a required field of the group.
+ *
+ *  In parallel scheduling, all processes in the group see the same input state,
+ *  namely the state at the beginning of the group step. If a field is computed by
+ *  one process and used by another ('shared' field), the processes computing it
+ *  run one at a time, each on a fresh copy of the shared fields, and the increments
+ *  of all processes are accumulated (parallel splitting). All other processes only
+ *  compute fields that no other process in the group looks at, so they can run
+ *  at the same time. If 'enable_concurrent_execution' is true, those that support
+ *  it (see AtmosphereProcess::supports_concurrent_run) are run concurrently on
+ *  separate host threads, each with its own execution space instance and its own
+ *  chunk of the memory buffer. Timers, property checks, and time stamps updates are
+ *  still done on the main thread. Concurrent execution is only enabled if the Kokkos
+ *  backend supports dispatching kernels from multiple threads (device backends, and
+ *  Serial since Kokkos 4.0); otherwise, all processes run one at a time.
  */
 
 class AtmosphereProcessGroup : public AtmosphereProcess
@@ -58,6 +72,9 @@ public:
 
   ScheduleType get_schedule_type () const { return m_group_schedule_type; }
 
+  // Whether processes in a Parallel group can run on separate threads
+  bool concurrent_execution_enabled () const { return m_concurrent_execution; }
+
   // Computes total number of bytes needed for local variables
   size_t requested_buffer_size_in_bytes () const;
 
@@ -102,6 +119,17 @@ protected:
   void run_sequential (const Real dt);
   void run_parallel   (const Real dt);
 
+  // Parallel schedule: split processes in those that compute 'shared' fields,
+  // which must run serially, and those that can run concurrently. The fields
+  // used/computed by each process are retrieved from the AtmProcDAG of the group.
+  void classify_processes (std::vector<int>& concurrent_procs,
+                           std::vector<int>& serial_procs,
+                           std::vector<std::set<FieldIdentifier>>& used,
+                           std::vector<std::set<FieldIdentifier>>& computed) const;
+  // The processes that may run on separate threads (see run_parallel)
+  std::vector<int> get_threaded_procs_candidates () const;
+  void setup_parallel_schedule ();
+
   // The methods to set the fields/groups in the right processes of the group
   void set_required_field_impl (const Field& f);
   void set_computed_field_impl (const Field& f);
@@ -117,6 +145,21 @@ protected:
 
   // The schedule type: Parallel vs Sequential
   ScheduleType   m_group_schedule_type;
+
+  // Parallel schedule data
+  struct SharedField {
+    Field   f;                // The field computed by the atm procs
+    Field   backup;           // The field value at the beginning of the step
+    Field   accum;            // The accumulated result of all procs computing f
+    int     num_writers = 0;
+    bool    dirty = false;    // Whether f was changed since backup was restored
+  };
+  bool                            m_concurrent_execution = false;
+  std::vector<int>                m_concurrent_procs;
+  std::vector<int>                m_serial_procs;
+  std::vector<SharedField>        m_shared_fields;
+  std::vector<std::vector<int>>   m_proc_shared_fields;       // All shared fields used by each proc
+  std::vector<std::vector<int>>   m_proc_shared_fields_out;   // Shared fields computed by each proc
 };
 
 } // namespace scream
@@ -1,6 +1,9 @@
 #include "share/field/field.hpp"
+#include "share/field/field_arena.hpp"
 #include "share/util/scream_utils.hpp"
 
+#include <atomic>
+
 namespace scream
 {
 
@@ -44,13 +47,37 @@ Field::clone() const {
   return f;
 }
 
+namespace {
+// Shared by all fields. Syncs may happen from concurrently running processes.
+std::atomic<long long> s_bytes_to_host(0);
+std::atomic<long long> s_bytes_to_dev(0);
+std::atomic<long long> s_num_skipped_syncs(0);
+}
+
 void Field::
 sync_to_host () const {
   // Sanity check
   EKAT_REQUIRE_MSG (is_allocated(),
       "Error! Input field must be allocated in order to sync host and device views.\n");
 
+  // On host-space builds, the host view *is* the device view
+  if (m_data.h_view.data()==m_data.d_view.data()) {
+    return;
+  }
+
+  auto& state = *m_data.sync_state;
+  const auto& ts = get_header().get_tracking().get_time_stamp();
+  if (not state.dev_modified && ts==state.ts_at_sync) {
+    ++s_num_skipped_syncs;
+    return;
+  }
+
   Kokkos::deep_copy(m_data.h_view,m_data.d_view);
+  s_bytes_to_host += m_data.d_view.size();
+
+  state.dev_modified  = false;
+  state.host_modified = false;
+  state.ts_at_sync    = ts;
 }
 
 void Field::
@@ -59,8 +86,38 @@ sync_to_dev () const {
   EKAT_REQUIRE_MSG (is_allocated(),
       "Error! Input field must be allocated in order to sync host and device views.\n");
 
-  // Ensure host view was created (lazy construction)
+  // On host-space builds, the host view *is* the device view
+  if (m_data.h_view.data()==m_data.d_view.data()) {
+    return;
+  }
+
+  auto& state = *m_data.sync_state;
+  if (not state.host_modified && not state.host_untracked) {
+    ++s_num_skipped_syncs;
+    return;
+  }
+
   Kokkos::deep_copy(m_data.d_view,m_data.h_view);
+  s_bytes_to_dev += m_data.h_view.size();
+
+  // Both sides now store the same data
+  state.dev_modified  = false;
+  state.host_modified = false;
+  state.ts_at_sync    = get_header().get_tracking().get_time_stamp();
+}
+
+auto Field::get_sync_stats () -> sync_stats_t {
+  sync_stats_t stats;
+  stats.bytes_to_host = s_bytes_to_host;
+  stats.bytes_to_dev  = s_bytes_to_dev;
+  stats.num_skipped   = s_num_skipped_syncs;
+  return stats;
+}
+
+void Field::reset_sync_stats () {
+  s_bytes_to_host = 0;
+  s_bytes_to_dev  = 0;
+  s_num_skipped_syncs = 0;
 }
 
 Field Field::
@@ -125,6 +182,33 @@ bool Field::equivalent(const Field& rhs) const
 }
 
 void Field::allocate_view ()
+{
+  const auto view_dim = commit_alloc_prop ();
+
+  // Create the view, by quering allocation properties for the allocation size
+  const auto& id = m_header->get_identifier();
+  m_data.d_view = decltype(m_data.d_view)(id.name(),view_dim);
+  m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
+  m_data.sync_state = std::make_shared<sync_state_t>();
+}
+
+void Field::allocate_view (FieldArena& arena)
+{
+  const auto view_dim = commit_alloc_prop ();
+
+  // Let the arena first-touch the field one column at a time, one pack at a time
+  using namespace ShortFieldTagsNames;
+  const auto& layout = m_header->get_identifier().get_layout();
+  const auto& ap     = m_header->get_alloc_properties();
+  const int ncols = layout.rank()>0 && layout.tag(0)==COL ? layout.dim(0) : 1;
+  const int chunk_bytes = ap.get_largest_pack_size()*get_type_size(data_type());
+
+  arena.carve(view_dim,FieldArena::get_alignment(*this),ncols,chunk_bytes,
+              m_data.d_view,m_data.h_view);
+  m_data.sync_state = std::make_shared<sync_state_t>();
+}
+
+long long Field::commit_alloc_prop ()
 {
   // Not sure if simply returning would be safe enough. Re-allocating
   // would definitely be error prone (someone may have already gotten
@@ -145,11 +229,7 @@ void Field::allocate_view ()
   // Commit the allocation properties
   alloc_prop.commit(layout);
 
-  // Create the view, by quering allocation properties for the allocation size
-  const auto view_dim = alloc_prop.get_alloc_size();
-
-  m_data.d_view = decltype(m_data.d_view)(id.name(),view_dim);
-  m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
+  return alloc_prop.get_alloc_size();
 }
 
 } // namespace scream
@@ -24,6 +24,8 @@ enum HostOrDevice {
   Host
 };
 
+class FieldArena;
+
 // ======================== FIELD ======================== //
 
 // A field is composed of metadata info (the header) and a pointer to a view.
@@ -59,6 +61,19 @@ public:
   using view_host_t = typename kt_host::template view<DT,MT>;
 
 private:
+  // Modify/sync bookkeeping of host and device views, shared by all the
+  // copies and subfields of a field (they all store the same views).
+  // The device is considered modified if someone asked for it explicitly,
+  // or if the field time stamp changed since the last sync. Since host
+  // views are rarely used, once a writable host view is handed out we stop
+  // trying to track host modifications, and always consider the host modified.
+  struct sync_state_t {
+    bool            dev_modified   = true;
+    bool            host_modified  = false;
+    bool            host_untracked = false;
+    util::TimeStamp ts_at_sync;
+  };
+
   // A bare DualView-like struct. This is an impl detail, so don't expose it.
   // NOTE: we could use DualView, but all we need is a container-like struct.
   template<typename DT, typename MT = Kokkos::MemoryManaged>
@@ -66,6 +81,8 @@ private:
     view_dev_t<DT,MT>   d_view;
     view_host_t<DT,MT>  h_view;
 
+    std::shared_ptr<sync_state_t> sync_state;
+
     template<HostOrDevice HD>
     const if_t<HD==Device,view_dev_t<DT,MT>>& get_view() const {
       return d_view;
@@ -148,7 +165,12 @@ public:
     EKAT_REQUIRE_MSG (not m_is_read_only || std::is_const<ST>::value,
         "Error! Cannot get a non-const raw pointer to the field data if the field is read-only.\n");
 
-    return reinterpret_cast<ST*>(get_view_impl<HD>().data());
+    auto ptr = reinterpret_cast<ST*>(get_view_impl<HD>().data());
+    if (not std::is_const<ST>::value) {
+      modify_on_access<HD>();
+    }
+
+    return ptr;
   }
 
   // WARNING: this is a power-user method. Its implementation, including assumptions
@@ -165,17 +187,41 @@ public:
     EKAT_REQUIRE_MSG ((field_valid_data_types().at<nonconst_ST>()==m_header->get_identifier().data_type()
                        or std::is_same<nonconst_ST,char>::value),
 		      "Error! Attempt to access raw field pointere with the wrong scalar type.\n");
-    
-    return reinterpret_cast<ST*>(get_view_impl<HD>().data());
+
+    auto ptr = reinterpret_cast<ST*>(get_view_impl<HD>().data());
+    if (not std::is_const<ST>::value) {
+      modify_on_access<HD>();
+    }
+
+    return ptr;
   }
 
   // If someone needs the host view, some sync routines might be needed.
-  // Note: this class takes no responsibility in keeping track of whether
-  //       a sync is required in either direction. Mainly because we expect
-  //       host views to be seldom used, and even less frequently modified.
+  // A sync is a no-op if the destination is already up to date, and on
+  // builds where host and device share the same memory space.
+  // Note: getting a non-const view, deep_copy, and updating the field time
+  //       stamp all flag the corresponding side as modified. If you write to
+  //       the device view via a view obtained earlier on, you must call
+  //       modify<Device>() before syncing. A new time stamp alone is not enough
+  //       if the field was already synced at that time. AtmosphereProcess does
+  //       this for all its computed fields at the end of each run.
   void sync_to_host () const;
   void sync_to_dev () const;
 
+  // Flag the data on host/device as modified, so that the next sync copies it
+  template<HostOrDevice HD>
+  void modify () const;
+
+  // Number of bytes actually copied by sync_to_host/sync_to_dev (across all
+  // fields), and number of syncs that were skipped, since the last reset.
+  struct sync_stats_t {
+    long long bytes_to_host = 0;
+    long long bytes_to_dev  = 0;
+    long long num_skipped   = 0;
+  };
+  static sync_stats_t get_sync_stats ();
+  static void reset_sync_stats ();
+
   // Set the field to a constant value (on host or device)
   template<typename T, HostOrDevice HD = Device>
   void deep_copy (const T value);
@@ -232,8 +278,18 @@ public:
   // Allocate the actual view
   void allocate_view ();
 
+  // Carve the view out of a (larger) arena allocation
+  void allocate_view (FieldArena& arena);
+
 protected:
 
+  // Checks that we can allocate, commits the alloc props, and returns the alloc size
+  long long commit_alloc_prop ();
+
+  // Called when a writable view/pointer on HD is handed out
+  template<HostOrDevice HD>
+  void modify_on_access () const;
+
   template<typename ST, HostOrDevice HD = Device>
   void deep_copy_impl (const ST value);
 
@@ -345,9 +401,35 @@ auto Field::get_view () const
   EKAT_REQUIRE_MSG (DstRankDynamic>0 || alloc_prop.contiguous(),
       "Error! Cannot use all compile-time dimensions for strided views.\n");
 
+  if (not std::is_const<DstValueType>::value) {
+    modify_on_access<HD>();
+  }
+
   return DstView(view_ND);
 }
 
+template<HostOrDevice HD>
+void Field::modify () const {
+  EKAT_REQUIRE_MSG (is_allocated(),
+      "Error! Cannot flag a field as modified before allocation happens.\n");
+
+  if (HD==Device) {
+    m_data.sync_state->dev_modified = true;
+  } else {
+    m_data.sync_state->host_modified = true;
+  }
+}
+
+template<HostOrDevice HD>
+void Field::modify_on_access () const {
+  if (HD==Device) {
+    m_data.sync_state->dev_modified = true;
+  } else {
+    // We can't see writes through host views obtained earlier on
+    m_data.sync_state->host_untracked = true;
+  }
+}
+
 template<HostOrDevice HD>
 void Field::
 deep_copy (const Field& field_src) {
@@ -370,6 +452,8 @@ deep_copy (const Field& field_src) {
     default:
       EKAT_ERROR_MSG ("Error! Unrecognized field data type in Field::deep_copy.\n");
   }
+
+  modify<HD>();
 }
 
 template<typename ST, HostOrDevice HD>
@@ -404,6 +488,8 @@ deep_copy (const ST value) {
     default:
       EKAT_ERROR_MSG ("Error! Unrecognized field data type in Field::deep_copy.\n");
   }
+
+  modify<HD>();
 }
 
 template<typename ST, HostOrDevice HD>
@@ -0,0 +1,132 @@
+#include "share/field/field_arena.hpp"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+
+namespace scream {
+
+namespace {
+long long align_up (const long long n, const long long alignment) {
+  return ((n + alignment - 1) / alignment) * alignment;
+}
+}
+
+FieldArena::
+FieldArena (const std::string& name, const long long capacity)
+ : m_name (name)
+{
+  EKAT_REQUIRE_MSG (capacity>0,
+      "Error! Invalid field arena capacity: " + std::to_string(capacity) + ".\n");
+
+  using mem_space = typename view_dev_t::memory_space;
+  constexpr bool host_accessible =
+    Kokkos::SpaceAccessibility<Kokkos::HostSpace,mem_space>::accessible;
+
+  // If we can use huge pages, round up the capacity, and allocate one more
+  // huge page, so that we can start the slab at a huge page boundary.
+  long long offset = 0;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  m_huge_pages = host_accessible;
+#endif
+  if (m_huge_pages) {
+    m_capacity = align_up(capacity,huge_page_size);
+    m_alloc = view_dev_t(Kokkos::view_alloc(Kokkos::WithoutInitializing,name),
+                         m_capacity+huge_page_size);
+    const auto ptr = reinterpret_cast<std::uintptr_t>(m_alloc.data());
+    offset = align_up(ptr,huge_page_size) - ptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // This is only a hint. If THP are not available, we simply get regular pages.
+    if (madvise(m_alloc.data()+offset,m_capacity,MADV_HUGEPAGE)!=0) {
+      m_huge_pages = false;
+    }
+#endif
+  } else {
+    m_capacity = capacity;
+    m_alloc = view_dev_t(Kokkos::view_alloc(Kokkos::WithoutInitializing,name),m_capacity);
+  }
+  m_d_slab = Kokkos::subview(m_alloc,std::make_pair(offset,offset+m_capacity));
+
+  // Note: the slab is first-touched one field at a time, as fields are carved
+  m_h_slab = Kokkos::create_mirror_view(m_d_slab);
+}
+
+int FieldArena::get_alignment (const Field& f) {
+  // Cache line alignment, or more if the largest pack is larger
+  const auto& ap = f.get_header().get_alloc_properties();
+  const int pack_bytes = ap.get_largest_pack_size()*get_type_size(f.data_type());
+  return std::max(64,pack_bytes);
+}
+
+long long FieldArena::required_bytes (const Field& f) {
+  const auto& ap = f.get_header().get_alloc_properties();
+  return ap.get_alloc_size() + get_alignment(f);
+}
+
+bool FieldArena::can_fit (const Field& f) const {
+  return m_used + required_bytes(f) <= m_capacity;
+}
+
+void FieldArena::
+carve (const long long nbytes, const int alignment,
+       const int ncols, const int chunk_bytes,
+       view_dev_t& d_view, view_host_t& h_view)
+{
+  // Align the actual address, since the slab start may be less aligned than requested
+  const auto base  = reinterpret_cast<std::uintptr_t>(m_d_slab.data());
+  const auto begin = align_up(base+m_used,alignment) - base;
+  const auto end   = begin + nbytes;
+  EKAT_REQUIRE_MSG (end<=m_capacity,
+      "Error! Not enough room left in field arena.\n"
+      "  - arena name: " + m_name + "\n"
+      "  - capacity  : " + std::to_string(m_capacity) + "\n"
+      "  - used      : " + std::to_string(m_used) + "\n"
+      "  - requested : " + std::to_string(nbytes) + "\n");
+
+  d_view = Kokkos::subview(m_d_slab,std::make_pair(begin,end));
+  h_view = Kokkos::subview(m_h_slab,std::make_pair(begin,end));
+
+  m_used = end;
+  ++m_num_fields;
+
+  first_touch(d_view,ncols,chunk_bytes);
+}
+
+void FieldArena::
+first_touch (const view_dev_t& v, const int ncols, const int chunk_bytes)
+{
+  using exe_space = typename view_dev_t::execution_space;
+  using ESU = ekat::ExeSpaceUtils<exe_space>;
+  using MemberType = typename ESU::TeamPolicy::member_type;
+
+  const long long nbytes = v.size();
+  if (ncols<=1 || nbytes%(ncols*static_cast<long long>(chunk_bytes))!=0) {
+    // No columns to distribute (or an unexpected alloc size): touch the view as a whole
+    Kokkos::parallel_for("FieldArena::first_touch",
+                         Kokkos::RangePolicy<exe_space>(0,nbytes),
+                         KOKKOS_LAMBDA(const long long i) {
+      v(i) = 0;
+    });
+  } else {
+    // Same policy as the physics kernels: one team per column, and the team
+    // threads zero the column one chunk (i.e., one pack) at a time
+    const int nchunks = nbytes / (ncols*static_cast<long long>(chunk_bytes));
+    const auto policy = ESU::get_default_team_policy(ncols,nchunks);
+    Kokkos::parallel_for("FieldArena::first_touch", policy,
+                         KOKKOS_LAMBDA(const MemberType& team) {
+      const long long col_beg = team.league_rank()*static_cast<long long>(nchunks)*chunk_bytes;
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nchunks),[&](const int k) {
+        const long long beg = col_beg + k*static_cast<long long>(chunk_bytes);
+        for (int b=0; b<chunk_bytes; ++b) {
+          v(beg+b) = 0;
+        }
+      });
+    });
+  }
+  Kokkos::fence();
+}
+
+} // namespace scream
@@ -0,0 +1,81 @@
+#ifndef SCREAM_FIELD_ARENA_HPP
+#define SCREAM_FIELD_ARENA_HPP
+
+#include "share/field/field.hpp"
+
+#include <string>
+
+namespace scream {
+
+/*
+ * A FieldArena is a large allocation, out of which many fields can be carved.
+ *
+ * Allocating all fields out of few large arenas (rather than allocating
+ * each field as an independent view) reduces heap fragmentation, and, if
+ * the arena is backed by 2MB pages, improves TLB behavior.
+ *
+ * Each field is first-touched (zeroed) in parallel when it is carved, by the
+ * execution space of the default device, with one team per column (as in the
+ * physics kernels). On NUMA systems, this places the pages of each column close
+ * to the threads that will later access them (assuming a static schedule).
+ *
+ * Huge pages are only requested if the device memory space is host-accessible,
+ * and the OS supports transparent huge pages (via madvise).
+ */
+
+class FieldArena {
+public:
+  using view_dev_t  = Field::view_dev_t<char*>;
+  using view_host_t = Field::view_host_t<char*>;
+
+  static constexpr long long huge_page_size = 2*1024*1024;
+
+  FieldArena (const std::string& name, const long long capacity);
+
+  // The alignment used for a field, which accounts for its largest pack size.
+  // NOTE: the field alloc props must be committed.
+  static int get_alignment (const Field& f);
+
+  // The number of bytes needed in an arena to carve f (including alignment)
+  static long long required_bytes (const Field& f);
+
+  // Whether there is enough room left in this arena to carve f.
+  bool can_fit (const Field& f) const;
+
+  // Get (device and host) views of nbytes, whose start is aligned to
+  // the given alignment. Throws if there is not enough room left.
+  // The view is first-touched as ncols columns, chunk_bytes at a time.
+  void carve (const long long nbytes, const int alignment,
+              const int ncols, const int chunk_bytes,
+              view_dev_t& d_view, view_host_t& h_view);
+
+  const std::string& name () const { return m_name; }
+  long long capacity () const { return m_capacity; }
+  long long used () const { return m_used; }
+  int num_fields () const { return m_num_fields; }
+  bool uses_huge_pages () const { return m_huge_pages; }
+
+// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+#ifndef EAMXX_ENABLE_GPU
+protected:
+#endif
+  static void first_touch (const view_dev_t& v, const int ncols, const int chunk_bytes);
+
+protected:
+
+  std::string   m_name;
+
+  // The whole allocation, and the views of the usable part of it
+  view_dev_t    m_alloc;
+  view_dev_t    m_d_slab;
+  view_host_t   m_h_slab;
+
+  long long     m_capacity;
+  long long     m_used       = 0;
+  int           m_num_fields = 0;
+  bool          m_huge_pages = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_ARENA_HPP
@@ -552,7 +552,7 @@ void FieldManager::registration_ends ()
       }
 
       // Allocate
-      C->allocate_view();
+      allocate_field(*C);
 
       // Note: as of 02/2021, idim should *always* be 1, but we store it just in case,
       //       to avoid bugs in the future.
@@ -652,7 +652,7 @@ void FieldManager::registration_ends ()
     for (const auto& req : m_group_requests.at(gname)) {
       G_ap.request_allocation(req.pack_size);
     }
-    G->allocate_view();
+    allocate_field(*G);
 
     // Now, update the group info of the copied group, by setting the
     // correct subview_idx, in case the user wants to extract the
@@ -678,7 +678,7 @@ void FieldManager::registration_ends ()
       continue;
     }
     // A brand new field. Allocate it
-    it.second->allocate_view();
+    allocate_field(*it.second);
   }
 
   for (const auto& it : m_field_groups) {
@@ -704,11 +704,41 @@ void FieldManager::clean_up() {
   // Clear the maps
   m_fields.clear();
   m_field_groups.clear();
+  m_arenas.clear();
 
   // Reset repo state
   m_repo_state = RepoState::Clean;
 }
 
+void FieldManager::set_arena_size (const long long nbytes) {
+  EKAT_REQUIRE_MSG (m_repo_state!=RepoState::Closed,
+      "Error! Cannot set the arena size after registration_ends() has been called.\n");
+  EKAT_REQUIRE_MSG (nbytes>=0,
+      "Error! Invalid arena size: " + std::to_string(nbytes) + ".\n");
+
+  m_arena_size = nbytes;
+}
+
+void FieldManager::allocate_field (Field& f) {
+  if (m_arena_size==0) {
+    f.allocate_view();
+    return;
+  }
+
+  // We need the alloc size to pick an arena
+  const auto& layout = f.get_header().get_identifier().get_layout_ptr();
+  f.get_header().get_alloc_properties().commit(layout);
+
+  // Fields are carved in order, so only the last arena may have room left.
+  // If a field is larger than the arena size, it gets an arena of its own.
+  if (m_arenas.size()==0 || not m_arenas.back()->can_fit(f)) {
+    const auto capacity = std::max(m_arena_size,FieldArena::required_bytes(f));
+    const auto name = m_grid->name() + "_field_arena_" + std::to_string(m_arenas.size());
+    m_arenas.push_back(std::make_shared<FieldArena>(name,capacity));
+  }
+  f.allocate_view(*m_arenas.back());
+}
+
 void FieldManager::add_field (const Field& f) {
   // This method has a few restrictions on the input field.
   EKAT_REQUIRE_MSG (m_repo_state==RepoState::Closed,
@@ -3,6 +3,7 @@
 
 #include "share/grid/abstract_grid.hpp"
 #include "share/field/field.hpp"
+#include "share/field/field_arena.hpp"
 #include "share/field/field_group.hpp"
 #include "share/field/field_request.hpp"
 #include "share/util/scream_utils.hpp"
@@ -11,6 +12,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 namespace scream
 {
@@ -56,6 +58,12 @@ public:
   void registration_ends ();
   void clean_up ();
 
+  // If nbytes>0, registration_ends() carves all fields out of few large
+  // arenas of (at least) nbytes each, rather than allocating them independently.
+  // Must be called before registration_ends().
+  void set_arena_size (const long long nbytes);
+  const std::vector<std::shared_ptr<FieldArena>>& get_arenas () const { return m_arenas; }
+
   // Adds an externally-constructed field to the FieldManager. Allows the FM
   // to make the field available as if it had been built with the usual
   // registration procedures.
@@ -107,6 +115,9 @@ protected:
 
   void pre_process_group_requests ();
 
+  // Allocate a field, possibly carving it out of an arena
+  void allocate_field (Field& f);
+
   // The state of the repository
   RepoState           m_repo_state;
 
@@ -130,6 +141,10 @@ protected:
 
   // The grid where the fields in this FM live
   std::shared_ptr<const AbstractGrid> m_grid;
+
+  // If m_arena_size>0, fields are carved out of these arenas
+  long long                                 m_arena_size = 0;
+  std::vector<std::shared_ptr<FieldArena>>  m_arenas;
 };
 
 } // namespace scream
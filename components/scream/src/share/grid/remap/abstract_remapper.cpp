@@ -118,11 +118,20 @@ void AbstractRemapper::remap (const bool forward) {
                        "Error! Forward remap is not allowed by this remapper.\n"
                        "       This means that some fields on the target grid are read-only.\n");
       do_remap_fwd ();
+
+      // Remappers write into the views directly, so flag the tgt device data as modified
+      for (int i=0; i<m_num_fields; ++i) {
+        get_tgt_field(i).modify<Device>();
+      }
     } else {
       EKAT_REQUIRE_MSG (m_bwd_allowed,
                        "Error! Backward remap is not allowed by this remapper.\n"
                        "       This means that some fields on the source grid are read-only.\n");
       do_remap_bwd ();
+
+      for (int i=0; i<m_num_fields; ++i) {
+        get_src_field(i).modify<Device>();
+      }
     }
   }
 }
@@ -4,7 +4,6 @@
 #include "share/io/scorpio_input.hpp"
 
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
-#include <ekat/ekat_pack_utils.hpp>
 
 #include <numeric>
 
@@ -228,16 +227,16 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
   // If this was the last field to be bound, we can setup the MPI schedule
   if (this->m_state==RepoState::Closed &&
       (this->m_num_bound_fields+1)==this->m_num_registered_fields) {
-    create_ov_tgt_fields ();
     setup_mpi_data_structures ();
+    setup_fields_data_desc ();
   }
 }
 
 void CoarseningRemapper::do_registration_ends ()
 {
   if (this->m_num_bound_fields==this->m_num_registered_fields) {
-    create_ov_tgt_fields ();
     setup_mpi_data_structures ();
+    setup_fields_data_desc ();
   }
 }
 
@@ -252,33 +251,17 @@ void CoarseningRemapper::do_remap_fwd ()
         "  - recv rank: " + std::to_string(m_comm.rank()) + "\n");
   }
 
-  // Loop over each field
-  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
-  for (int i=0; i<m_num_fields; ++i) {
-    // First, perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the src field, and y is the overlapped tgt field.
-    const auto& f_src    = m_src_fields[i];
-    const auto& f_ov_tgt = m_ov_tgt_fields[i];
-
-    // Dispatch kernel with the largest possible pack size
-    const auto& src_ap = f_src.get_header().get_alloc_properties();
-    const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
-    if (can_pack && src_ap.is_compatible<RPack<16>>() &&
-                    ov_tgt_ap.is_compatible<RPack<16>>()) {
-      local_mat_vec<16>(f_src,f_ov_tgt);
-    } else if (can_pack && src_ap.is_compatible<RPack<8>>() &&
-                           ov_tgt_ap.is_compatible<RPack<8>>()) {
-      local_mat_vec<8>(f_src,f_ov_tgt);
-    } else if (can_pack && src_ap.is_compatible<RPack<4>>() &&
-                           ov_tgt_ap.is_compatible<RPack<4>>()) {
-      local_mat_vec<4>(f_src,f_ov_tgt);
-    } else {
-      local_mat_vec<1>(f_src,f_ov_tgt);
-    }
+  // Dynamic subfields may have changed slice index since last call
+  if (m_has_dynamic_subfields) {
+    setup_fields_data_desc ();
   }
 
-  // Pack, then fire off the sends
-  pack_and_send ();
+  // Perform the local mat-vec for all fields at once, storing the
+  // result directly in the send buffer.
+  local_mat_vec_and_pack ();
+
+  // Fire off the sends
+  send ();
 
   // Wait for all data to be received, then unpack
   recv_and_unpack ();
@@ -293,191 +276,50 @@ void CoarseningRemapper::do_remap_fwd ()
 
 }
 
-template<int PackSize>
-void CoarseningRemapper::
-local_mat_vec (const Field& x, const Field& y) const
+void CoarseningRemapper::local_mat_vec_and_pack ()
 {
-  using RangePolicy = typename KT::RangePolicy;
-  using MemberType  = typename KT::MemberType;
-  using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
-  using Pack        = ekat::Pack<Real,PackSize>;
-  using PackInfo    = ekat::PackInfo<PackSize>;
-
-  const auto& src_layout = x.get_header().get_identifier().get_layout();
-  const int rank = src_layout.rank();
-  const int nrows = m_ov_tgt_grid->get_num_local_dofs();
-  auto row_offsets = m_row_offsets;
-  auto col_lids = m_col_lids;
-  auto weights = m_weights;
-  switch (rank) {
-    // Note: in each case, handle 1st contribution to each row separately,
-    //       using = instead of +=. This allows to avoid doing an extra
-    //       loop to zero out y before the mat-vec.
-    case 1:
-    {
-      auto x_view = x.get_view<const Real*>();
-      auto y_view = y.get_view<      Real*>();
-      Kokkos::parallel_for(RangePolicy(0,nrows),
-                           KOKKOS_LAMBDA(const int& row) {
-        const auto beg = row_offsets(row);
-        const auto end = row_offsets(row+1);
-        y_view(row) = weights(beg)*x_view(col_lids(beg));
-        for (int icol=beg+1; icol<end; ++icol) {
-          y_view(row) += weights(icol)*x_view(col_lids(icol));
-        }
-      });
-      break;
-    }
-    case 2:
-    {
-      auto x_view = x.get_view<const Pack**>();
-      auto y_view = y.get_view<      Pack**>();
-      const int dim1 = PackInfo::num_packs(src_layout.dim(1));
-      auto policy = ESU::get_default_team_policy(nrows,dim1);
-      Kokkos::parallel_for(policy,
-                           KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
-
-        const auto beg = row_offsets(row);
-        const auto end = row_offsets(row+1);
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team,dim1),
-                            [&](const int j){
-          y_view(row,j) = weights(beg)*x_view(col_lids(beg),j);
-          for (int icol=beg+1; icol<end; ++icol) {
-            y_view(row,j) += weights(icol)*x_view(col_lids(icol),j);
-          }
-        });
-      });
-      break;
-    }
-    case 3:
-    {
-      auto x_view = x.get_view<const Pack***>();
-      auto y_view = y.get_view<      Pack***>();
-      const int dim1 = src_layout.dim(1);
-      const int dim2 = PackInfo::num_packs(src_layout.dim(2));
-      auto policy = ESU::get_default_team_policy(nrows,dim1*dim2);
-      Kokkos::parallel_for(policy,
-                           KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
-
-        const auto beg = row_offsets(row);
-        const auto end = row_offsets(row+1);
-        Kokkos::parallel_for(Kokkos::TeamThreadRange(team,dim1*dim2),
-                            [&](const int idx){
-          const int j = idx / dim2;
-          const int k = idx % dim2;
-          y_view(row,j,k) = weights(beg)*x_view(col_lids(beg),j,k);
-          for (int icol=beg+1; icol<end; ++icol) {
-            y_view(row,j,k) += weights(icol)*x_view(col_lids(icol),j,k);
-          }
-        });
-      });
-      break;
-    }
-  }
-}
-
-void CoarseningRemapper::pack_and_send ()
-{
-  using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
   using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
 
+  // Recall that in these y=Ax products, x is the src field, and y is the
+  // overlapped tgt field. Here, y is not stored in a field, but directly
+  // in the send buffer: the dofs to send are ordered by destination pid,
+  // so the ith dof in lids_pids is the ith stacked column in the buffer.
   const int num_send_gids = m_ov_tgt_grid->get_num_local_dofs();
-  const auto pid_lid_start = m_send_pid_lids_start;
+  const int col_size = m_stacked_col_size;
   const auto lids_pids = m_send_lids_pids;
+  const auto col_entries = m_col_entries;
+  const auto src_desc = m_src_data_desc;
+  const auto row_offsets = m_row_offsets;
+  const auto col_lids = m_col_lids;
+  const auto weights = m_weights;
   const auto buf = m_send_buffer;
 
-  for (int ifield=0; ifield<m_num_fields; ++ifield) {
-    const auto& f  = m_ov_tgt_fields[ifield];
-    const auto& fl = f.get_header().get_identifier().get_layout();
-    const auto lt = get_layout_type(fl.tags());
-    const auto f_pid_offsets = ekat::subview(m_send_f_pid_offsets,ifield);
-
-    switch (lt) {
-      case LayoutType::Scalar2D:
-      {
-        auto v = f.get_view<const Real*>();
-        Kokkos::parallel_for(RangePolicy(0,num_send_gids),
-                             KOKKOS_LAMBDA(const int& i){
-          const int lid = lids_pids(i,0);
-          const int pid = lids_pids(i,1);
-          const int lidpos = i - pid_lid_start(pid);
-          const int offset = f_pid_offsets(pid);
-
-          buf (offset + lidpos) = v(lid);
-        });
-                             
-      } break;
-      case LayoutType::Vector2D:
-      {
-        auto v = f.get_view<const Real**>();
-        const int ndims = fl.dim(1);
-        auto policy = ESU::get_default_team_policy(num_send_gids,ndims);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
-          const int lid = lids_pids(i,0);
-          const int pid = lids_pids(i,1);
-          const int lidpos = i - pid_lid_start(pid);
-          const int offset = f_pid_offsets(pid);
-
-          Kokkos::parallel_for(Kokkos::TeamThreadRange(team,ndims),
-                               [&](const int idim) {
-            buf(offset + lidpos*ndims + idim) = v(lid,idim);
-          });
-        });
-      } break;
-      case LayoutType::Scalar3D:
-      {
-        auto v = f.get_view<const Real**>();
-        const int nlevs = fl.dims().back();
-        auto policy = ESU::get_default_team_policy(num_send_gids,nlevs);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
-          const int lid = lids_pids(i,0);
-          const int pid = lids_pids(i,1);
-          const int lidpos = i - pid_lid_start(pid);
-          const int offset = f_pid_offsets(pid);
-
-          Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs),
-                               [&](const int ilev) {
-            buf(offset + lidpos*nlevs + ilev) = v(lid,ilev);
-          });
-        });
-      } break;
-      case LayoutType::Vector3D:
-      {
-        auto v = f.get_view<const Real***>();
-        const int ndims = fl.dim(1);
-        const int nlevs = fl.dims().back();
-        auto policy = ESU::get_default_team_policy(num_send_gids,ndims*nlevs);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
-          const int lid = lids_pids(i,0);
-          const int pid = lids_pids(i,1);
-          const int lidpos = i - pid_lid_start(pid);
-          const int offset = f_pid_offsets(pid);
-
-          Kokkos::parallel_for(Kokkos::TeamThreadRange(team,ndims*nlevs),
-                               [&](const int idx) {
-            const int idim = idx / nlevs;
-            const int ilev = idx % nlevs;
-            buf(offset + lidpos*ndims*nlevs + idim*nlevs + ilev) = v(lid,idim,ilev);
-          });
-        });
-      } break;
-
-      default:
-        EKAT_ERROR_MSG ("Unexpected field rank in CoarseningRemapper::pack.\n"
-            "  - MPI rank  : " + std::to_string(m_comm.rank()) + "\n"
-            "  - field rank: " + std::to_string(fl.rank()) + "\n");
-    }
-  }
+  auto policy = ESU::get_default_team_policy(num_send_gids,col_size);
+  Kokkos::parallel_for(policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int i = team.league_rank();
+    const int row = lids_pids(i,0);
+
+    const auto beg = row_offsets(row);
+    const auto end = row_offsets(row+1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,col_size),
+                         [&](const int idx){
+      const auto& x = src_desc(col_entries(idx,0));
+      const Real* x_col = x.data + col_entries(idx,1)*x.cmp_stride + col_entries(idx,2);
+
+      // Note: handle 1st contribution to each row separately, using = instead of +=
+      Real y = weights(beg)*x_col[col_lids(beg)*x.col_stride];
+      for (int icol=beg+1; icol<end; ++icol) {
+        y += weights(icol)*x_col[col_lids(icol)*x.col_stride];
+      }
+      buf(i*col_size + idx) = y;
+    });
+  });
+}
 
+void CoarseningRemapper::send ()
+{
   // If MPI does not use dev pointers, we need to deep copy from dev to host
   if (not MpiOnDev) {
     Kokkos::deep_copy (m_mpi_send_buffer,m_send_buffer);
@@ -504,119 +346,42 @@ void CoarseningRemapper::recv_and_unpack ()
     Kokkos::deep_copy (m_recv_buffer,m_mpi_recv_buffer);
   }
 
-  using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
   using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
 
   const int num_tgt_dofs = m_tgt_grid->get_num_local_dofs();
+  const int col_size = m_stacked_col_size;
 
   const auto buf = m_recv_buffer;
   const auto recv_lids_beg = m_recv_lids_beg;
   const auto recv_lids_end = m_recv_lids_end;
   const auto recv_lids_pidpos = m_recv_lids_pidpos;
-  for (int ifield=0; ifield<m_num_fields; ++ifield) {
-          auto& f  = m_tgt_fields[ifield];
-    const auto& fl = f.get_header().get_identifier().get_layout();
-    const auto lt = get_layout_type(fl.tags());
-    const auto f_pid_offsets = ekat::subview(m_recv_f_pid_offsets,ifield);
-
-
-    f.deep_copy(0);
-    switch (lt) {
-      case LayoutType::Scalar2D:
-      {
-        auto v = f.get_view<Real*>();
-        Kokkos::parallel_for(RangePolicy(0,num_tgt_dofs),
-                             KOKKOS_LAMBDA(const int& lid){
-          const int recv_beg = recv_lids_beg(lid);
-          const int recv_end = recv_lids_end(lid);
-          for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
-            const int pid = recv_lids_pidpos(irecv,0);
-            const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos;
-            v(lid) += buf (offset);
-          }
-        });
-                             
-      } break;
-      case LayoutType::Vector2D:
-      {
-        auto v = f.get_view<Real**>();
-        const int ndims = fl.dim(1);
-        auto policy = ESU::get_default_team_policy(num_tgt_dofs,ndims);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int lid = team.league_rank();
-          const int recv_beg = recv_lids_beg(lid);
-          const int recv_end = recv_lids_end(lid);
-          for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
-            const int pid = recv_lids_pidpos(irecv,0);
-            const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid)+lidpos*ndims;
-            Kokkos::parallel_for(Kokkos::TeamThreadRange(team,ndims),
-                                 [&](const int idim) {
-              v(lid,idim) += buf (offset + idim);
-            });
-          }
-        });
-      } break;
-      case LayoutType::Scalar3D:
-      {
-        auto v = f.get_view<Real**>();
-        const int nlevs = fl.dims().back();
-        auto policy = ESU::get_default_team_policy(num_tgt_dofs,nlevs);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int lid = team.league_rank();
-          const int recv_beg = recv_lids_beg(lid);
-          const int recv_end = recv_lids_end(lid);
-          for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
-            const int pid = recv_lids_pidpos(irecv,0);
-            const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos*nlevs;
-
-            Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs),
-                                 [&](const int ilev) {
-              v(lid,ilev) += buf (offset + ilev);
-            });
-          }
-        });
-      } break;
-      case LayoutType::Vector3D:
-      {
-        auto v = f.get_view<Real***>();
-        const int ndims = fl.dim(1);
-        const int nlevs = fl.dims().back();
-        auto policy = ESU::get_default_team_policy(num_tgt_dofs,nlevs*ndims);
-        Kokkos::parallel_for(policy,
-                             KOKKOS_LAMBDA(const MemberType& team){
-          const int lid = team.league_rank();
-          const int recv_beg = recv_lids_beg(lid);
-          const int recv_end = recv_lids_end(lid);
-          for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
-            const int pid = recv_lids_pidpos(irecv,0);
-            const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos*ndims*nlevs;
-
-            Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs*ndims),
-                                 [&](const int idx) {
-              const int idim = idx / nlevs;
-              const int ilev = idx % nlevs;
-              v(lid,idim,ilev) += buf (offset + idim*nlevs + ilev);
-            });
-          }
-        });
-      } break;
-
-      default:
-        EKAT_ERROR_MSG ("Unexpected field rank in CoarseningRemapper::pack.\n"
-            "  - MPI rank  : " + std::to_string(m_comm.rank()) + "\n"
-            "  - field rank: " + std::to_string(fl.rank()) + "\n");
-    }
-  }
+  const auto recv_pid_start = m_recv_pid_start;
+  const auto col_entries = m_col_entries;
+  const auto tgt_desc = m_tgt_data_desc;
+
+  // Accumulate all contributions for a tgt dof before writing it in the
+  // tgt field, so that we don't need to zero out the tgt fields first.
+  auto policy = ESU::get_default_team_policy(num_tgt_dofs,col_size);
+  Kokkos::parallel_for(policy,
+                       KOKKOS_LAMBDA(const MemberType& team){
+    const int lid = team.league_rank();
+    const int recv_beg = recv_lids_beg(lid);
+    const int recv_end = recv_lids_end(lid);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,col_size),
+                         [&](const int idx) {
+      Real y = 0;
+      for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
+        const int pid = recv_lids_pidpos(irecv,0);
+        const int lidpos = recv_lids_pidpos(irecv,1);
+        y += buf ((recv_pid_start(pid)+lidpos)*col_size + idx);
+      }
+      const auto& f = tgt_desc(col_entries(idx,0));
+      f.data[lid*f.col_stride + col_entries(idx,1)*f.cmp_stride + col_entries(idx,2)] = y;
+    });
+  });
 }
 
-
 auto CoarseningRemapper::
 get_my_triplets_gids (const std::string& map_file,
                       const grid_ptr_type& src_grid) const
@@ -627,7 +392,7 @@ get_my_triplets_gids (const std::string& map_file,
   scorpio::register_file(map_file,scorpio::FileMode::Read);
   // 1. Create a "helper" grid, with as many dofs as the number
   //    of triplets in the map file, and divided linearly across ranks
-  const int ngweights = scorpio::get_dimlen_c2f(map_file.c_str(),"n_s");
+  const int ngweights = scorpio::get_dimlen(map_file,"n_s");
   const auto io_grid_linear = create_point_grid ("helper",ngweights,1,m_comm);
   const int nlweights = io_grid_linear->get_num_local_dofs();
 
@@ -773,31 +538,59 @@ recv_gids_from_pids (const std::map<int,std::vector<int>>& pid2gids_send) const
   return pid2gids_recv;
 }
 
-void CoarseningRemapper::create_ov_tgt_fields ()
+void CoarseningRemapper::setup_fields_data_desc ()
 {
-  using FL = FieldLayout;
-  m_ov_tgt_fields.reserve(m_num_fields);
-  const int num_ov_cols = m_ov_tgt_grid->get_num_local_dofs();
-  const auto ov_gn = m_ov_tgt_grid->name();
-  // for (const auto& f : m_tgt_fields) {
+  auto get_desc = [] (const Field& f) -> FieldDataDesc {
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    FieldDataDesc d;
+    d.cmp_stride = 0;
+    switch (fl.rank()) {
+      case 1:
+      {
+        auto v = f.get_view<Real*>();
+        d.data = v.data();
+        d.col_stride = v.stride(0);
+      } break;
+      case 2:
+      {
+        auto v = f.get_view<Real**>();
+        d.data = v.data();
+        d.col_stride = v.stride(0);
+        EKAT_REQUIRE_MSG (v.stride(1)==1,
+            "Error! CoarseningRemapper requires the last dimension of a field to be contiguous.\n"
+            "  - field name: " + f.name() + "\n");
+      } break;
+      case 3:
+      {
+        auto v = f.get_view<Real***>();
+        d.data = v.data();
+        d.col_stride = v.stride(0);
+        d.cmp_stride = v.stride(1);
+        EKAT_REQUIRE_MSG (v.stride(2)==1,
+            "Error! CoarseningRemapper requires the last dimension of a field to be contiguous.\n"
+            "  - field name: " + f.name() + "\n");
+      } break;
+      default:
+        EKAT_ERROR_MSG ("Unexpected field rank in CoarseningRemapper::setup_fields_data_desc.\n"
+            "  - field name: " + f.name() + "\n"
+            "  - field rank: " + std::to_string(fl.rank()) + "\n");
+    }
+    return d;
+  };
+
+  if (m_src_data_desc.size()==0) {
+    m_src_data_desc = view_1d<FieldDataDesc>("",m_num_fields);
+    m_tgt_data_desc = view_1d<FieldDataDesc>("",m_num_fields);
+    m_src_data_desc_h = Kokkos::create_mirror_view(m_src_data_desc);
+    m_tgt_data_desc_h = Kokkos::create_mirror_view(m_tgt_data_desc);
+  }
+
   for (int i=0; i<m_num_fields; ++i) {
-    const auto& f_src = m_src_fields[i];
-    const auto& f_tgt = m_tgt_fields[i];
-    const auto& fid = f_tgt.get_header().get_identifier();
-    auto tags = fid.get_layout().tags();
-    auto dims = fid.get_layout().dims();
-    dims[0] = num_ov_cols;
-    FieldIdentifier ov_fid (fid.name(),FL(tags,dims),fid.get_units(),ov_gn,fid.data_type());
-
-    // Note: with C++17, emplace_back already returns a ref
-    m_ov_tgt_fields.emplace_back(ov_fid);
-    auto& ov_f = m_ov_tgt_fields.back();
-
-    // Use same alloc props as src fields, to allow packing in local_mat_vec
-    const auto pack_size = f_src.get_header().get_alloc_properties().get_largest_pack_size();
-    ov_f.get_header().get_alloc_properties().request_allocation(pack_size);
-    ov_f.allocate_view();
+    m_src_data_desc_h(i) = get_desc(m_src_fields[i]);
+    m_tgt_data_desc_h(i) = get_desc(m_tgt_fields[i]);
   }
+  Kokkos::deep_copy(m_src_data_desc,m_src_data_desc_h);
+  Kokkos::deep_copy(m_tgt_data_desc,m_tgt_data_desc_h);
 }
 
 void CoarseningRemapper::setup_mpi_data_structures ()
@@ -807,17 +600,38 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   const auto mpi_comm  = m_comm.mpi_comm();
   const auto mpi_real  = ekat::get_mpi_type<Real>();
 
-  const int last_rank = m_comm.size()-1;
-
   // Pre-compute the amount of data stored in each field on each dof
+  // Note: use the src layout, since tgt dim(0) may be 0 on some ranks
   std::vector<int> field_col_size (m_num_fields);
   int sum_fields_col_sizes = 0;
   for (int i=0; i<m_num_fields; ++i) {
-    const auto& f  = m_ov_tgt_fields[i];  // Doesn't matter if tgt or ov_tgt
+    const auto& f  = m_src_fields[i];
     const auto& fl = f.get_header().get_identifier().get_layout();
     field_col_size[i] = fl.size() / fl.dim(0);
     sum_fields_col_sizes += field_col_size[i];
   }
+  m_stacked_col_size = sum_fields_col_sizes;
+
+  // Map each entry of a stacked column to (field, component, entry)
+  m_col_entries = view_2d<int>("",sum_fields_col_sizes,3);
+  auto col_entries_h = Kokkos::create_mirror_view(m_col_entries);
+  m_has_dynamic_subfields = false;
+  for (int i=0,pos=0; i<m_num_fields; ++i) {
+    const auto& fl = m_src_fields[i].get_header().get_identifier().get_layout();
+    const int ncmps = fl.rank()==3 ? fl.dim(1) : 1;
+    const int cmp_size = field_col_size[i] / ncmps;
+    for (int icmp=0; icmp<ncmps; ++icmp) {
+      for (int k=0; k<cmp_size; ++k,++pos) {
+        col_entries_h(pos,0) = i;
+        col_entries_h(pos,1) = icmp;
+        col_entries_h(pos,2) = k;
+      }
+    }
+
+    m_has_dynamic_subfields |= m_src_fields[i].get_header().get_alloc_properties().is_dynamic_subfield();
+    m_has_dynamic_subfields |= m_tgt_fields[i].get_header().get_alloc_properties().is_dynamic_subfield();
+  }
+  Kokkos::deep_copy(m_col_entries,col_entries_h);
 
   // --------------------------------------------------------- //
   //                   Setup SEND structures                   //
@@ -852,24 +666,12 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   Kokkos::deep_copy(m_send_lids_pids,send_lids_pids_h);
   Kokkos::deep_copy(m_send_pid_lids_start,send_pid_lids_start_h);
 
-  // 3. Compute offsets in send buffer for each pid/field pair
-  m_send_f_pid_offsets = view_2d<int>("",m_num_fields,m_comm.size());
-  auto send_f_pid_offsets_h = Kokkos::create_mirror_view(m_send_f_pid_offsets);
+  // 3. Compute offsets in send buffer for each pid. Since dofs are ordered by pid,
+  //    and all fields are stacked together on each dof, data for each pid is contiguous.
   std::vector<int> send_pid_offsets(m_comm.size());
-  for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
-    send_pid_offsets[pid] = pos;
-    for (int i=0; i<m_num_fields; ++i) {
-      send_f_pid_offsets_h(i,pid) = pos;
-      pos += field_col_size[i]*pid2lids_send[pid].size();
-    }
-
-    // At the end, pos must match the total amount of data in the overlapped fields
-    if (pid==last_rank) {
-      EKAT_REQUIRE_MSG (pos==num_ov_gids*sum_fields_col_sizes,
-          "Error! Something went wrong in CoarseningRemapper::setup_mpi_structures.\n");
-    }
+  for (int pid=0; pid<m_comm.size(); ++pid) {
+    send_pid_offsets[pid] = send_pid_lids_start_h(pid)*sum_fields_col_sizes;
   }
-  Kokkos::deep_copy (m_send_f_pid_offsets,send_f_pid_offsets_h);
 
   // 4. Allocate send buffers
   m_send_buffer = view_1d<Real>("",sum_fields_col_sizes*num_ov_gids);
@@ -939,33 +741,21 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   Kokkos::deep_copy(m_recv_lids_beg,recv_lids_beg_h);
   Kokkos::deep_copy(m_recv_lids_end,recv_lids_end_h);
 
-  // 3. Splice gids from all pids, and convert to lid, and compute the offset of each pid
-  //    in the spliced list of gids.
-  std::vector<int> recv_pid_start(m_comm.size()+1);
-  for (int pid=0,pos=0; pid<=m_comm.size(); ++pid) {
-    recv_pid_start[pid] = pos;
-    pos += pid2gids_recv[pid].size();
-  }
-
-  // 4. Compute offsets in recv buffer for each pid/field pair
-  m_recv_f_pid_offsets = view_2d<int>("",m_num_fields,m_comm.size());
-  auto recv_f_pid_offsets_h = Kokkos::create_mirror_view(m_recv_f_pid_offsets);
+  // 4. Compute the start of each pid's dofs in the recv buffer. As for the sends,
+  //    all fields are stacked together on each dof, so data from each pid is contiguous.
+  m_recv_pid_start = view_1d<int>("",m_comm.size()+1);
+  auto recv_pid_start_h = Kokkos::create_mirror_view(m_recv_pid_start);
   std::vector<int> recv_pid_offsets(m_comm.size());
-  for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
-    recv_pid_offsets[pid] = pos;
-    const int num_recv_gids = recv_pid_start[pid+1] - recv_pid_start[pid];
-    for (int i=0; i<m_num_fields; ++i) {
-      recv_f_pid_offsets_h(i,pid) = pos;
-      pos += field_col_size[i]*num_recv_gids;
-    }
-
-    // // At the end, pos must match the total amount of data received
-    if (pid==last_rank) {
-      EKAT_REQUIRE_MSG (pos==num_total_recv_gids*sum_fields_col_sizes,
-          "Error! Something went wrong in CoarseningRemapper::setup_mpi_structures.\n");
+  for (int pid=0,pos=0; pid<=m_comm.size(); ++pid) {
+    recv_pid_start_h(pid) = pos;
+    if (pid<m_comm.size()) {
+      recv_pid_offsets[pid] = pos*sum_fields_col_sizes;
+      pos += pid2gids_recv[pid].size();
     }
   }
-  Kokkos::deep_copy (m_recv_f_pid_offsets,recv_f_pid_offsets_h);
+  EKAT_REQUIRE_MSG (recv_pid_start_h(m_comm.size())==num_total_recv_gids,
+      "Error! Something went wrong in CoarseningRemapper::setup_mpi_structures.\n");
+  Kokkos::deep_copy (m_recv_pid_start,recv_pid_start_h);
 
   // 5. Allocate recv buffers
   m_recv_buffer = view_1d<Real>("",sum_fields_col_sizes*num_total_recv_gids);
@@ -974,7 +764,7 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   // 6. Setup recv requests
   m_recv_req.reserve(num_recv_pids);
   for (int pid=0; pid<m_comm.size(); ++pid) {
-    const int num_recv_gids = recv_pid_start[pid+1] - recv_pid_start[pid];
+    const int num_recv_gids = recv_pid_start_h(pid+1) - recv_pid_start_h(pid);
     const int n = num_recv_gids*sum_fields_col_sizes;
     if (n==0) {
       continue;
@@ -25,14 +25,17 @@ namespace scream
  *
  * The mat-vec is performed in two stages:
  *   1. Perform a local mat-vec multiplication (on device), producing intermediate
- *      output fields that have "duplicated" entries (that is, 2+ MPI
+ *      results that have "duplicated" entries (that is, 2+ MPI
  *      ranks could all own a piece of the result for the same dof).
- *   2. Perform a pack-send-recv-unpack sequence via MPI, to accumulate
+ *   2. Perform a send-recv-unpack sequence via MPI, to accumulate
  *      partial results on the rank that owns the dof in the tgt grid.
  *
- * The class has to create temporaries for the intermediate fields.
- * An obvious future development would be to use some scratch memory
- * for these fields, so to not increase memory pressure.
+ * All fields are processed at once: the columns of all fields are stacked
+ * together, so that a single kernel applies the sparse matrix to all of
+ * them (reading each row of the matrix once), writing the result directly
+ * in the send buffer. Similarly, a single kernel unpacks the recv buffer,
+ * accumulating all contributions directly in the tgt fields. Hence, there
+ * is one message per remote rank, containing the data of all fields.
  *
  * The setup of the class uses a bunch of RMA mpi operations, since they
  * are more convenient when ranks don't know where data is coming from
@@ -105,16 +108,13 @@ protected:
   using KT = KokkosTypes<DefaultDevice>;
   using gid_t = AbstractGrid::gid_type;
 
-  template<int N>
-  using RPack = ekat::Pack<Real,N>;
-
   template<typename T>
   using view_1d = typename KT::template view_1d<T>;
   template<typename T>
   using view_2d = typename KT::template view_2d<T>;
 
-  void create_ov_tgt_fields ();
   void setup_mpi_data_structures ();
+  void setup_fields_data_desc ();
 
   int gid2lid (const gid_t gid, const grid_ptr_type& grid) const {
     const auto gids = grid->get_dofs_gids_host();
@@ -136,9 +136,8 @@ protected:
 #ifdef KOKKOS_ENABLE_CUDA
 public:
 #endif
-  template<int N>
-  void local_mat_vec (const Field& f_src, const Field& f_tgt) const;
-  void pack_and_send ();
+  void local_mat_vec_and_pack ();
+  void send ();
   void recv_and_unpack ();
 
 protected:
@@ -158,11 +157,39 @@ protected:
   // ranks own all rows that are affected by local dofs in their src grid
   grid_ptr_type         m_ov_tgt_grid;
 
-  // Source, target, and overlapped-target fields
+  // Source and target fields
   std::vector<Field>    m_src_fields;
-  std::vector<Field>    m_ov_tgt_fields;
   std::vector<Field>    m_tgt_fields;
 
+  // ----- Fields data, as seen by the fused kernels ---- //
+
+  // The fused kernels access the fields data via raw pointers. Each field
+  // column is made of one or more contiguous chunks (one per vector component),
+  // so all we need is the pointer to the data, and the distance in memory
+  // between two consecutive columns and two consecutive components.
+  // This works also for subfields and padded fields.
+  struct FieldDataDesc {
+    Real* data;
+    int   col_stride;
+    int   cmp_stride;
+  };
+  view_1d<FieldDataDesc>              m_src_data_desc;
+  view_1d<FieldDataDesc>              m_tgt_data_desc;
+  view_1d<FieldDataDesc>::HostMirror  m_src_data_desc_h;
+  view_1d<FieldDataDesc>::HostMirror  m_tgt_data_desc_h;
+
+  // If some field is a dynamic subfield, its data pointer may change
+  // between calls to remap, so we need to refresh the descriptors.
+  bool                  m_has_dynamic_subfields = false;
+
+  // The columns of all fields are stacked together in the send/recv buffers.
+  // For each entry of a stacked column, we store the field it belongs to,
+  // the vector component, and the position within the component. E.g.,
+  // col_entries(7,:)=[2,1,3] means that the 7th entry of a stacked column
+  // is entry 3 of component 1 of field 2.
+  int                   m_stacked_col_size;
+  view_2d<int>          m_col_entries;
+
   // ----- Sparse matrix CRS representation ---- //
   view_1d<int>    m_row_offsets;
   view_1d<int>    m_col_lids;
@@ -179,18 +206,14 @@ protected:
   mpi_view_1d<Real>     m_mpi_send_buffer;
   mpi_view_1d<Real>     m_mpi_recv_buffer;
 
-  // Offset of each field on each PID in send/recv buffers.
-  // E.g., offset(3,2)=10 means the offset of data from field 3
-  //       to be sent to PID 2 is 10.
-  view_2d<int>          m_send_f_pid_offsets;
-  view_2d<int>          m_recv_f_pid_offsets;
-
   // Reorder the lids so that all lids to send to PID n
   // come before those for PID N+1. The meaning is
   //   lids_pids(i,0) = ith lid to send to PID=lids_pids(i,1)
   // Note: send lids are the lids of gids in the ov_tgt_grid.
   //       But here, dofs are ordered differently, so that all dofs to
   //       send to the same PID are contiguous.
+  // The send buffer is laid out in the same order, with one stacked
+  // column per dof, so the ith dof is at offset i*m_stacked_col_size.
   view_2d<int>          m_send_lids_pids;
 
   // Store the start of lids to send to each PID in the view above
@@ -213,6 +236,11 @@ protected:
   view_1d<int>          m_recv_lids_beg;
   view_1d<int>          m_recv_lids_end;
 
+  // Store the start of the dofs received from each PID in the recv buffer.
+  // The jth dof received from PID p is at offset
+  //   (recv_pid_start(p)+j)*m_stacked_col_size
+  view_1d<int>          m_recv_pid_start;
+
   // Send/recv requests
   std::vector<MPI_Request>  m_recv_req;
   std::vector<MPI_Request>  m_send_req;
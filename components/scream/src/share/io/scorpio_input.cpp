@@ -3,12 +3,71 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 
 namespace scream
 {
 
+namespace {
+
+// Data pointer, extents, and strides of a (possibly padded/strided) field view
+struct FieldViewDesc {
+  Real* data;
+  int rank;
+  int extents[Field::MaxRank];
+  int strides[Field::MaxRank];
+};
+
+FieldViewDesc get_field_view_desc (const Field& f)
+{
+  FieldViewDesc d;
+  auto set_desc = [&d] (const auto& v) {
+    d.data = v.data();
+    d.rank = v.rank;
+    for (int r=0; r<d.rank; ++r) {
+      d.strides[r] = v.stride(r);
+    }
+  };
+
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  switch (fl.rank()) {
+    case 1: set_desc(f.get_view<Real*>());      break;
+    case 2: set_desc(f.get_view<Real**>());     break;
+    case 3: set_desc(f.get_view<Real***>());    break;
+    case 4: set_desc(f.get_view<Real****>());   break;
+    case 5: set_desc(f.get_view<Real*****>());  break;
+    case 6: set_desc(f.get_view<Real******>()); break;
+    default:
+      EKAT_ERROR_MSG ("Error! Unexpected field rank (" + std::to_string(fl.rank()) + ").\n");
+  }
+
+  // The view extents include padding, while the file only stores the layout dims
+  for (int r=0; r<d.rank; ++r) {
+    d.extents[r] = fl.dim(r);
+  }
+  return d;
+}
+
+// Copy a contiguous device buffer in a (possibly padded/strided) field device view
+void scatter_to_field (const KokkosTypes<DefaultDevice>::view_1d<Real>& src,
+                       const FieldViewDesc& d)
+{
+  using RangePolicy = KokkosTypes<DefaultDevice>::RangePolicy;
+  Kokkos::parallel_for(RangePolicy(0,src.size()), KOKKOS_LAMBDA(int idx) {
+    int i = idx;
+    int dst = 0;
+    for (int r=d.rank-1; r>=0; --r) {
+      dst += (i % d.extents[r])*d.strides[r];
+      i /= d.extents[r];
+    }
+    d.data[dst] = src(idx);
+  });
+}
+
+} // anonymous namespace
+
 /* ---------------------------------------------------------- */
 AtmosphereInput::
 AtmosphereInput (const ekat::Comm& comm,
@@ -174,6 +233,7 @@ set_field_manager (const std::shared_ptr<const fm_type>& field_mgr,
 
 void AtmosphereInput::
 register_fields_specs() {
+  long long staging_size = 0;
   for (auto const& name : m_fields_names) {
     auto f = m_field_mgr->get_field(name);
     const auto& fh  = f.get_header();
@@ -192,10 +252,18 @@ register_fields_specs() {
       m_host_views_1d[name] = view_1d_host(data,fl.size());
     } else {
       // We have padding, or the field is a subfield (or both).
-      // Either way, we need a temporary view.
+      // Either way, we need a temporary view. The data is staged
+      // on device, and then copied in the field device view.
       m_host_views_1d[name] = view_1d_host("",fl.size());
+      m_staged_fields.insert(name);
+      staging_size = std::max(staging_size,fl.size());
     }
   }
+
+  // All staged fields share the same device buffer
+  if (staging_size>0) {
+    m_dev_staging = view_1d_dev("input staging",staging_size);
+  }
 }
 
 /* ---------------------------------------------------------- */
@@ -237,6 +305,13 @@ void AtmosphereInput::read_variables (const int time_index)
   EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
+  // Fields that cannot alias the host view are staged on device, and then copied
+  // in the field device view with one kernel per field. Copies and kernels are
+  // enqueued without waiting for them to complete, so that they overlap with
+  // the read of the next variables. They all go in the default execution space
+  // instance, so the staging buffer is not overwritten before the previous
+  // field has been copied out of it.
+  std::vector<Field> staged_fields;
   for (auto const& name : m_fields_names) {
 
     // Read the data
@@ -246,107 +321,28 @@ void AtmosphereInput::read_variables (const int time_index)
     // If we have a field manager, make sure the data is correctly
     // synced to both host and device views of the field.
     if (m_field_mgr) {
-
       auto f = m_field_mgr->get_field(name);
-      const auto& fh  = f.get_header();
-      const auto& fl  = fh.get_identifier().get_layout();
-      const auto& fap = fh.get_alloc_properties();
-
-      // Check if the stored 1d view is sharing the data ptr with the field
-      const bool can_alias_field_view = fh.get_parent().expired() && fap.get_padding()==0;
 
       // If the 1d view is a simple reshape of the field's Host view data,
-      // then we're already done. Otherwise, we need to manually copy.
-      if (not can_alias_field_view) {
-        // Get the host view of the field properly reshaped, and deep copy
-        // from temp_view (properly reshaped as well).
-        auto rank = fl.rank();
-        auto view_1d = m_host_views_1d.at(name);
-        switch (rank) {
-          case 1:
-            {
-              // No reshape needed, simply copy
-              auto dst = f.get_view<Real*,Host>();
-              for (int i=0; i<fl.dim(0); ++i) {
-                dst(i) = view_1d(i);
-              }
-              break;
-            }
-          case 2:
-            {
-              // Reshape temp_view to a 2d view, then copy
-              auto dst = f.get_view<Real**,Host>();
-              auto src = view_Nd_host<2>(view_1d.data(),fl.dim(0),fl.dim(1));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  dst(i,j) = src(i,j);
-              }}
-              break;
-            }
-          case 3:
-            {
-              // Reshape temp_view to a 3d view, then copy
-              auto dst = f.get_view<Real***,Host>();
-              auto src = view_Nd_host<3>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    dst(i,j,k) = src(i,j,k);
-              }}}
-              break;
-            }
-          case 4:
-            {
-              // Reshape temp_view to a 4d view, then copy
-              auto dst = f.get_view<Real****,Host>();
-              auto src = view_Nd_host<4>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      dst(i,j,k,l) = src(i,j,k,l);
-              }}}}
-              break;
-            }
-          case 5:
-            {
-              // Reshape temp_view to a 5d view, then copy
-              auto dst = f.get_view<Real*****,Host>();
-              auto src = view_Nd_host<5>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      for (int m=0; m<fl.dim(4); ++m) {
-                        dst(i,j,k,l,m) = src(i,j,k,l,m);
-              }}}}}
-              break;
-            }
-          case 6:
-            {
-              // Reshape temp_view to a 6d view, then copy
-              auto dst = f.get_view<Real******,Host>();
-              auto src = view_Nd_host<6>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4),fl.dim(5));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      for (int m=0; m<fl.dim(4); ++m) {
-                        for (int n=0; n<fl.dim(5); ++n) {
-                          dst(i,j,k,l,m,n) = src(i,j,k,l,m,n);
-              }}}}}}
-              break;
-            }
-          default:
-            EKAT_ERROR_MSG ("Error! Unexpected field rank (" + std::to_string(rank) + ").\n");
-        }
+      // then we simply need to sync to device. Otherwise, stage on device,
+      // and copy in the field device view.
+      if (m_staged_fields.count(name)==0) {
+        f.sync_to_dev();
+      } else {
+        view_1d_dev dev_v1d (m_dev_staging.data(),v1d.size());
+        Kokkos::deep_copy(KT::ExeSpace(),dev_v1d,v1d);
+        scatter_to_field(dev_v1d,get_field_view_desc(f));
+        staged_fields.push_back(f);
       }
-
-      // Sync to device
-      f.sync_to_dev();
     }
   }
 
+  // Wait for all the copies, then make sure the host views of the staged fields are in sync
+  Kokkos::fence();
+  for (auto& f : staged_fields) {
+    f.sync_to_host();
+  }
+
   if (m_remapper) {
     m_remapper->remap(true);
   }
@@ -355,7 +351,7 @@ void AtmosphereInput::read_variables (const int time_index)
 int AtmosphereInput::
 read_int_scalar (const std::string& name)
 {
-  return scorpio::get_int_attribute_c2f(m_filename.c_str(),name.c_str());
+  return scorpio::get_int_attribute(m_filename,name);
 }
 
 void AtmosphereInput::
@@ -396,6 +392,8 @@ void AtmosphereInput::finalize()
   m_remapper  = nullptr;
 
   m_host_views_1d.clear();
+  m_staged_fields.clear();
+  m_dev_staging = view_1d_dev();
   m_layouts.clear();
 
   m_inited_with_views = false;
@@ -9,6 +9,8 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
 
+#include <set>
+
 /*  The AtmosphereInput class handles all input streams to SCREAM.
  *  It is important to note that there does not exist an InputManager,
  *  like in the case of output.  So all input streams have to be managed
@@ -71,6 +73,7 @@ public:
   template<int N>
   using view_Nd_host = typename KT::template view_ND<Real,N>::HostMirror;
   using view_1d_host = view_Nd_host<1>;
+  using view_1d_dev  = typename KT::template view_1d<Real>;
 
   // --- Constructor(s) & Destructor --- //
   // Creates bare input. Will require a call to one of the two 'init' methods.
@@ -164,6 +167,12 @@ protected:
 
   std::map<std::string, view_1d_host>   m_host_views_1d;
   std::map<std::string, FieldLayout>    m_layouts;
+
+  // Fields that are padded or strided (hence, whose host view cannot be used
+  // directly as a 1d buffer for reading), and the device buffer used to stage
+  // them, sized for the largest one.
+  std::set<std::string>                 m_staged_fields;
+  view_1d_dev                           m_dev_staging;
   
   std::string               m_filename;
   std::string               m_io_grid_name;
@@ -1,6 +1,5 @@
 #include "share/io/scorpio_output.hpp"
 #include "share/io/scorpio_input.hpp"
-#include "share/util/scream_array_utils.hpp"
 
 #include "ekat/util/ekat_units.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
@@ -39,7 +38,8 @@ void combine (const Real& new_val, Real& curr_val, const OutputAvgType avg_type)
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
                   const std::shared_ptr<const fm_type>& field_mgr,
-                  const std::shared_ptr<const gm_type>& grids_mgr)
+                  const std::shared_ptr<const gm_type>& grids_mgr,
+                  const std::shared_ptr<diag_registry_type>& diags_registry)
  : m_comm      (comm)
 {
   using vos_t = std::vector<std::string>;
@@ -125,6 +125,14 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
     set_field_manager(io_fm);
   }
 
+  // Diagnostics can be shared with other streams only if their inputs come from
+  // the same field manager. If we remap, our field manager is private.
+  if (diags_registry and not m_remapper) {
+    m_diags_registry = diags_registry;
+  } else {
+    m_diags_registry = std::make_shared<diag_registry_type>();
+  }
+
   // Setup I/O structures
   init ();
 }
@@ -173,6 +181,74 @@ void AtmosphereOutput::run (const std::string& filename, const bool is_write_ste
 
   using namespace scream::scorpio;
 
+  update_avg_views (is_write_step,nsteps_since_last_output);
+
+  if (is_write_step) {
+    for (auto const& name : m_fields_names) {
+      // Bring data to host
+      auto view_dev  = m_dev_views_1d.at(name);
+      auto view_host = m_host_views_1d.at(name);
+      Kokkos::deep_copy (view_host,view_dev);
+      grid_write_data_array(filename,name,view_host.data(),view_host.size());
+    }
+  }
+} // run
+/*-----*/
+AsyncWriter::task_type AtmosphereOutput::
+run_async (const std::string& filename, const int nsteps_since_last_output, const int slot)
+{
+  EKAT_REQUIRE_MSG (slot>=0 && slot<static_cast<int>(m_staging_host.size()),
+      "Error! Invalid async output staging slot: " + std::to_string(slot) + ".\n"
+      "       Did you forget to call setup_async_staging?\n");
+
+  update_avg_views (true,nsteps_since_last_output);
+
+  // Snapshot all output views in the device staging buffer, so that the
+  // output views can be safely reset/updated while the snapshot is written.
+  // Then, bring the whole snapshot to host with a single copy.
+  for (auto const& name : m_fields_names) {
+    const auto& range = m_staging_ranges.at(name);
+    Kokkos::deep_copy(Kokkos::subview(m_staging_dev,range),m_dev_views_1d.at(name));
+  }
+  auto staging_host = m_staging_host[slot];
+  Kokkos::deep_copy(staging_host,m_staging_dev);
+
+  // Note: capture by value. This task is executed after this call returns.
+  auto names  = m_fields_names;
+  auto ranges = m_staging_ranges;
+  return [filename,names,ranges,staging_host] () {
+    using namespace scream::scorpio;
+    for (auto const& name : names) {
+      const auto& range = ranges.at(name);
+      grid_write_data_array(filename,name,staging_host.data()+range.first,range.second-range.first);
+    }
+  };
+} // run_async
+/*-----*/
+void AtmosphereOutput::
+setup_async_staging (const int queue_depth)
+{
+  EKAT_REQUIRE_MSG (queue_depth>0,
+      "Error! Invalid async output queue depth: " + std::to_string(queue_depth) + "\n");
+
+  // Lay out all output fields contiguously in the staging buffer
+  int size = 0;
+  for (auto const& name : m_fields_names) {
+    const int fsize = m_layouts.at(name).size();
+    m_staging_ranges[name] = std::make_pair(size,size+fsize);
+    size += fsize;
+  }
+
+  m_staging_dev = view_1d_dev("",size);
+  m_staging_host.resize(queue_depth);
+  for (auto& v : m_staging_host) {
+    v = view_1d_host("",size);
+  }
+}
+/*-----*/
+void AtmosphereOutput::
+update_avg_views (const bool is_write_step, const int nsteps_since_last_output)
+{
   // If needed, remap fields from their grid to the unique grid, for I/O
   if (m_remapper) {
     m_remapper->remap(true);
@@ -192,117 +268,61 @@ void AtmosphereOutput::run (const std::string& filename, const bool is_write_ste
   for (auto const& name : m_fields_names) {
     // Get all the info for this field.
     const auto  field = get_field(name,true); // If diagnostic, must evaluate it
-    const auto& layout = m_layouts.at(name);
-    const auto& dims = layout.dims();
-    const auto  rank = layout.rank();
 
     // Safety check: make sure that the field was written at least once before using it.
     EKAT_REQUIRE_MSG (field.get_header().get_tracking().get_time_stamp().is_valid(),
         "Error! Output field '" + name + "' has not been initialized yet\n.");
+  }
 
-    const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
-    const bool is_aliasing_field_view =
-        m_avg_type==OutputAvgType::Instant &&
-        field.get_header().get_alloc_properties().get_padding()==0 &&
-        field.get_header().get_parent().expired() &&
-        not is_diagnostic;
+  // Manually update the 'running-tally' views with data from the fields,
+  // by combining new data with current avg values. All the views are
+  // updated at once, using the descriptors table.
+  // NOTE: this skips the views that alias the field view (Instant output only),
+  //       since there's no point in copying from the field's view to dev_view.
+  const int buf_size = m_avg_buffer.size();
+  if (buf_size==0) {
+    return;
+  }
 
-    // Manually update the 'running-tally' views with data from the field,
-    // by combining new data with current avg values.
-    // NOTE: this is skipped for instant output, if IO view is aliasing Field view.
-    auto view_dev = m_dev_views_1d.at(name);
-    auto data = view_dev.data();
-    KT::RangePolicy policy(0,layout.size());
-    const auto extents = layout.extents();
-
-    auto avg_type = m_avg_type;
-    // If the dev_view_1d is aliasing the field device view (must be Instant output),
-    // then there's no point in copying from the field's view to dev_view
-    if (not is_aliasing_field_view) {
-      switch (rank) {
-        case 1:
-        {
-          auto new_view_1d = field.get_view<const Real*,Device>();
-          auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            combine(new_view_1d(i), avg_view_1d(i),avg_type);
-          });
-          break;
-        }
-        case 2:
-        {
-          auto new_view_2d = field.get_view<const Real**,Device>();
-          auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j;
-            unflatten_idx(idx,extents,i,j);
-            combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
-          });
-          break;
-        }
-        case 3:
-        {
-          auto new_view_3d = field.get_view<const Real***,Device>();
-          auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k;
-            unflatten_idx(idx,extents,i,j,k);
-            combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
-          });
-          break;
-        }
-        case 4:
-        {
-          auto new_view_4d = field.get_view<const Real****,Device>();
-          auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l;
-            unflatten_idx(idx,extents,i,j,k,l);
-            combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
-          });
-          break;
-        }
-        case 5:
-        {
-          auto new_view_5d = field.get_view<const Real*****,Device>();
-          auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m;
-            unflatten_idx(idx,extents,i,j,k,l,m);
-            combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
-          });
-          break;
-        }
-        case 6:
-        {
-          auto new_view_6d = field.get_view<const Real******,Device>();
-          auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m,n;
-            unflatten_idx(idx,extents,i,j,k,l,m,n);
-            combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
-          });
-          break;
-        }
-        default:
-          EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
+  if (m_refresh_avg_descs) {
+    set_avg_fields_descs ();
+  }
+
+  const auto descs = m_avg_descs;
+  const int nfields = descs.size();
+  const auto avg_type = m_avg_type;
+  const bool divide = is_write_step && avg_type==OutputAvgType::Average;
+  auto data = m_avg_buffer.data();
+  Kokkos::parallel_for(KT::RangePolicy(0,buf_size), KOKKOS_LAMBDA(int idx) {
+    // Find the field this entry belongs to (descs are sorted by offset)
+    int beg = 0;
+    int end = nfields;
+    while (end-beg>1) {
+      const int mid = (beg+end)/2;
+      if (descs(mid).offset<=idx) {
+        beg = mid;
+      } else {
+        end = mid;
       }
     }
+    const auto& d = descs(beg);
+
+    // Unflatten the idx in the field layout, and find the entry in the (possibly strided) field view
+    int i = idx - d.offset;
+    int src = 0;
+    for (int r=d.rank-1; r>=0; --r) {
+      src += (i % d.extents[r])*d.strides[r];
+      i /= d.extents[r];
+    }
 
-    if (is_write_step) {
-      if (avg_type==OutputAvgType::Average) {
-        // Divide by steps count only when the summation is complete
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-          data[i] /= nsteps_since_last_output;
-        });
-      }
-      // Bring data to host
-      auto view_host = m_host_views_1d.at(name);
-      Kokkos::deep_copy (view_host,view_dev);
-      grid_write_data_array(filename,name,view_host.data(),view_host.size());
+    combine(d.data[src], data[idx], avg_type);
+
+    // Divide by steps count only when the summation is complete
+    if (divide) {
+      data[idx] /= nsteps_since_last_output;
     }
-  }
-} // run
+  });
+} // update_avg_views
 
 long long AtmosphereOutput::
 res_dep_memory_footprint () const {
@@ -319,16 +339,13 @@ res_dep_memory_footprint () const {
     }
   }
 
-  for (const auto& fn : m_fields_names) {
-    bool is_diagnostic = (m_diagnostics.find(fn) != m_diagnostics.end());
-    bool can_alias_field_view =
-        m_avg_type==OutputAvgType::Instant && not is_diagnostic &&
-        m_field_mgr->get_field(fn).get_header().get_alloc_properties().get_padding()==0 &&
-        m_field_mgr->get_field(fn).get_header().get_parent().expired();
+  // Dev views that do not alias the field view are stored in the avg buffer
+  rdmf += m_avg_buffer.size()*sizeof(Real);
 
-    if (not can_alias_field_view) {
-      rdmf += m_dev_views_1d.size()*sizeof(Real);
-    }
+  // Staging buffers for async output (empty if async output is off)
+  rdmf += m_staging_dev.size()*sizeof(Real);
+  for (const auto& v : m_staging_host) {
+    rdmf += v.size()*sizeof(Real);
   }
 
   return rdmf;
@@ -437,38 +454,101 @@ void AtmosphereOutput::register_views()
       m_dev_views_1d.emplace(name,view_1d_dev(field.get_internal_view_data<Real,Device>(),size));
       m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
     } else {
-      // Create a local view.
-      m_dev_views_1d.emplace(name,view_1d_dev("",size));
-      m_host_views_1d.emplace(name,Kokkos::create_mirror(m_dev_views_1d[name]));
-
+      // Will use a chunk of the avg buffer, see below
+      m_avg_fields_names.push_back(name);
     }
   }
+
+  // Create the avg buffer, and a local view for each field that needs it
+  int buf_size = 0;
+  for (const auto& name : m_avg_fields_names) {
+    buf_size += m_layouts.at(name).size();
+  }
+  m_avg_buffer = view_1d_dev("",buf_size);
+  for (int i=0,offset=0; i<static_cast<int>(m_avg_fields_names.size()); ++i) {
+    const auto& name = m_avg_fields_names[i];
+    const auto size = m_layouts.at(name).size();
+    m_dev_views_1d.emplace(name,view_1d_dev(m_avg_buffer.data()+offset,size));
+    m_host_views_1d.emplace(name,Kokkos::create_mirror(m_dev_views_1d[name]));
+    offset += size;
+
+    const auto& fap = get_field(name).get_header().get_alloc_properties();
+    m_refresh_avg_descs |= fap.is_dynamic_subfield();
+  }
+
+  // Setup the descriptors used to update the avg buffer in one shot
+  set_avg_fields_descs ();
+
   // Initialize the local views
   reset_dev_views();
 }
 /* ---------------------------------------------------------- */
+void AtmosphereOutput::set_avg_fields_descs ()
+{
+  const int nfields = m_avg_fields_names.size();
+  if (m_avg_descs.size()==0) {
+    m_avg_descs   = avg_descs_dev("",nfields);
+    m_avg_descs_h = Kokkos::create_mirror_view(m_avg_descs);
+  }
+
+  // Store data pointer, extents, and strides of the field view
+  auto set_desc = [] (AvgFieldDesc& d, const auto& v) {
+    d.data = v.data();
+    d.rank = v.rank;
+    for (int r=0; r<d.rank; ++r) {
+      d.extents[r] = v.extent_int(r);
+      d.strides[r] = v.stride(r);
+    }
+  };
+
+  for (int i=0,offset=0; i<nfields; ++i) {
+    const auto& name   = m_avg_fields_names[i];
+    const auto  field  = get_field(name);
+    const auto& layout = m_layouts.at(name);
+    auto& d = m_avg_descs_h(i);
+    switch (layout.rank()) {
+      case 1: set_desc(d,field.get_view<const Real*,Device>());      break;
+      case 2: set_desc(d,field.get_view<const Real**,Device>());     break;
+      case 3: set_desc(d,field.get_view<const Real***,Device>());    break;
+      case 4: set_desc(d,field.get_view<const Real****,Device>());   break;
+      case 5: set_desc(d,field.get_view<const Real*****,Device>());  break;
+      case 6: set_desc(d,field.get_view<const Real******,Device>()); break;
+      default:
+        EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(layout.rank()) + ") not supported by AtmosphereOutput.\n");
+    }
+
+    // The view extents include padding, while the output only uses the layout dims
+    for (int r=0; r<d.rank; ++r) {
+      d.extents[r] = layout.dim(r);
+    }
+    d.offset = offset;
+    offset += layout.size();
+  }
+  Kokkos::deep_copy(m_avg_descs,m_avg_descs_h);
+}
+/* ---------------------------------------------------------- */
 void AtmosphereOutput::
 reset_dev_views()
 {
   // Reset the local device views depending on the averaging type
   // Init dev view with an "identity" for avg_type
-  for (auto const& name : m_fields_names) {
-    switch (m_avg_type) {
-      case OutputAvgType::Instant:
-        // No averaging
-        break;
-      case OutputAvgType::Max:
-        Kokkos::deep_copy(m_dev_views_1d[name],-std::numeric_limits<Real>::infinity());
-        break;
-      case OutputAvgType::Min:
-        Kokkos::deep_copy(m_dev_views_1d[name],std::numeric_limits<Real>::infinity());
-        break;
-      case OutputAvgType::Average:
-        Kokkos::deep_copy(m_dev_views_1d[name],0);
-        break;
-      default:
-        EKAT_ERROR_MSG ("Unrecognized averaging type.\n");
-    }
+  // Note: only views that do not alias a field view need to be reset,
+  //       and they are all stored in the avg buffer.
+  switch (m_avg_type) {
+    case OutputAvgType::Instant:
+      // No averaging
+      break;
+    case OutputAvgType::Max:
+      Kokkos::deep_copy(m_avg_buffer,-std::numeric_limits<Real>::infinity());
+      break;
+    case OutputAvgType::Min:
+      Kokkos::deep_copy(m_avg_buffer,std::numeric_limits<Real>::infinity());
+      break;
+    case OutputAvgType::Average:
+      Kokkos::deep_copy(m_avg_buffer,0);
+      break;
+    default:
+      EKAT_ERROR_MSG ("Unrecognized averaging type.\n");
   }
 }
 /* ---------------------------------------------------------- */
@@ -652,10 +732,9 @@ Field AtmosphereOutput::get_field(const std::string& name, const bool eval_diagn
   } else if (m_diagnostics.find(name) != m_diagnostics.end()) {
     const auto& diag = m_diagnostics.at(name);
     if (eval_diagnostic) {
-      for (const auto& dep : m_diag_depends_on_diags.at(name)) {
-        get_field(dep,eval_diagnostic);
-      }
-      diag->compute_diagnostic();
+      // The registry takes care of the diags this one depends on, and skips
+      // the evaluation if it was already computed (by any stream) at this time.
+      m_diags_registry->compute_diagnostic(name,m_field_mgr->get_grid()->name());
     }
     return diag->get_diagnostic();
   } else {
@@ -665,19 +744,23 @@ Field AtmosphereOutput::get_field(const std::string& name, const bool eval_diagn
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::set_diagnostics()
 {
-  // Create all diagnostics
+  // Create all diagnostics (or grab them from the registry, if another
+  // stream already created them)
+  std::vector<std::string> new_diags;
   for (const auto& fname : m_fields_names) {
     if (!m_field_mgr->has_field(fname)) {
-      create_diagnostic(fname);
+      create_diagnostic(fname,new_diags);
     }
   }
 
-  // Set required fields for all diagnostics
+  // Set required fields for the diagnostics we created
   // NOTE: do this *after* creating all diags: in case the required
   //       field of certain diagnostics is itself a diagnostic,
   //       we want to make sure the required ones are all built.
-  for (const auto& dd : m_diagnostics) {
-    const auto& diag = dd.second;
+  // NOTE: diags grabbed from the registry were already set up by the stream
+  //       that created them.
+  for (const auto& name : new_diags) {
+    const auto& diag = m_diagnostics.at(name);
     for (const auto& req : diag->get_required_field_requests()) {
       const auto& req_field = get_field(req.fid.name());
       diag->set_required_field(req_field.get_const());
@@ -690,12 +773,20 @@ void AtmosphereOutput::set_diagnostics()
 }
 
 void AtmosphereOutput::
-create_diagnostic (const std::string& diag_field_name) {
+create_diagnostic (const std::string& diag_field_name,
+                   std::vector<std::string>& new_diags) {
+  const auto& grid_name = m_field_mgr->get_grid()->name();
+  if (m_diags_registry->has_diagnostic(diag_field_name,grid_name)) {
+    m_diagnostics.emplace(diag_field_name,m_diags_registry->get_diagnostic(diag_field_name,grid_name));
+    return;
+  }
+
   auto& diag_factory = AtmosphereDiagnosticFactory::instance();
 
   // Construct a diagnostic by this name
   ekat::ParameterList params;
   std::string diag_name;
+  std::vector<std::string> depends_on;
 
   // If the diagnostic is $field@lev$N/$field_bot/$field_top,
   // then we need to set some params
@@ -708,12 +799,11 @@ create_diagnostic (const std::string& diag_field_name) {
     tokens.pop_back();
     auto fname = ekat::join(tokens,"_");
     // If the field is itself a diagnostic, make sure it's built
-    if (diag_factory.has_product(fname) and
-        m_diagnostics.count(fname)==0) {
-      create_diagnostic(fname);
-      m_diag_depends_on_diags[diag_field_name].push_back(fname);
-    } else {
-      m_diag_depends_on_diags[diag_field_name].resize(0);
+    if (diag_factory.has_product(fname)) {
+      if (m_diagnostics.count(fname)==0) {
+        create_diagnostic(fname,new_diags);
+      }
+      depends_on.push_back(fname);
     }
     auto fid = get_field(fname).get_header().get_identifier();
     params.set("Field Name", fname);
@@ -725,13 +815,14 @@ create_diagnostic (const std::string& diag_field_name) {
     params.set("Field Level", lev_and_idx.back());
   } else {
     diag_name = diag_field_name;
-    m_diag_depends_on_diags[diag_field_name].resize(0);
   }
 
   // Create the diagnostic
   auto diag = diag_factory.create(diag_name,m_comm,params);
   diag->set_grids(m_grids_manager);
   m_diagnostics.emplace(diag_field_name,diag);
+  m_diags_registry->add_diagnostic(diag_field_name,grid_name,diag,depends_on);
+  new_diags.push_back(diag_field_name);
 }
 
 } // namespace scream
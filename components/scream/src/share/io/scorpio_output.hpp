@@ -3,11 +3,13 @@
 
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_async_writer.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
 #include "share/util//scream_time_stamp.hpp"
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/atm_process/atmosphere_diagnostic_registry.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
@@ -49,6 +51,8 @@
  *  Restart:
  *    Casename:                   STRING                (default: ${Casename})
  *    Perform Restart:            BOOL                  (default: true)
+ *  Async Output:                 BOOL                  (default: false)
+ *  Async Queue Depth:            INT                   (default: 2)
  *  -----
  *  The meaning of these parameters is the following:
  *  - Casename: the output filename root.
@@ -78,6 +82,14 @@
  *    - Perform Restart: if this is a restarted run, and Averaging Type is not Instant, this flag
  *      determines whether we want to restart the output history or start from scrach. That is,
  *      you can set this to false to force a fresh new history, even in a restarted run.
+ *  - Async Output: if true, at write steps the output fields are copied in a staging buffer,
+ *    and written to file by the process-wide writer thread (see AsyncWriter), while the model
+ *    keeps running. All other scorpio calls are also executed by that thread, in program order.
+ *    Requires MPI_THREAD_MULTIPLE support (otherwise output is synchronous). Ignored for
+ *    model restart output, which is always synchronous.
+ *  - Async Queue Depth: the max number of snapshots that can be in flight at any time.
+ *    Each snapshot needs a host staging buffer. If all are in use, the model waits for
+ *    the oldest snapshot to be written to file (back-pressure).
 
  *  Notes:
  *   - you can specify lists with either of the two syntaxes:
@@ -114,6 +126,7 @@ public:
   using gm_type       = GridsManager;
   using remapper_type = AbstractRemapper;
   using atm_diag_type = AtmosphereDiagnostic;
+  using diag_registry_type = AtmosphereDiagnosticRegistry;
 
   using KT = KokkosTypes<DefaultDevice>;
   template<int N>
@@ -134,9 +147,13 @@ public:
   //  - is_model_restart_output: if true, this Output is for model restart files.
   //    In this case, we have to also create an "rpointer.atm" file (which
   //    contains metadata, and is expected by the component coupled)
+  // If a diagnostics registry is passed, diagnostics are looked up in (and stored into)
+  // the registry, so that streams sharing the registry also share (and evaluate only once
+  // per time step) their common diagnostics. This is ignored if fields are remapped.
   AtmosphereOutput(const ekat::Comm& comm, const ekat::ParameterList& params,
                    const std::shared_ptr<const fm_type>& field_mgr,
-                   const std::shared_ptr<const gm_type>& grids_mgr);
+                   const std::shared_ptr<const gm_type>& grids_mgr,
+                   const std::shared_ptr<diag_registry_type>& diags_registry = nullptr);
 
   // Main Functions
   void restart (const std::string& filename);
@@ -146,6 +163,15 @@ public:
   void run (const std::string& filename, const bool write, const int nsteps_since_last_output);
   void finalize() {}
 
+  // Async output. Once staging buffers are set up, run_async can be called on write
+  // steps in place of run: rather than writing to file, it copies the output data in
+  // the staging slot 'slot', and returns a task that will write it to file later.
+  // The caller must ensure the slot is not used by any snapshot still in flight.
+  void setup_async_staging (const int queue_depth);
+  AsyncWriter::task_type run_async (const std::string& filename,
+                                    const int nsteps_since_last_output,
+                                    const int slot);
+
   long long res_dep_memory_footprint () const;
 protected:
   // Internal functions
@@ -157,9 +183,12 @@ protected:
   void set_degrees_of_freedom(const std::string& filename);
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
+  void set_avg_fields_descs ();
+  void update_avg_views (const bool is_write_step, const int nsteps_since_last_output);
   Field get_field(const std::string& name, const bool eval_diagnostic = false) const;
   void set_diagnostics();
-  void create_diagnostic (const std::string& diag_name);
+  void create_diagnostic (const std::string& diag_name,
+                          std::vector<std::string>& new_diags);
 
   // --- Internal variables --- //
   ekat::Comm                          m_comm;
@@ -178,11 +207,42 @@ protected:
   std::map<std::string,int>                             m_dofs;
   std::map<std::string,int>                             m_dims;
   std::map<std::string,std::shared_ptr<atm_diag_type>>  m_diagnostics;
-  std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
+  std::shared_ptr<diag_registry_type>                   m_diags_registry;
 
   // Local views of each field to be used for "averaging" output and writing to file.
   std::map<std::string,view_1d_host>    m_host_views_1d;
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
+
+  // The dev views that do not alias a field view are stored contiguously in
+  // a single buffer, and described by a table of field descriptors, so that
+  // all of them can be updated at once, with a single kernel launch.
+  // For each field, the descriptor stores the field data pointer, together
+  // with extents and strides of the field view (which may be padded or
+  // strided), and the offset of the field dev view in the buffer.
+  struct AvgFieldDesc {
+    const Real* data;
+    int rank;
+    int extents[Field::MaxRank];
+    int strides[Field::MaxRank];
+    int offset;
+  };
+  using avg_descs_dev  = typename KT::template view_1d<AvgFieldDesc>;
+  using avg_descs_host = typename avg_descs_dev::HostMirror;
+
+  view_1d_dev                           m_avg_buffer;
+  std::vector<std::string>              m_avg_fields_names;
+  avg_descs_dev                         m_avg_descs;
+  avg_descs_host                        m_avg_descs_h;
+
+  // If a field is a dynamic subfield, its data pointer can change at runtime,
+  // so we need to refresh the descriptors before each update
+  bool                                  m_refresh_avg_descs = false;
+
+  // Staging buffers for async output: each field occupies the range
+  // [first,second) of the buffers. There is one host buffer per queue slot.
+  std::map<std::string,std::pair<int,int>>  m_staging_ranges;
+  view_1d_dev                               m_staging_dev;
+  std::vector<view_1d_host>                 m_staging_host;
 };
 
 } //namespace scream
@@ -0,0 +1,164 @@
+#include "share/io/scream_async_writer.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <mpi.h>
+
+namespace scream
+{
+
+AsyncWriter& AsyncWriter::instance ()
+{
+  static AsyncWriter writer;
+  return writer;
+}
+
+AsyncWriter::~AsyncWriter ()
+{
+  // Should have been stopped during scorpio finalization. If not, make sure we
+  // don't destroy a joinable thread, but don't throw from a destructor.
+  try {
+    stop ();
+  } catch (...) {}
+}
+
+bool AsyncWriter::start ()
+{
+  if (is_threaded()) {
+    return true;
+  }
+
+  int thread_level;
+  MPI_Query_thread(&thread_level);
+  if (thread_level!=MPI_THREAD_MULTIPLE) {
+    return false;
+  }
+
+  m_stop = false;
+  m_thread = std::thread(&AsyncWriter::worker_loop,this);
+  return true;
+}
+
+void AsyncWriter::stop ()
+{
+  if (not is_threaded()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cv_task_added.notify_one();
+  m_thread.join();
+
+  // The worker executed all pending tasks before returning
+  std::lock_guard<std::mutex> lock(m_mutex);
+  rethrow_if_failed ();
+}
+
+AsyncWriter::ticket_type AsyncWriter::enqueue (task_type&& task)
+{
+  if (not is_threaded()) {
+    task();
+    return ++m_num_enqueued;
+  }
+
+  ticket_type ticket;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    rethrow_if_failed ();
+
+    m_tasks.emplace_back(std::move(task));
+    ticket = ++m_num_enqueued;
+  }
+  m_cv_task_added.notify_one();
+  return ticket;
+}
+
+void AsyncWriter::wait_for (const ticket_type ticket)
+{
+  if (not is_threaded()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cv_task_done.wait(lock,[&]{ return m_num_done>=ticket || m_error; });
+  rethrow_if_failed ();
+}
+
+void AsyncWriter::wait_all ()
+{
+  if (not is_threaded()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cv_task_done.wait(lock,[&]{ return m_num_done==m_num_enqueued || m_error; });
+  rethrow_if_failed ();
+}
+
+void AsyncWriter::run_sync (const task_type& task)
+{
+  if (not is_threaded() || std::this_thread::get_id()==m_thread.get_id()) {
+    task();
+    return;
+  }
+
+  // Catch the task exception here, so that it is rethrown to this caller,
+  // rather than to whoever waits on the writer next.
+  std::exception_ptr err;
+  const auto ticket = enqueue([&]() {
+    try {
+      task();
+    } catch (...) {
+      err = std::current_exception();
+    }
+  });
+  wait_for(ticket);
+  if (err) {
+    std::rethrow_exception(err);
+  }
+}
+
+void AsyncWriter::worker_loop ()
+{
+  while (true) {
+    task_type task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv_task_added.wait(lock,[&]{ return m_stop || not m_tasks.empty(); });
+      if (m_tasks.empty()) {
+        // We were asked to stop, and there's nothing left to do.
+        return;
+      }
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+
+    try {
+      task();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_error = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ++m_num_done;
+    }
+    m_cv_task_done.notify_all();
+  }
+}
+
+void AsyncWriter::rethrow_if_failed ()
+{
+  // Note: must be called with m_mutex locked
+  if (m_error) {
+    auto err = m_error;
+    m_error = nullptr;
+    std::rethrow_exception(err);
+  }
+}
+
+} // namespace scream
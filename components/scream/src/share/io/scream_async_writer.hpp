@@ -0,0 +1,103 @@
+#ifndef SCREAM_ASYNC_WRITER_HPP
+#define SCREAM_ASYNC_WRITER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace scream
+{
+
+/*
+ * The process-wide scorpio writer: a FIFO task queue, executed by a single thread.
+ *
+ * The scorpio F90 module state is global, and not thread safe. Moreover, most
+ * scorpio calls are collective, so all ranks must issue them in the same order.
+ * Therefore, all scorpio calls on files open for output (see scream_scorpio_interface.cpp)
+ * are executed by this writer, one at a time, in the order they are issued on
+ * this rank. Since the program order is the same on all ranks, so is the order
+ * of the collective calls. Files open for input are handled by the calling thread,
+ * in a separate context of the F90 module, so reads never queue behind output.
+ *
+ * When the writer thread is started, output files use their own pio subsystem,
+ * on a duplicate of the atm communicator. Hence, the writer can keep running
+ * while the rest of the model (or, in CIME runs, other components) use pio/MPI.
+ * Pending output only needs to be drained at restart/checkpoint steps (so that
+ * restart and history files are consistent) and at finalization.
+ *
+ * There are two ways to submit work:
+ *  - run_sync: the task is queued behind all tasks submitted earlier, and the caller
+ *    blocks until it is done. This is how scorpio calls on output files are issued.
+ *  - enqueue: the task runs in the background, and the caller gets a ticket,
+ *    which can be used to wait for it (and for all the tasks submitted before it).
+ *    This is used by the OutputManager to write output snapshots asynchronously.
+ *
+ * The writer thread is started only upon request (see start). Until then (or if
+ * it cannot be started), tasks are executed right away on the calling thread.
+ * Since the writer thread calls into MPI concurrently with the rest of the model,
+ * it can only be started if MPI was initialized with MPI_THREAD_MULTIPLE.
+ *
+ * Exceptions thrown by background tasks are stored, and rethrown on the calling
+ * thread during the next call to enqueue, run_sync, wait_for, or wait_all.
+ */
+
+class AsyncWriter
+{
+public:
+  using task_type   = std::function<void()>;
+  using ticket_type = long long;
+
+  static AsyncWriter& instance ();
+
+  AsyncWriter (const AsyncWriter&) = delete;
+  AsyncWriter& operator= (const AsyncWriter&) = delete;
+
+  // Start the writer thread (no-op if already started). Returns false if
+  // MPI does not support MPI_THREAD_MULTIPLE, in which case tasks keep
+  // being executed synchronously.
+  bool start ();
+
+  // Execute all pending tasks, then join the writer thread.
+  void stop ();
+
+  bool is_threaded () const { return m_thread.joinable(); }
+
+  // Add a task to the queue, and return its ticket
+  ticket_type enqueue (task_type&& task);
+
+  // Blocks until the task with the given ticket (and all the ones before it) has been executed
+  void wait_for (const ticket_type ticket);
+
+  // Blocks until all enqueued tasks have been executed
+  void wait_all ();
+
+  // Execute task after all pending ones, and wait for it. Exceptions thrown
+  // by the task are rethrown here. If called from the writer thread itself,
+  // the task is executed right away.
+  void run_sync (const task_type& task);
+
+protected:
+  AsyncWriter () = default;
+  ~AsyncWriter ();
+
+  void worker_loop ();
+  void rethrow_if_failed ();
+
+  std::deque<task_type>     m_tasks;
+  ticket_type               m_num_enqueued = 0;
+  ticket_type               m_num_done = 0;
+  bool                      m_stop = false;
+  std::exception_ptr        m_error;
+
+  std::mutex                m_mutex;
+  std::condition_variable   m_cv_task_added;
+  std::condition_variable   m_cv_task_done;
+  std::thread               m_thread;
+};
+
+} // namespace scream
+
+#endif // SCREAM_ASYNC_WRITER_HPP
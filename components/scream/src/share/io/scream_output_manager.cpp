@@ -9,6 +9,7 @@
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 
@@ -77,7 +78,7 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
 
   // For each grid, create a separate output stream.
   if (field_mgrs.size()==1) {
-    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr);
+    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr,m_diags_registry);
     m_output_streams.push_back(output);
   } else {
     const auto& fields_pl = m_params.sublist("Fields");
@@ -89,11 +90,32 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
       EKAT_REQUIRE_MSG (field_mgrs.find(gname)!=field_mgrs.end(),
           "Error! Output requested on grid '" + gname + "', but no field manager is available for such grid.\n");
 
-      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr);
+      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr,m_diags_registry);
       m_output_streams.push_back(output);
     }
   }
 
+  // Async output: output snapshots are staged, and written to file by a background thread.
+  // Model restart files must be complete when the rpointer file is updated, so they
+  // are always written synchronously.
+  // Note: the writer is process-wide, and it also executes all other scorpio calls on
+  //       output files, so that they happen in the same order on all ranks
+  //       (see scream_async_writer.hpp).
+  if (not m_is_model_restart_output && m_params.get("Async Output",false)) {
+    const int queue_depth = m_params.get("Async Queue Depth",2);
+    EKAT_REQUIRE_MSG (queue_depth>0,
+        "Error! Invalid async output queue depth: " + std::to_string(queue_depth) + "\n");
+    if (not AsyncWriter::instance().start() && m_io_comm.am_i_root()) {
+      printf("WARNING! Async output requires MPI_THREAD_MULTIPLE support.\n"
+             "         Output snapshots will be written synchronously.\n");
+    }
+    m_async_output = true;
+    m_async_slots_tickets.resize(queue_depth,0);
+    for (auto& it : m_output_streams) {
+      it->setup_async_staging(queue_depth);
+    }
+  }
+
   const auto has_restart_data = (m_avg_type!=OutputAvgType::Instant && m_output_control.frequency>1);
   if (has_restart_data && m_params.isSublist("Checkpoint Control")) {
     // Output control
@@ -186,6 +208,13 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   auto& filespecs = is_checkpoint_step ? m_checkpoint_file_specs : m_output_file_specs;
   auto& filename  = filespecs.filename;
 
+  // Only regular output snapshots are written asynchronously. Checkpoint files
+  // are written synchronously, same as the file definition phase.
+  // Note: all scorpio calls on output files go through the writer, so the calls below
+  //       are executed after any pending snapshot (of any output manager) has been written.
+  const bool is_async_step = m_async_output && is_output_step;
+  m_wrote_restart_data = is_write_step && (m_is_model_restart_output || is_checkpoint_step);
+
   // Compute filename (if write step)
   if (is_write_step) {
     // Check if we need to open a new file
@@ -198,7 +227,7 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 
       // Register new netCDF file for output. First, check no other output managers
       // are trying to write on the same file
-      EKAT_REQUIRE_MSG (not is_file_open_c2f(filename.c_str(),Write),
+      EKAT_REQUIRE_MSG (not is_file_open(filename,Write),
           "Error! File '" + filename + "' is currently open for write. Cannot share with other output managers.\n");
       register_file(filename,Write);
 
@@ -233,8 +262,8 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       eam_pio_enddef (filename); 
       auto t0_date = m_case_t0.get_date()[0]*10000 + m_case_t0.get_date()[1]*100 + m_case_t0.get_date()[2];
       auto t0_time = m_case_t0.get_time()[0]*10000 + m_case_t0.get_time()[1]*100 + m_case_t0.get_time()[2];
-      set_int_attribute_c2f(filename.c_str(),"start_date",t0_date);
-      set_int_attribute_c2f(filename.c_str(),"start_time",t0_time);
+      set_int_attribute(filename,"start_date",t0_date);
+      set_int_attribute(filename,"start_time",t0_time);
       filespecs.is_open = true;
     }
 
@@ -250,22 +279,29 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     }
 
     // Update time and nsteps in the output file
-    pio_update_time(filename,timestamp.days_from(m_case_t0));
-    if (m_is_model_restart_output) {
-      // Only write nsteps on model restart
-      set_int_attribute_c2f(filename.c_str(),"nsteps",timestamp.get_num_steps());
+    // Note: for async output, this is done by the writer.
+    if (not is_async_step) {
+      pio_update_time(filename,timestamp.days_from(m_case_t0));
+      if (m_is_model_restart_output) {
+        // Only write nsteps on model restart
+        set_int_attribute(filename,"nsteps",timestamp.get_num_steps());
+      }
     }
   }
 
-  // Run the output streams
-  for (auto& it : m_output_streams) {
-    // Note: filename might reference an invalid string, but it's only used
-    //       in case is_write_step=true, in which case it will *for sure* contain
-    //       a valid file name.
-    it->run(filename,is_write_step,m_output_control.nsamples_since_last_write);
+  if (is_async_step) {
+    run_async (timestamp);
+  } else {
+    // Run the output streams
+    for (auto& it : m_output_streams) {
+      // Note: filename might reference an invalid string, but it's only used
+      //       in case is_write_step=true, in which case it will *for sure* contain
+      //       a valid file name.
+      it->run(filename,is_write_step,m_output_control.nsamples_since_last_write);
+    }
   }
 
-  if (is_write_step) {
+  if (is_write_step && not is_async_step) {
     for (const auto& it : m_globals) {
       const auto& name = it.first;
       const auto& type_any = it.second;
@@ -273,7 +309,7 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       const auto& any = type_any.second;
       if (type=="int") {
         const int& value = ekat::any_cast<int>(any);
-        set_int_attribute_c2f(filename.c_str(),name.c_str(),value);
+        set_int_attribute(filename,name,value);
       } else {
         EKAT_ERROR_MSG ("Error! Unsupported global attribute type.\n"
             " - file name  : " + filename + "\n"
@@ -298,8 +334,11 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     }
 
     // Check if we need to close the output file
+    // Note: for async output, the writer closes the file.
     if (filespecs.file_is_full()) {
-      eam_pio_closefile(filename);
+      if (not is_async_step) {
+        eam_pio_closefile(filename);
+      }
       filespecs.num_snapshots_in_file = 0;
       filespecs.is_open = false;
     }
@@ -310,8 +349,57 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   }
 }
 /*===============================================================================================*/
+void OutputManager::run_async (const util::TimeStamp& timestamp)
+{
+  using namespace scorpio;
+
+  auto& writer = AsyncWriter::instance();
+
+  // Make sure the staging slot we are about to use is no longer in flight
+  const int slot = m_num_async_snapshots % m_async_slots_tickets.size();
+  writer.wait_for(m_async_slots_tickets[slot]);
+  ++m_num_async_snapshots;
+
+  // Snapshot the output of all streams in the staging buffers
+  const auto& filename = m_output_file_specs.filename;
+  std::vector<AsyncWriter::task_type> streams_writes;
+  for (auto& it : m_output_streams) {
+    streams_writes.push_back(it->run_async(filename,m_output_control.nsamples_since_last_write,slot));
+  }
+
+  // Note: the file is closed after this snapshot only if it becomes full
+  const auto time = timestamp.days_from(m_case_t0);
+  const auto globals = m_globals;
+  const bool close_file = (m_output_file_specs.num_snapshots_in_file+1)==m_output_file_specs.max_snapshots_in_file;
+  m_async_slots_tickets[slot] = writer.enqueue([filename,time,streams_writes,globals,close_file]() {
+    pio_update_time(filename,time);
+    for (const auto& w : streams_writes) {
+      w();
+    }
+    for (const auto& it : globals) {
+      const auto& name = it.first;
+      const auto& type = it.second.first;
+      const auto& any  = it.second.second;
+      EKAT_REQUIRE_MSG (type=="int",
+          "Error! Unsupported global attribute type.\n"
+          " - file name  : " + filename + "\n"
+          " - global name: " + name + "'\n"
+          " - global type: " + type + "'\n");
+      set_int_attribute(filename,name,ekat::any_cast<int>(any));
+    }
+    if (close_file) {
+      eam_pio_closefile(filename);
+    }
+  });
+}
+/*===============================================================================================*/
 void OutputManager::finalize()
 {
+  // Make sure all pending snapshots are on file (tickets are increasing)
+  if (m_async_output) {
+    AsyncWriter::instance().wait_for(*std::max_element(m_async_slots_tickets.begin(),m_async_slots_tickets.end()));
+  }
+
   // Swapping with an empty mgr is the easiest way to cleanup.
   OutputManager other;
   std::swap(*this,other);
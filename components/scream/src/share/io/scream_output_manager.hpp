@@ -4,6 +4,7 @@
 #include "share/io/scorpio_output.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_async_writer.hpp"
 
 #include "share/field/field_manager.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -107,9 +108,19 @@ public:
   }
 
   void setup_globals_map (const globals_map_t& globals);
+
+  // If set (before calling setup), diagnostics are shared with all the other
+  // output managers using the same registry. See AtmosphereDiagnosticRegistry.
+  void set_diagnostics_registry (const std::shared_ptr<AtmosphereDiagnosticRegistry>& registry) {
+    m_diags_registry = registry;
+  }
+
   void run (const util::TimeStamp& current_ts);
   void finalize();
 
+  // Whether the last call to run wrote a model restart or a checkpoint file
+  bool wrote_restart_data () const { return m_wrote_restart_data; }
+
   long long res_dep_memory_footprint () const;
 protected:
 
@@ -118,6 +129,9 @@ protected:
                                 const std::string suffix,
                                 const util::TimeStamp& timestamp) const;
 
+  // Snapshot the output streams, and enqueue the snapshot write in the async writer
+  void run_async (const util::TimeStamp& timestamp);
+
   // Craft the restart parameter list
   void set_params (const ekat::ParameterList& params,
                    const std::map<std::string,std::shared_ptr<fm_type>>& field_mgrs);
@@ -128,6 +142,9 @@ protected:
   std::vector<output_ptr_type>   m_output_streams;
   globals_map_t                  m_globals;
 
+  // Diagnostics possibly shared with other output managers (can be null)
+  std::shared_ptr<AtmosphereDiagnosticRegistry>  m_diags_registry;
+
   ekat::Comm                     m_io_comm;
   ekat::ParameterList            m_params;
 
@@ -139,6 +156,7 @@ protected:
 
   // Whether this OutputManager handles a model restart file, or normal model output.
   bool m_is_model_restart_output;
+  bool m_wrote_restart_data = false;
 
   // Frequency of output and checkpointing
   // See scream_io_utils.hpp for details.
@@ -159,6 +177,13 @@ protected:
   // restart happens, and the latter being the start time of the *original* run.
   util::TimeStamp   m_case_t0;
   util::TimeStamp   m_run_t0;
+
+  // If async output is on, output snapshots are written in the background by the
+  // process-wide AsyncWriter. Staging slots are used round-robin, based on the number
+  // of snapshots enqueued, and we store the writer ticket of the last snapshot in each slot.
+  bool                                    m_async_output = false;
+  std::vector<AsyncWriter::ticket_type>   m_async_slots_tickets;
+  int                                     m_num_async_snapshots = 0;
 };
 
 } // namespace scream
@@ -4,9 +4,13 @@
 
 #include "ekat/ekat_assert.hpp"
 #include "share/scream_types.hpp"
+#include "share/io/scream_async_writer.hpp"
 
 #include <pio.h>
+#include <mpi.h>
 
+#include <map>
+#include <mutex>
 #include <string>
 
 
@@ -15,29 +19,34 @@ using scream::Int;
 extern "C" {
 
 // Fortran routines to be called from C++
+// Note: ctx is the I/O context of the file in the F90 module, which
+//       coincides with the mode the file was registered with.
   void register_file_c2f(const char*&& filename, const int& mode);
-  void set_decomp_c2f(const char*&& filename);
-  void set_dof_c2f(const char*&& filename,const char*&& varname,const Int dof_len,const std::int64_t *x_dof);
-  void grid_read_data_array_c2f_int(const char*&& filename, const char*&& varname, const Int time_index, int *buf, const int buf_size);
-  void grid_read_data_array_c2f_float(const char*&& filename, const char*&& varname, const Int time_index, float *buf, const int buf_size);
-  void grid_read_data_array_c2f_double(const char*&& filename, const char*&& varname, const Int time_index, double *buf, const int buf_size);
-
-  void grid_write_data_array_c2f_int(const char*&& filename, const char*&& varname, const int* buf, const int buf_size);
-  void grid_write_data_array_c2f_float(const char*&& filename, const char*&& varname, const float* buf, const int buf_size);
-  void grid_write_data_array_c2f_double(const char*&& filename, const char*&& varname, const double* buf, const int buf_size);
-  void eam_init_pio_subsystem_c2f(const int mpicom, const int atm_id);
+  void set_decomp_c2f(const int ctx, const char*&& filename);
+  void set_dof_c2f(const int ctx, const char*&& filename,const char*&& varname,const Int dof_len,const std::int64_t *x_dof);
+  void grid_read_data_array_c2f_int(const int ctx, const char*&& filename, const char*&& varname, const Int time_index, int *buf, const int buf_size);
+  void grid_read_data_array_c2f_float(const int ctx, const char*&& filename, const char*&& varname, const Int time_index, float *buf, const int buf_size);
+  void grid_read_data_array_c2f_double(const int ctx, const char*&& filename, const char*&& varname, const Int time_index, double *buf, const int buf_size);
+
+  void grid_write_data_array_c2f_int(const int ctx, const char*&& filename, const char*&& varname, const int* buf, const int buf_size);
+  void grid_write_data_array_c2f_float(const int ctx, const char*&& filename, const char*&& varname, const float* buf, const int buf_size);
+  void grid_write_data_array_c2f_double(const int ctx, const char*&& filename, const char*&& varname, const double* buf, const int buf_size);
+  void eam_init_pio_subsystem_c2f(const int mpicom, const int atm_id, const bool own_output_subsystem);
   void eam_pio_finalize_c2f();
-  void eam_pio_closefile_c2f(const char*&& filename);
-  void pio_update_time_c2f(const char*&& filename,const double time);
-  void register_dimension_c2f(const char*&& filename, const char*&& shortname, const char*&& longname, const int length);
-  void register_variable_c2f(const char*&& filename, const char*&& shortname, const char*&& longname,
+  void eam_pio_closefile_c2f(const int ctx, const char*&& filename);
+  void pio_update_time_c2f(const int ctx, const char*&& filename,const double time);
+  void register_dimension_c2f(const int ctx, const char*&& filename, const char*&& shortname, const char*&& longname, const int length);
+  void register_variable_c2f(const int ctx, const char*&& filename, const char*&& shortname, const char*&& longname,
                              const char*&& units, const int numdims, const char** var_dimensions,
                              const int dtype, const int nc_dtype, const char*&& pio_decomp_tag);
-  void set_variable_metadata_c2f (const char*&& filename, const char*&& varname, const char*&& meta_name, const char*&& meta_val);
-  void get_variable_c2f(const char*&& filename,const char*&& shortname, const char*&& longname,
+  void set_variable_metadata_c2f (const int ctx, const char*&& filename, const char*&& varname, const char*&& meta_name, const char*&& meta_val);
+  void get_variable_c2f(const int ctx, const char*&& filename,const char*&& shortname, const char*&& longname,
                         const int numdims, const char** var_dimensions,
                         const int dtype, const char*&& pio_decomp_tag);
-  void eam_pio_enddef_c2f(const char*&& filename);
+  void eam_pio_enddef_c2f(const int ctx, const char*&& filename);
+  int get_int_attribute_c2f (const int ctx, const char*&& filename, const char*&& attr_name);
+  void set_int_attribute_c2f (const int ctx, const char*&& filename, const char*&& attr_name, const int& value);
+  int get_dimlen_c2f(const int ctx, const char*&& filename, const char*&& dimname);
 } // extern C
 
 namespace scream {
@@ -62,6 +71,64 @@ int nctype (const std::string& type) {
   }
 }
 /* ----------------------------------------------------------------- */
+// Files open in Write mode are handled by the process-wide AsyncWriter, one call
+// at a time, in the order the calls are issued on this rank. Files open in Read
+// mode are handled right away by the calling thread, so that reads never wait
+// for pending output. The two kinds of files live in separate I/O contexts in
+// the F90 module, so the writer thread and the rest of the model can use scorpio
+// concurrently (see scream_async_writer.hpp).
+namespace {
+
+struct OpenFile {
+  FileMode mode;
+  int num_customers = 0;
+};
+
+// All files currently open, with the mode they were opened with. Since a file
+// can be closed by the writer thread, access is guarded by a mutex.
+std::mutex& open_files_mutex () {
+  static std::mutex m;
+  return m;
+}
+std::map<std::string,OpenFile>& open_files () {
+  static std::map<std::string,OpenFile> files;
+  return files;
+}
+
+// Guards the F90 state of the Read context, in case files in Read mode are
+// accessed by different threads (e.g., by atm processes running concurrently).
+// Note: most calls are collective, so they must still be issued in the same
+//       order on all ranks.
+std::mutex& read_ctx_mutex () {
+  static std::mutex m;
+  return m;
+}
+
+template<typename F>
+void run_in_ctx (const FileMode ctx, F&& f) {
+  if (ctx==Write) {
+    AsyncWriter::instance().run_sync([&](){ f(ctx); });
+  } else {
+    std::lock_guard<std::mutex> lock(read_ctx_mutex());
+    f(ctx);
+  }
+}
+
+FileMode get_file_mode (const std::string& filename) {
+  std::lock_guard<std::mutex> lock(open_files_mutex());
+  auto it = open_files().find(filename);
+  EKAT_REQUIRE_MSG (it!=open_files().end(),
+      "Error! File '" + filename + "' is not open.\n");
+  return it->second.mode;
+}
+
+template<typename F>
+void run_on_file (const std::string& filename, F&& f) {
+  run_in_ctx(get_file_mode(filename),f);
+}
+
+} // anonymous namespace
+/* ----------------------------------------------------------------- */
 
 void eam_init_pio_subsystem(const int mpicom, const int atm_id) {
   // TODO: Right now the compid has been hardcoded to 0 and the flag
@@ -69,40 +136,71 @@ void eam_init_pio_subsystem(const int mpicom, const int atm_id) {
   // When surface coupling is established we will need to refactor this
   // routine to pass the appropriate values depending on if we are running
   // the full model or a unit test.
-  eam_init_pio_subsystem_c2f(mpicom,atm_id);
+
+  // If the AsyncWriter thread can be started, files open in Write mode get their
+  // own pio subsystem (on their own communicator), so that the writer can keep
+  // going while the atm (or, in CIME runs, other components) use pio.
+  int thread_level;
+  MPI_Query_thread(&thread_level);
+  const bool own_output_subsystem = thread_level==MPI_THREAD_MULTIPLE;
+  eam_init_pio_subsystem_c2f(mpicom,atm_id,own_output_subsystem);
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_finalize() {
+  // Write all pending output, and stop the writer thread (if any)
+  AsyncWriter::instance().stop();
   eam_pio_finalize_c2f();
+
+  std::lock_guard<std::mutex> lock(open_files_mutex());
+  open_files().clear();
 }
 /* ----------------------------------------------------------------- */
 void register_file(const std::string& filename, const FileMode mode) {
-  register_file_c2f(filename.c_str(),mode);
+  {
+    // Only files open in Read mode can have more than one customer
+    std::lock_guard<std::mutex> lock(open_files_mutex());
+    auto it = open_files().find(filename);
+    EKAT_REQUIRE_MSG (it==open_files().end() || (mode==Read && it->second.mode==Read),
+        "Error! File '" + filename + "' is already open, and cannot be opened again in the requested mode.\n");
+  }
+
+  run_in_ctx(mode,[&](const int){ register_file_c2f(filename.c_str(),mode); });
+
+  std::lock_guard<std::mutex> lock(open_files_mutex());
+  auto& file = open_files()[filename];
+  file.mode = mode;
+  ++file.num_customers;
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_closefile(const std::string& filename) {
 
-  eam_pio_closefile_c2f(filename.c_str());
+  run_on_file(filename,[&](const int ctx){ eam_pio_closefile_c2f(ctx,filename.c_str()); });
+
+  std::lock_guard<std::mutex> lock(open_files_mutex());
+  auto it = open_files().find(filename);
+  if (--it->second.num_customers==0) {
+    open_files().erase(it);
+  }
 }
 /* ----------------------------------------------------------------- */
 void set_decomp(const std::string& filename) {
 
-  set_decomp_c2f(filename.c_str());
+  run_on_file(filename,[&](const int ctx){ set_decomp_c2f(ctx,filename.c_str()); });
 }
 /* ----------------------------------------------------------------- */
 void set_dof(const std::string& filename, const std::string& varname, const Int dof_len, const std::int64_t* x_dof) {
 
-  set_dof_c2f(filename.c_str(),varname.c_str(),dof_len,x_dof);
+  run_on_file(filename,[&](const int ctx){ set_dof_c2f(ctx,filename.c_str(),varname.c_str(),dof_len,x_dof); });
 }
 /* ----------------------------------------------------------------- */
 void pio_update_time(const std::string& filename, const double time) {
 
-  pio_update_time_c2f(filename.c_str(),time);
+  run_on_file(filename,[&](const int ctx){ pio_update_time_c2f(ctx,filename.c_str(),time); });
 }
 /* ----------------------------------------------------------------- */
 void register_dimension(const std::string &filename, const std::string& shortname, const std::string& longname, const int length) {
 
-  register_dimension_c2f(filename.c_str(), shortname.c_str(), longname.c_str(), length);
+  run_on_file(filename,[&](const int ctx){ register_dimension_c2f(ctx,filename.c_str(), shortname.c_str(), longname.c_str(), length); });
 }
 /* ----------------------------------------------------------------- */
 void get_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
@@ -116,8 +214,10 @@ void get_variable(const std::string &filename, const std::string& shortname, con
   {
     var_dimensions_c[ii] = var_dimensions[ii].c_str();
   }
-  get_variable_c2f(filename.c_str(), shortname.c_str(), longname.c_str(),
-                   numdims, var_dimensions_c.data(), nctype(dtype), pio_decomp_tag.c_str());
+  run_on_file(filename,[&](const int ctx){
+    get_variable_c2f(ctx,filename.c_str(), shortname.c_str(), longname.c_str(),
+                     numdims, var_dimensions_c.data(), nctype(dtype), pio_decomp_tag.c_str());
+  });
 }
 /* ----------------------------------------------------------------- */
 void register_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
@@ -131,46 +231,70 @@ void register_variable(const std::string &filename, const std::string& shortname
   {
     var_dimensions_c[ii] = var_dimensions[ii].c_str();
   }
-  register_variable_c2f(filename.c_str(), shortname.c_str(), longname.c_str(),
-                        units.c_str(), numdims, var_dimensions_c.data(),
-                        nctype(dtype), nctype(nc_dtype), pio_decomp_tag.c_str());
+  run_on_file(filename,[&](const int ctx){
+    register_variable_c2f(ctx,filename.c_str(), shortname.c_str(), longname.c_str(),
+                          units.c_str(), numdims, var_dimensions_c.data(),
+                          nctype(dtype), nctype(nc_dtype), pio_decomp_tag.c_str());
+  });
 }
 /* ----------------------------------------------------------------- */
 void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const std::string& meta_val) {
-  set_variable_metadata_c2f(filename.c_str(),varname.c_str(),meta_name.c_str(),meta_val.c_str());
+  run_on_file(filename,[&](const int ctx){ set_variable_metadata_c2f(ctx,filename.c_str(),varname.c_str(),meta_name.c_str(),meta_val.c_str()); });
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_enddef(const std::string &filename) {
-  eam_pio_enddef_c2f(filename.c_str());
+  run_on_file(filename,[&](const int ctx){ eam_pio_enddef_c2f(ctx,filename.c_str()); });
+}
+/* ----------------------------------------------------------------- */
+bool is_file_open(const std::string& filename, const FileMode mode) {
+  std::lock_guard<std::mutex> lock(open_files_mutex());
+  auto it = open_files().find(filename);
+  return it!=open_files().end() && it->second.mode==mode;
+}
+/* ----------------------------------------------------------------- */
+int get_int_attribute (const std::string& filename, const std::string& attr_name) {
+  int val;
+  run_on_file(filename,[&](const int ctx){ val = get_int_attribute_c2f(ctx,filename.c_str(),attr_name.c_str()); });
+  return val;
+}
+/* ----------------------------------------------------------------- */
+void set_int_attribute (const std::string& filename, const std::string& attr_name, const int value) {
+  run_on_file(filename,[&](const int ctx){ set_int_attribute_c2f(ctx,filename.c_str(),attr_name.c_str(),value); });
+}
+/* ----------------------------------------------------------------- */
+int get_dimlen(const std::string& filename, const std::string& dimname) {
+  int len;
+  run_on_file(filename,[&](const int ctx){ len = get_dimlen_c2f(ctx,filename.c_str(),dimname.c_str()); });
+  return len;
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_read_data_array<int>(const std::string &filename, const std::string &varname,
                           const int time_index, int *hbuf, const int buf_size) {
-  grid_read_data_array_c2f_int(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
+  run_on_file(filename,[&](const int ctx){ grid_read_data_array_c2f_int(ctx,filename.c_str(),varname.c_str(),time_index,hbuf,buf_size); });
 }
 template<>
 void grid_read_data_array<float>(const std::string &filename, const std::string &varname,
                                 const int time_index, float *hbuf, const int buf_size) {
-  grid_read_data_array_c2f_float(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
+  run_on_file(filename,[&](const int ctx){ grid_read_data_array_c2f_float(ctx,filename.c_str(),varname.c_str(),time_index,hbuf,buf_size); });
 }
 template<>
 void grid_read_data_array<double>(const std::string &filename, const std::string &varname,
                                   const int time_index, double *hbuf, const int buf_size) {
-  grid_read_data_array_c2f_double(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
+  run_on_file(filename,[&](const int ctx){ grid_read_data_array_c2f_double(ctx,filename.c_str(),varname.c_str(),time_index,hbuf,buf_size); });
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_write_data_array<int>(const std::string &filename, const std::string &varname, const int* hbuf, const int buf_size) {
-  grid_write_data_array_c2f_int(filename.c_str(),varname.c_str(),hbuf,buf_size);
+  run_on_file(filename,[&](const int ctx){ grid_write_data_array_c2f_int(ctx,filename.c_str(),varname.c_str(),hbuf,buf_size); });
 }
 template<>
 void grid_write_data_array<float>(const std::string &filename, const std::string &varname, const float* hbuf, const int buf_size) {
-  grid_write_data_array_c2f_float(filename.c_str(),varname.c_str(),hbuf,buf_size);
+  run_on_file(filename,[&](const int ctx){ grid_write_data_array_c2f_float(ctx,filename.c_str(),varname.c_str(),hbuf,buf_size); });
 }
 template<>
 void grid_write_data_array<double>(const std::string &filename, const std::string &varname, const double* hbuf, const int buf_size) {
-  grid_write_data_array_c2f_double(filename.c_str(),varname.c_str(),hbuf,buf_size);
+  run_on_file(filename,[&](const int ctx){ grid_write_data_array_c2f_double(ctx,filename.c_str(),varname.c_str(),hbuf,buf_size); });
 }
 /* ----------------------------------------------------------------- */
 } // namespace scorpio
@@ -60,16 +60,28 @@ namespace scorpio {
   void grid_write_data_array(const std::string &filename, const std::string &varname,
                              const T* hbuf, const int buf_size);
 
+  /* Checks if a file is already open, with the given mode */
+  bool is_file_open(const std::string& filename, const FileMode mode);
+  /* Get/set global integer attributes of a file */
+  int get_int_attribute (const std::string& filename, const std::string& attr_name);
+  void set_int_attribute (const std::string& filename, const std::string& attr_name, const int value);
+  /* Get the length of a dimension in a file */
+  int get_dimlen(const std::string& filename, const std::string& dimname);
+
 extern "C" {
   /* Query whether the pio subsystem is inited or not */
+  // Note: this does not go through the AsyncWriter (see below), since it is only called
+  //       before the subsystem is inited, or when it is finalized.
   bool is_eam_pio_subsystem_inited();
-  /* Checks if a file is already open, with the given mode */
-  bool is_file_open_c2f(const char*&& filename, const int& mode);
-  int get_int_attribute_c2f (const char*&& filename, const char*&& attr_name);
-  void set_int_attribute_c2f (const char*&& filename, const char*&& attr_name, const int& value);
-  int get_dimlen_c2f(const char*&& filename, const char*&& dimname);
 } // extern "C"
 
+  // NOTE: most scorpio calls are collective, so they must be issued in the same order
+  //       on all ranks. Calls on files open in Write mode are executed by the
+  //       process-wide AsyncWriter, in the order they are called on each rank
+  //       (see share/io/scream_async_writer.hpp), while calls on files open in Read
+  //       mode are executed right away by the calling thread, so they never wait
+  //       for pending output. Do NOT call the F90 routines directly.
+
 // The strings returned by e2str(const FieldTag&) are different from
 // what existing nc files are already using. Besides upper/lower case
 // differences, the column dimension (COL) is 'ncol' in nc files,
@@ -122,7 +122,7 @@ protected:
 };
 
 /*===================================================================================================*/
-void run_multisnap(const std::string& output_freq_units) {
+void run_multisnap(const std::string& output_freq_units, const bool async_output) {
   const std::string output_type = "multisnap";
   ekat::Comm io_comm(MPI_COMM_WORLD);  // MPI communicator group used for I/O set as ekat object.
   Int num_gcols = 2*io_comm.size();
@@ -169,6 +169,7 @@ void run_multisnap(const std::string& output_freq_units) {
     ekat::ParameterList params;
     ekat::parse_yaml_file("io_test_" + output_type + ".yaml",params);
     params.set<std::string>("Floating Point Precision","real");
+    params.set("Async Output",async_output);
     auto& params_sub = params.sublist("output_control");
     params_sub.set<std::string>("frequency_units",output_freq_units);
     io_control.frequency = params_sub.get<int>("Frequency");
@@ -217,6 +218,8 @@ void run_multisnap(const std::string& output_freq_units) {
             EKAT_ERROR_MSG ("Error! Unexpected field rank.\n");
         }
         f.sync_to_dev();
+        // Diagnostics are recomputed only if their inputs time stamps changed
+        f.get_header().get_tracking().update_time_stamp(time);
       }
 
       // Run the output manager for this time step
@@ -248,7 +251,7 @@ void run_multisnap(const std::string& output_freq_units) {
   {
     auto test_filename = input_params.get<std::string>("Filename");
     scorpio::register_file(test_filename,scorpio::Read);
-    Int test_gcols_len = scorpio::get_dimlen_c2f(test_filename.c_str(),"ncol");
+    Int test_gcols_len = scorpio::get_dimlen(test_filename,"ncol");
     REQUIRE(test_gcols_len==num_gcols);
     scorpio::eam_pio_closefile(test_filename);
   }
@@ -410,6 +413,8 @@ void run(const std::string& output_type,const std::string& output_freq_units) {
             EKAT_ERROR_MSG ("Error! Unexpected field rank.\n");
         }
         f.sync_to_dev();
+        // Diagnostics are recomputed only if their inputs time stamps changed
+        f.get_header().get_tracking().update_time_stamp(time);
       }
 
       // Run the output manager for this time step
@@ -442,7 +447,7 @@ void run(const std::string& output_type,const std::string& output_freq_units) {
   {
     auto test_filename = input_params.get<std::string>("Filename");
     scorpio::register_file(test_filename,scorpio::Read);
-    Int test_gcols_len = scorpio::get_dimlen_c2f(test_filename.c_str(),"ncol");
+    Int test_gcols_len = scorpio::get_dimlen(test_filename,"ncol");
     REQUIRE(test_gcols_len==num_gcols);
     scorpio::eam_pio_closefile(test_filename);
   }
@@ -743,7 +748,14 @@ TEST_CASE("input_output_basic","io")
     if (comm.am_i_root()) {
       printf("  Testing output type multisnap...");
     }
-    run_multisnap(of);
+    run_multisnap(of,false);
+    if (comm.am_i_root()) {
+      printf("Done!\n");
+    }
+    if (comm.am_i_root()) {
+      printf("  Testing output type multisnap (async)...");
+    }
+    run_multisnap(of,true);
     if (comm.am_i_root()) {
       printf("Done!\n");
     }
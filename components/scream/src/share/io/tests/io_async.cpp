@@ -0,0 +1,239 @@
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scream_async_writer.hpp"
+#include "share/io/scorpio_input.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_identifier.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/field/field_utils.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_session.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+
+#include <future>
+
+/*
+ * Test the threaded path of asynchronous output.
+ *
+ * MPI is initialized with MPI_THREAD_MULTIPLE, so that the AsyncWriter thread
+ * is actually started. The same fields are written every step by a synchronous
+ * and an asynchronous OutputManager, while the main thread also reads a file
+ * every step, so that scorpio calls issued by the main thread are interleaved
+ * with the background writes. At the end, both output files are read back, and
+ * must contain exactly the values the fields had at each step. Reads are also
+ * checked to not queue behind pending output.
+ */
+
+namespace {
+
+using namespace scream;
+using namespace ekat::units;
+const int packsize = SCREAM_PACK_SIZE;
+using Pack         = ekat::Pack<Real,packsize>;
+
+const std::vector<std::string> fnames = {"field_1", "field_2", "field_packed"};
+
+std::shared_ptr<FieldManager>
+get_test_fm(const std::shared_ptr<const AbstractGrid>& grid)
+{
+  using namespace ShortFieldTagsNames;
+  using FL = FieldLayout;
+  using FR = FieldRequest;
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  const int nlevs = grid->get_num_vertical_levels();
+  const std::string& gn = grid->name();
+
+  FieldIdentifier fid1("field_1",grid->get_2d_scalar_layout(),kg,gn);
+  FieldIdentifier fid2("field_2",FL{{LEV},{nlevs}},kg,gn);
+  FieldIdentifier fid3("field_packed",grid->get_3d_scalar_layout(true),kg/m,gn);
+
+  fm->registration_begins();
+  fm->register_field(FR{fid1});
+  fm->register_field(FR{fid2});
+  fm->register_field(FR{fid3,Pack::n}); // Register field as packed
+  fm->registration_ends();
+
+  for (const auto& fname : fnames) {
+    fm->get_field(fname).deep_copy(-1);
+  }
+
+  return fm;
+}
+
+ekat::ParameterList get_in_params(const std::string& casename,
+                                  const ekat::Comm& comm,
+                                  const util::TimeStamp& t_first_write)
+{
+  ekat::ParameterList in_params("Input Parameters");
+
+  std::string filename = casename + ".INSTANT.nsteps_x1.np"
+                       + std::to_string(comm.size())
+                       + "." + t_first_write.to_string() + ".nc";
+
+  in_params.set<std::string>("Filename",filename);
+  in_params.set("Field Names",fnames);
+  in_params.set<std::string>("Floating Point Precision","real");
+  return in_params;
+}
+
+TEST_CASE("async_io_threaded")
+{
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+
+  MPI_Fint fcomm = MPI_Comm_c2f(io_comm.mpi_comm());
+  scorpio::eam_init_pio_subsystem(fcomm);
+
+  ekat::ParameterList gm_params;
+  gm_params.set("number_of_global_columns",2*io_comm.size());
+  gm_params.set("number_of_vertical_levels",2+SCREAM_PACK_SIZE);
+  auto gm = create_mesh_free_grids_manager(io_comm,gm_params);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  auto engine = setup_random_test (&io_comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  RPDF pdf(0.01,0.99);
+
+  util::TimeStamp t0 ({2000,1,1},{0,0,0});
+  const int dt = 10;
+  const int nsteps = 5;
+
+  ekat::ParameterList params;
+  ekat::parse_yaml_file("io_test_async.yaml",params);
+  params.set<std::string>("Floating Point Precision","real");
+
+  auto fm = get_test_fm(grid);
+  auto randomize_fields = [&](const util::TimeStamp& t) {
+    for (const auto& fname : fnames) {
+      auto f = fm->get_field(fname);
+      randomize(f,engine,pdf);
+      f.get_header().get_tracking().update_time_stamp(t);
+    }
+    // field_2 is not partitioned, so let's sync it across ranks
+    auto f2 = fm->get_field("field_2");
+    auto v2 = f2.get_view<Real*>();
+    io_comm.all_reduce(v2.data(),v2.size(),MPI_MAX);
+  };
+
+  // Write a reference file synchronously, to be read during the time loop
+  randomize_fields(t0);
+  std::map<std::string,Field> ref_fields;
+  {
+    auto ref_params = params;
+    ref_params.set<std::string>("Casename","io_test_async_ref");
+    OutputManager om;
+    om.setup(io_comm,ref_params,fm,gm,t0,t0,false);
+    om.run(t0);
+    om.finalize();
+    for (const auto& fname : fnames) {
+      ref_fields[fname] = fm->get_field(fname).clone();
+    }
+  }
+
+  // Set up sync and async output streams
+  auto sync_params = params;
+  sync_params.set<std::string>("Casename","io_test_async_sync");
+  sync_params.set("Async Output",false);
+  auto async_params = params;
+  async_params.set<std::string>("Casename","io_test_async_async");
+  async_params.set("Async Output",true);
+
+  OutputManager om_sync, om_async;
+  om_sync.setup(io_comm,sync_params,fm,gm,t0,t0,false);
+  om_async.setup(io_comm,async_params,fm,gm,t0,t0,false);
+
+  // The whole point of this test is to run the threaded path
+  REQUIRE (AsyncWriter::instance().is_threaded());
+
+  auto fm_read = get_test_fm(grid);
+  auto ref_in_params = get_in_params("io_test_async_ref",io_comm,t0);
+
+  std::vector<std::map<std::string,Field>> step_fields;
+  auto time = t0;
+  for (int n=0; n<nsteps; ++n) {
+    time += dt;
+    randomize_fields(time);
+
+    step_fields.emplace_back();
+    for (const auto& fname : fnames) {
+      step_fields.back()[fname] = fm->get_field(fname).clone();
+    }
+
+    om_sync.run(time);
+    om_async.run(time);
+
+    // Read from the main thread, while the async snapshot may still be in flight
+    AtmosphereInput ref_input(ref_in_params,fm_read);
+    ref_input.read_variables();
+    ref_input.finalize();
+    for (const auto& fname : fnames) {
+      REQUIRE (views_are_equal(fm_read->get_field(fname),ref_fields.at(fname)));
+    }
+  }
+
+  // Reads must not queue behind pending output: block the writer until
+  // a file has been read from the main thread (this would hang otherwise).
+  std::promise<void> read_done;
+  std::shared_future<void> read_done_future = read_done.get_future().share();
+  AsyncWriter::instance().enqueue([=](){ read_done_future.wait(); });
+  {
+    AtmosphereInput ref_input(ref_in_params,fm_read);
+    ref_input.read_variables();
+    ref_input.finalize();
+    read_done.set_value();
+    for (const auto& fname : fnames) {
+      REQUIRE (views_are_equal(fm_read->get_field(fname),ref_fields.at(fname)));
+    }
+  }
+  AsyncWriter::instance().wait_all();
+
+  om_sync.finalize();
+  om_async.finalize();
+
+  // Check both files contain the field values of each step
+  const auto t_first_write = t0 + dt;
+  for (const std::string casename : {"io_test_async_sync","io_test_async_async"}) {
+    auto in_params = get_in_params(casename,io_comm,t_first_write);
+    AtmosphereInput input(in_params,fm_read);
+    for (int n=0; n<nsteps; ++n) {
+      input.read_variables(n);
+      for (const auto& fname : fnames) {
+        REQUIRE (views_are_equal(fm_read->get_field(fname),step_fields[n].at(fname)));
+      }
+    }
+    input.finalize();
+  }
+
+  // All Done
+  scorpio::eam_pio_finalize();
+}
+
+} // anonymous namespace
+
+int main (int argc, char** argv) {
+  // The async writer thread calls into MPI concurrently with the main thread
+  int provided;
+  MPI_Init_thread(&argc,&argv,MPI_THREAD_MULTIPLE,&provided);
+
+  int num_failed;
+  scream::initialize_scream_session(argc, argv); {
+    num_failed = Catch::Session().run(argc,argv);
+  } scream::finalize_scream_session();
+
+  MPI_Finalize();
+  return num_failed==0 ? 0 : 1;
+}
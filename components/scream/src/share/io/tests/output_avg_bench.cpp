@@ -0,0 +1,171 @@
+#include "share/io/scorpio_output.hpp"
+#include "share/grid/point_grid.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/scream_session.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <chrono>
+#include <vector>
+
+/*
+ * Microbenchmark for the per-step cost of updating the running tallies
+ * of an averaged output stream (i.e., of a non-write AtmosphereOutput::run call).
+ *
+ * The stream contains a mix of 2d and 3d fields, some of them padded.
+ * AtmosphereOutput updates all of them with a single kernel launch, using
+ * a table of field descriptors. For comparison, the benchmark also times
+ * the update done the way AtmosphereOutput used to do it, that is, with one
+ * kernel launch per field (plus one per field for the division by the number
+ * of steps at write steps, which is not timed here).
+ */
+
+namespace {
+
+using namespace scream;
+
+using KT = KokkosTypes<DefaultDevice>;
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+// One launch per field, as AtmosphereOutput used to do
+void per_field_update (const FieldManager& fm, const std::vector<std::string>& names,
+                       const std::vector<KT::view_1d<Real>>& tallies)
+{
+  for (size_t i=0; i<names.size(); ++i) {
+    const auto f = fm.get_field(names[i]);
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    auto tally = tallies[i];
+    if (fl.rank()==1) {
+      auto v = f.get_view<const Real*>();
+      Kokkos::parallel_for(KT::RangePolicy(0,fl.size()), KOKKOS_LAMBDA(int idx) {
+        tally(idx) += v(idx);
+      });
+    } else {
+      auto v = f.get_view<const Real**>();
+      const int nlevs = fl.dim(1);
+      Kokkos::parallel_for(KT::RangePolicy(0,fl.size()), KOKKOS_LAMBDA(int idx) {
+        tally(idx) += v(idx / nlevs, idx % nlevs);
+      });
+    }
+  }
+}
+
+void run (const ekat::Comm& comm, const int ncol, const int nlev,
+          const int nfields, const int nsteps)
+{
+  using namespace ShortFieldTagsNames;
+  using FL = FieldLayout;
+  using FR = FieldRequest;
+
+  auto grid = create_point_grid("Physics",ncol*comm.size(),nlev,comm);
+  const int nlcols = grid->get_num_local_dofs();
+
+  // Every fourth field is 2d, and every other 3d field is padded
+  auto fm = std::make_shared<FieldManager>(grid);
+  std::vector<std::string> names;
+  fm->registration_begins();
+  for (int i=0; i<nfields; ++i) {
+    const auto name = "field_" + std::to_string(i);
+    const bool is_2d = i % 4 == 0;
+    const FL fl = is_2d ? FL({COL},{nlcols}) : FL({COL,LEV},{nlcols,nlev});
+    FieldIdentifier fid(name,fl,ekat::units::Units::nondimensional(),grid->name());
+    const int ps = (not is_2d && i % 2 == 1) ? SCREAM_PACK_SIZE : 1;
+    fm->register_field(FR{fid,"output",ps});
+    names.push_back(name);
+  }
+  fm->registration_ends();
+  fm->init_fields_time_stamp(util::TimeStamp({2000,1,1},{0,0,0}));
+  for (const auto& name : names) {
+    fm->get_field(name).deep_copy(1.0);
+  }
+
+  ekat::ParameterList params;
+  params.set<std::string>("Averaging Type","Average");
+  params.set("Field Names",names);
+  AtmosphereOutput output(comm,params,fm,nullptr);
+
+  using clock = std::chrono::steady_clock;
+
+  // Fused update, as done by AtmosphereOutput
+  // Note: on non-write steps, run only updates the running tallies
+  output.run("",false,0);
+  Kokkos::fence();
+  auto start = clock::now();
+  for (int n=0; n<nsteps; ++n) {
+    output.run("",false,0);
+  }
+  Kokkos::fence();
+  auto finish = clock::now();
+  const double fused_usec = std::chrono::duration<double,std::micro>(finish-start).count();
+
+  // One launch per field
+  std::vector<KT::view_1d<Real>> tallies;
+  for (const auto& name : names) {
+    const auto& fl = fm->get_field(name).get_header().get_identifier().get_layout();
+    tallies.emplace_back(name,fl.size());
+  }
+  per_field_update(*fm,names,tallies);
+  Kokkos::fence();
+  start = clock::now();
+  for (int n=0; n<nsteps; ++n) {
+    per_field_update(*fm,names,tallies);
+  }
+  Kokkos::fence();
+  finish = clock::now();
+  const double per_field_usec = std::chrono::duration<double,std::micro>(finish-start).count();
+
+  if (comm.am_i_root()) {
+    printf("output_avg_bench: ncol=%d, nlev=%d, nfields=%d, nsteps=%d, nranks=%d\n",
+           ncol, nlev, nfields, nsteps, comm.size());
+    printf("  fused update:     %6d launches/step, %12.3f us/step\n", 1, fused_usec/nsteps);
+    printf("  per-field update: %6d launches/step, %12.3f us/step\n", nfields, per_field_usec/nsteps);
+  }
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  int ncol = 218;
+  int nlev = 72;
+  int nfields = 150;
+  int nsteps = 100;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      ncol = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-k", "--nlev")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nlev = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-f", "--nfields")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nfields = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-n", "--nsteps")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nsteps = std::atoi(argv[i]);
+    }
+  }
+  EKAT_REQUIRE_MSG(ncol > 0 && nlev > 0 && nfields > 0 && nsteps > 0,
+      "Usage: " << argv[0] << " [-i <cols per rank>] [-k <nlev>] [-f <nfields>] [-n <nsteps>]\n");
+
+  MPI_Init(&argc,&argv);
+  scream::initialize_scream_session(argc, argv); {
+    ekat::Comm comm(MPI_COMM_WORLD);
+    run(comm, ncol, nlev, nfields, nsteps);
+  } scream::finalize_scream_session();
+  MPI_Finalize();
+
+  return 0;
+}
@@ -39,6 +39,11 @@ public:
 
   ResultAndMsg check() const override;
 
+  double lower_bound () const { return m_lb; }
+  double upper_bound () const { return m_ub; }
+  double lower_bound_repairable () const { return m_lb_repairable; }
+  double upper_bound_repairable () const { return m_ub_repairable; }
+
 // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
 #ifndef EAMXX_ENABLE_GPU
 protected:
@@ -0,0 +1,211 @@
+#include "share/property_checks/property_check_batch.hpp"
+#include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/field_within_interval_check.hpp"
+
+#include "ekat/util/ekat_math_utils.hpp"
+
+namespace scream
+{
+
+PropertyCheckBatch::PropertyCheckBatch (const bool lazy)
+ : m_lazy (lazy)
+{
+  // Nothing to do here
+}
+
+void PropertyCheckBatch::
+add_check (const CheckFailHandling cfh, const prop_check_ptr& pc)
+{
+  EKAT_REQUIRE_MSG (pc!=nullptr,
+      "Error! Invalid property check pointer.\n");
+
+  if (can_fuse(pc)) {
+    m_fused_checks.push_back(std::make_pair(cfh,pc));
+    m_descs_up_to_date = false;
+  } else {
+    m_unfused_checks.push_back(std::make_pair(cfh,pc));
+  }
+}
+
+bool PropertyCheckBatch::can_fuse (const prop_check_ptr& pc) const
+{
+  // In lazy mode, we would find out too late that the fields need repairing
+  if (m_lazy && pc->can_repair()) {
+    return false;
+  }
+
+  const bool supported_check =
+    std::dynamic_pointer_cast<FieldNaNCheck>(pc)!=nullptr ||
+    std::dynamic_pointer_cast<FieldWithinIntervalCheck>(pc)!=nullptr;
+
+  return supported_check &&
+         pc->fields().front().data_type()==DataType::RealType;
+}
+
+auto PropertyCheckBatch::run ()
+ -> std::list<FailedCheck>
+{
+  if (m_fused_checks.size()==0) {
+    return {};
+  }
+
+  // In lazy mode, retrieve the results of the previous run first (if any)
+  auto failed = flush();
+
+  if (not m_descs_up_to_date || m_refresh_descs) {
+    set_checks_descs();
+  }
+
+  launch();
+  Kokkos::deep_copy(KT::ExeSpace(),m_results_h,m_results);
+  m_pending = true;
+  if (not m_lazy) {
+    failed = flush();
+  }
+  // Otherwise, do not wait for the results: we will retrieve them at the next run
+  return failed;
+}
+
+auto PropertyCheckBatch::flush ()
+ -> std::list<FailedCheck>
+{
+  if (not m_pending) {
+    return {};
+  }
+
+  m_pending = false;
+  return get_failed_checks();
+}
+
+void PropertyCheckBatch::launch ()
+{
+  const auto descs = m_descs;
+  const auto results = m_results;
+  const int nchecks = descs.size();
+
+  Kokkos::deep_copy(results,0);
+  Kokkos::parallel_for(KT::RangePolicy(0,m_size), KOKKOS_LAMBDA(int idx) {
+    // Find the check this entry belongs to (descs are sorted by offset)
+    int beg = 0;
+    int end = nchecks;
+    while (end-beg>1) {
+      const int mid = (beg+end)/2;
+      if (descs(mid).offset<=idx) {
+        beg = mid;
+      } else {
+        end = mid;
+      }
+    }
+    const auto& d = descs(beg);
+
+    // Unflatten the idx in the field layout, and find the entry in the (possibly strided) field view
+    int i = idx - d.offset;
+    int src = 0;
+    for (int r=d.rank-1; r>=0; --r) {
+      src += (i % d.extents[r])*d.strides[r];
+      i /= d.extents[r];
+    }
+    const auto v = d.data[src];
+
+    int result = 0;
+    if (d.nan_check) {
+      if (ekat::is_invalid(v)) {
+        result = 2;
+      }
+    } else if (v<d.lb || v>d.ub) {
+      result = (v<d.lb_repairable || v>d.ub_repairable) ? 2 : 1;
+    }
+
+    // Only entries that do not pass need to touch the results
+    if (result>0) {
+      Kokkos::atomic_max(&results(beg),result);
+    }
+  });
+}
+
+void PropertyCheckBatch::set_checks_descs ()
+{
+  const int nchecks = m_fused_checks.size();
+  if (m_descs.extent_int(0)!=nchecks) {
+    m_descs     = descs_dev("",nchecks);
+    m_descs_h   = Kokkos::create_mirror_view(m_descs);
+    m_results   = results_dev("",nchecks);
+    m_results_h = results_host("",nchecks);
+  }
+
+  // Store data pointer, extents, and strides of the field view
+  auto set_desc = [] (CheckDesc& d, const auto& v) {
+    d.data = v.data();
+    d.rank = v.rank;
+    for (int r=0; r<d.rank; ++r) {
+      d.extents[r] = v.extent_int(r);
+      d.strides[r] = v.stride(r);
+    }
+  };
+
+  m_size = 0;
+  m_refresh_descs = false;
+  int i = 0;
+  for (const auto& it : m_fused_checks) {
+    const auto& pc = it.second;
+    const auto& f  = pc->fields().front();
+    const auto& layout = f.get_header().get_identifier().get_layout();
+    auto& d = m_descs_h(i);
+    switch (layout.rank()) {
+      case 1: set_desc(d,f.get_view<const Real*>());      break;
+      case 2: set_desc(d,f.get_view<const Real**>());     break;
+      case 3: set_desc(d,f.get_view<const Real***>());    break;
+      case 4: set_desc(d,f.get_view<const Real****>());   break;
+      case 5: set_desc(d,f.get_view<const Real*****>());  break;
+      case 6: set_desc(d,f.get_view<const Real******>()); break;
+      default:
+        EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(layout.rank()) + ") not supported by PropertyCheckBatch.\n");
+    }
+
+    // The view extents include padding, while the checks only look at the layout dims
+    for (int r=0; r<d.rank; ++r) {
+      d.extents[r] = layout.dim(r);
+    }
+    d.offset = m_size;
+    m_size += layout.size();
+
+    auto interval_check = std::dynamic_pointer_cast<FieldWithinIntervalCheck>(pc);
+    d.nan_check = interval_check==nullptr;
+    if (not d.nan_check) {
+      d.lb = interval_check->lower_bound();
+      d.ub = interval_check->upper_bound();
+      d.lb_repairable = interval_check->lower_bound_repairable();
+      d.ub_repairable = interval_check->upper_bound_repairable();
+    }
+
+    m_refresh_descs |= f.get_header().get_alloc_properties().is_dynamic_subfield();
+    ++i;
+  }
+  Kokkos::deep_copy(m_descs,m_descs_h);
+  m_descs_up_to_date = true;
+}
+
+auto PropertyCheckBatch::get_failed_checks () const
+ -> std::list<FailedCheck>
+{
+  // Wait for the results copy (issued asynchronously in run) to complete
+  KT::ExeSpace().fence();
+
+  // Note: if checks were added after the last run, they have no result yet
+  std::list<FailedCheck> failed;
+  const int nresults = m_results_h.size();
+  int i = 0;
+  for (const auto& it : m_fused_checks) {
+    if (i==nresults) {
+      break;
+    }
+    const int res = m_results_h(i);
+    if (res>0) {
+      failed.push_back({it.first,it.second,res==1 ? CheckResult::Repairable : CheckResult::Fail});
+    }
+    ++i;
+  }
+  return failed;
+}
+
+} // namespace scream
@@ -0,0 +1,126 @@
+#ifndef SCREAM_PROPERTY_CHECK_BATCH_HPP
+#define SCREAM_PROPERTY_CHECK_BATCH_HPP
+
+#include "share/property_checks/property_check.hpp"
+#include "share/atm_process/atmosphere_process_utils.hpp"
+#include "share/scream_types.hpp"
+
+#include <list>
+#include <memory>
+
+namespace scream
+{
+
+/*
+ * A batch of property checks, run with a single kernel launch
+ *
+ * Running each property check on its own requires one kernel launch
+ * and one device-to-host copy (to retrieve the reduction result) per check.
+ * With several checks per atm process, these syncs add up.
+ *
+ * This class runs all the FieldNaNCheck and FieldWithinIntervalCheck checks
+ * on Real fields (including lower/upper bound checks) with one kernel, which
+ * stores the result of each check in a device view, and then copies all the
+ * results to host at once. Other checks cannot be fused, and must be run
+ * individually by the caller.
+ *
+ * The fused kernel only computes whether each check passes. For checks that do
+ * not pass, the caller can run the check individually, to get the detailed
+ * message (with the location of the offending entries), and to repair the fields.
+ *
+ * The results of the fused kernel are copied to (pinned) host memory asynchronously,
+ * and we only wait for the copy when the results are read. In lazy mode, the results
+ * are retrieved at the next call to run, so that the model can keep running.
+ * This means that failures are reported one call later. Since it would be
+ * too late to repair the fields, checks that can repair are never fused in
+ * lazy mode.
+ */
+
+class PropertyCheckBatch
+{
+public:
+  using prop_check_ptr = std::shared_ptr<PropertyCheck>;
+  using check_type     = std::pair<CheckFailHandling,prop_check_ptr>;
+
+  struct FailedCheck {
+    CheckFailHandling cfh;
+    prop_check_ptr    pc;
+    CheckResult       result;
+  };
+
+  explicit PropertyCheckBatch (const bool lazy = false);
+  ~PropertyCheckBatch () = default;
+
+  void add_check (const CheckFailHandling cfh, const prop_check_ptr& pc);
+
+  bool is_lazy () const { return m_lazy; }
+
+  // Checks that cannot be fused, and must be run individually
+  const std::list<check_type>& get_unfused_checks () const { return m_unfused_checks; }
+  int get_num_fused_checks () const { return m_fused_checks.size(); }
+
+  // Run all fused checks, and return those that did not pass.
+  // In lazy mode, returns the results of the *previous* call.
+  std::list<FailedCheck> run ();
+
+  // In lazy mode, return the results of the last call to run (if not yet retrieved)
+  std::list<FailedCheck> flush ();
+
+// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+#ifndef EAMXX_ENABLE_GPU
+protected:
+#endif
+  void launch ();
+
+protected:
+  using KT = KokkosTypes<DefaultDevice>;
+
+  // For each fused check, store the field data pointer, together with
+  // extents and strides of the field view (which may be padded or strided),
+  // and the offset of the field entries in the global (flattened) index space.
+  struct CheckDesc {
+    const Real* data;
+    int rank;
+    int extents[Field::MaxRank];
+    int strides[Field::MaxRank];
+    int offset;
+
+    // If false, this is an interval check
+    bool nan_check;
+    double lb, ub;
+    double lb_repairable, ub_repairable;
+  };
+  using descs_dev  = typename KT::template view_1d<CheckDesc>;
+  using descs_host = typename descs_dev::HostMirror;
+  using results_dev  = typename KT::template view_1d<int>;
+  // Pinned host memory, so that the results copy is truly asynchronous
+  // (a copy to pageable host memory blocks until it is done)
+  using results_host = Kokkos::View<int*,Kokkos::SharedHostPinnedSpace>;
+
+  bool can_fuse (const prop_check_ptr& pc) const;
+  void set_checks_descs ();
+  std::list<FailedCheck> get_failed_checks () const;
+
+  bool                    m_lazy;
+  bool                    m_pending = false;
+
+  std::list<check_type>   m_fused_checks;
+  std::list<check_type>   m_unfused_checks;
+
+  descs_dev               m_descs;
+  descs_host              m_descs_h;
+  int                     m_size = 0;
+
+  // Rebuild the descriptors if checks were added, or refresh them before each run
+  // if a field is a dynamic subfield (its data pointer can change at runtime)
+  bool                    m_descs_up_to_date = false;
+  bool                    m_refresh_descs = false;
+
+  // Result of each check: 0=pass, 1=repairable, 2=fail
+  results_dev             m_results;
+  results_host            m_results_h;
+};
+
+} // namespace scream
+
+#endif // SCREAM_PROPERTY_CHECK_BATCH_HPP
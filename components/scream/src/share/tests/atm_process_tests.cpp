@@ -4,6 +4,7 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/atm_process/atmosphere_diagnostic_registry.hpp"
 
 #include "share/property_checks/field_lower_bound_check.hpp"
 
@@ -18,6 +19,8 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/ekat_scalar_traits.hpp"
 
+#include <thread>
+
 namespace scream {
 
 ekat::ParameterList create_test_params ()
@@ -338,6 +341,105 @@ protected:
   }
 };
 
+// Computes out = in*factor + shift on device. If no input field is
+// specified, the output field is updated in place.
+class ScaleAndShift : public DummyProcess
+{
+public:
+  ScaleAndShift (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    m_field_in  = params.get<std::string>("Field In","");
+    m_field_out = params.get<std::string>("Field Out");
+    m_factor = params.get<double>("Factor",1.0);
+    m_shift  = params.get<double>("Shift",0.0);
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  bool supports_concurrent_run () const { return true; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    if (m_field_in=="") {
+      add_field<Updated>(m_field_out,lt,K,m_grid_name);
+    } else {
+      add_field<Required>(m_field_in,lt,K,m_grid_name);
+      add_field<Computed>(m_field_out,lt,K,m_grid_name);
+    }
+  }
+
+  // The thread that executed the last call to run_impl
+  std::thread::id run_thread () const { return m_run_thread; }
+
+protected:
+  void run_impl (const int /* dt */) {
+    using RangePolicy = Kokkos::RangePolicy<exec_space_type>;
+
+    m_run_thread = std::this_thread::get_id();
+
+    auto out = get_field_out(m_field_out, m_grid_name).get_view<Real*>();
+    decltype(out)::const_type in = out;
+    if (m_field_in!="") {
+      in = get_field_in(m_field_in, m_grid_name).get_view<const Real*>();
+    }
+    const Real factor = m_factor;
+    const Real shift  = m_shift;
+    Kokkos::parallel_for(RangePolicy(exec_space(),0,out.extent(0)),
+                         KOKKOS_LAMBDA(const int i) {
+      out(i) = in(i)*factor + shift;
+    });
+  }
+
+  std::string m_field_in;
+  std::string m_field_out;
+  Real m_factor;
+  Real m_shift;
+  std::thread::id m_run_thread;
+};
+
+// Adds one to a field on device, via a view obtained at initialization,
+// like physics processes usually do.
+class AddOneStoredView : public DummyProcess
+{
+public:
+  AddOneStoredView (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    add_field<Updated>("Field A",lt,K,m_grid_name);
+  }
+protected:
+  void initialize_impl (const RunType /* run_type */ ) {
+    m_view = get_field_out("Field A", m_grid_name).get_view<Real*>();
+  }
+
+  void run_impl (const int /* dt */) {
+    auto v = m_view;
+    Kokkos::parallel_for(v.extent(0), KOKKOS_LAMBDA(const int i) {
+      v(i) += 1;
+    });
+  }
+
+  Field::view_dev_t<Real*> m_view;
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -616,6 +718,193 @@ TEST_CASE ("subcycling") {
   }
 }
 
+// Creates the fields needed by the group (set to 1), and sets them in the group
+std::map<std::string,Field>
+set_group_fields (AtmosphereProcessGroup& group, const util::TimeStamp& t0)
+{
+  std::map<std::string,Field> fields;
+  auto get_field = [&](const FieldIdentifier& fid) -> Field& {
+    if (fields.count(fid.name())==0) {
+      Field f(fid);
+      f.allocate_view();
+      f.deep_copy(1);
+      f.get_header().get_tracking().update_time_stamp(t0);
+      fields[fid.name()] = f;
+    }
+    return fields.at(fid.name());
+  };
+  for (const auto& req : group.get_required_field_requests()) {
+    group.set_required_field(get_field(req.fid).get_const());
+  }
+  for (const auto& req : group.get_computed_field_requests()) {
+    group.set_computed_field(get_field(req.fid));
+  }
+  return fields;
+}
+
+void check_field (Field f, const Real expected) {
+  f.sync_to_host();
+  auto v = f.get_view<const Real*,Host>();
+  for (int i=0; i<v.extent_int(0); ++i) {
+    REQUIRE (v[i]==expected);
+  }
+}
+
+TEST_CASE ("parallel_schedule") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("ScaleAndShift",&create_atmosphere_process<ScaleAndShift>);
+  factory.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
+
+  for (std::string sched : {"Sequential", "Parallel"}) {
+    ekat::ParameterList params ("Atmosphere Processes");
+    params.set<std::string>("schedule_type",sched);
+    params.set<std::string>("atm_procs_list","(AddOne,TimesTwo)");
+    for (std::string ap_name : {"AddOne","TimesTwo"}) {
+      auto& p = params.sublist(ap_name);
+      p.set<std::string>("Type", "ScaleAndShift");
+      p.set<std::string>("Grid Name", "Point Grid");
+      p.set<std::string>("Field Out", "Field A");
+    }
+    params.sublist("AddOne").set("Shift",1.0);
+    params.sublist("TimesTwo").set("Factor",2.0);
+
+    auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+    group->set_grids(gm);
+    auto fields = set_group_fields(*group,t0);
+
+    group->initialize(t0,RunType::Initial);
+    group->run(1);
+
+    // Sequential: (1+1)*2=4. Parallel: 1 + (2-1) + (2-1) = 3.
+    check_field(fields.at("Field A"), sched=="Sequential" ? 4 : 3);
+
+    // The DAG must be buildable also for parallel groups
+    AtmProcDAG dag;
+    REQUIRE_NOTHROW (dag.create_dag(*group));
+  }
+}
+
+TEST_CASE ("parallel_schedule_concurrent") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("ScaleAndShift",&create_atmosphere_process<ScaleAndShift>);
+  factory.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
+
+  // P1 updates A, which P4 uses, so P1 must run serially.
+  // P2, P3, and P4 only compute fields nobody else uses, so they run concurrently.
+  ekat::ParameterList params ("Atmosphere Processes");
+  params.set<std::string>("schedule_type","Parallel");
+  params.set("enable_concurrent_execution",true);
+  params.set<std::string>("atm_procs_list","(P1,P2,P3,P4)");
+  for (std::string ap_name : {"P1","P2","P3","P4"}) {
+    auto& p = params.sublist(ap_name);
+    p.set<std::string>("Type", "ScaleAndShift");
+    p.set<std::string>("Grid Name", "Point Grid");
+  }
+  params.sublist("P1").set<std::string>("Field Out","Field A");
+  params.sublist("P1").set("Shift",1.0);
+  params.sublist("P2").set<std::string>("Field Out","Field B");
+  params.sublist("P2").set("Factor",2.0);
+  params.sublist("P3").set<std::string>("Field Out","Field C");
+  params.sublist("P3").set("Shift",3.0);
+  params.sublist("P4").set<std::string>("Field In","Field A");
+  params.sublist("P4").set<std::string>("Field Out","Field D");
+  params.sublist("P4").set("Factor",10.0);
+
+  auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+  group->set_grids(gm);
+  auto fields = set_group_fields(*group,t0);
+
+  group->initialize(t0,RunType::Initial);
+
+  auto get_proc = [&](const int i) {
+    return std::dynamic_pointer_cast<const ScaleAndShift>(group->get_process(i));
+  };
+  const auto main_thread = std::this_thread::get_id();
+  for (int n=1; n<=3; ++n) {
+    group->run(1);
+
+    // P4 must see A at the beginning of the step
+    check_field(fields.at("Field A"), 1+n);
+    check_field(fields.at("Field B"), 1<<n);
+    check_field(fields.at("Field C"), 1+3*n);
+    check_field(fields.at("Field D"), 10*n);
+
+    // Only P2,P3,P4 can run on separate threads, if the backend supports it
+    REQUIRE (get_proc(0)->run_thread()==main_thread);
+    for (int i : {1,2,3}) {
+      REQUIRE ((get_proc(i)->run_thread()!=main_thread)==group->concurrent_execution_enabled());
+    }
+  }
+}
+
+TEST_CASE ("sync_after_multiple_writers") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  // Two procs writing the same field in the same time step. Both stamp the
+  // field with the same end-of-step time, so a host sync between the two
+  // runs must not prevent the second one from copying the new values.
+  ekat::ParameterList params1, params2;
+  params1.set<std::string>("Process Name", "W1");
+  params1.set<std::string>("Grid Name", "Point Grid");
+  params2.set<std::string>("Process Name", "W2");
+  params2.set<std::string>("Grid Name", "Point Grid");
+  auto w1 = std::make_shared<AddOneStoredView>(comm,params1);
+  auto w2 = std::make_shared<AddOneStoredView>(comm,params2);
+  w1->set_grids(gm);
+  w2->set_grids(gm);
+
+  const auto& fid = w1->get_required_field_requests().front().fid;
+  Field f(fid);
+  f.allocate_view();
+  f.deep_copy(1);
+  f.get_header().get_tracking().update_time_stamp(t0);
+  for (auto ap : {w1,w2}) {
+    ap->set_required_field(f.get_const());
+    ap->set_computed_field(f);
+    ap->initialize(t0,RunType::Initial);
+  }
+
+  for (int n=1; n<=2; ++n) {
+    w1->run(1);
+    check_field(f, 2*n);
+    w2->run(1);
+    REQUIRE (w1->get_fields_out().front().get_header().get_tracking().get_time_stamp()==
+             w2->get_fields_out().front().get_header().get_tracking().get_time_stamp());
+    check_field(f, 2*n+1);
+  }
+}
+
 TEST_CASE ("diagnostics") {
 
   //TODO: This test needs a field manager so that changes in Field A are seen everywhere.
@@ -691,6 +980,34 @@ TEST_CASE ("diagnostics") {
     REQUIRE (v_sum[i]==v_A[i]+v_B[i]);
     REQUIRE (v_sum[i]==3);
   }
+
+  // Store diags in a registry, and check that they are recomputed only when the inputs change
+  AtmosphereDiagnosticRegistry registry;
+  registry.add_diagnostic("DiagIdentity","Point Grid",diag_identity);
+  registry.add_diagnostic("DiagSum","Point Grid",diag_sum);
+  REQUIRE_THROWS (registry.add_diagnostic("DiagSum","Point Grid",diag_sum));
+  REQUIRE_THROWS (registry.add_diagnostic("DiagFail","Point Grid",diag_fail,{"DiagFoo"}));
+  REQUIRE_THROWS (registry.compute_diagnostic("DiagFail","Point Grid"));
+  REQUIRE (registry.get_diagnostic("DiagSum","Point Grid")==diag_sum);
+
+  registry.compute_diagnostic("DiagSum","Point Grid");
+  registry.compute_diagnostic("DiagSum","Point Grid");
+  registry.compute_diagnostic("DiagIdentity","Point Grid");
+  REQUIRE (registry.num_evaluations()==2);
+  REQUIRE (registry.num_skipped_evaluations()==1);
+
+  // Change Field B: only DiagSum depends on it
+  auto t1 = t0 + 10;
+  f_B.deep_copy<double,Host>(3.0);
+  f_B.get_header().get_tracking().update_time_stamp(t1);
+  registry.compute_diagnostic("DiagSum","Point Grid");
+  registry.compute_diagnostic("DiagIdentity","Point Grid");
+  REQUIRE (registry.num_evaluations()==3);
+  REQUIRE (registry.num_skipped_evaluations()==2);
+  REQUIRE (f_sum.get_header().get_tracking().get_time_stamp()==t1);
+  for (size_t i=0; i<v_A.size(); ++i) {
+    REQUIRE (v_sum[i]==4);
+  }
 }
 
 } // empty namespace
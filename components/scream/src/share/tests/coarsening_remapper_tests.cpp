@@ -41,11 +41,14 @@ public:
     return m_ov_tgt_grid;
   }
 
-  view_2d<int>::HostMirror get_send_f_pid_offsets () const {
-    return cmvc(m_send_f_pid_offsets);
+  int get_stacked_col_size () const {
+    return m_stacked_col_size;
   }
-  view_2d<int>::HostMirror get_recv_f_pid_offsets () const {
-    return cmvc(m_recv_f_pid_offsets);
+  view_2d<int>::HostMirror get_col_entries () const {
+    return cmvc(m_col_entries);
+  }
+  view_1d<int>::HostMirror get_recv_pid_start () const {
+    return cmvc(m_recv_pid_start);
   }
 
   view_1d<int>::HostMirror get_recv_lids_beg () const {
@@ -213,8 +216,14 @@ TEST_CASE ("coarsening_remap") {
   auto tgt_v3d_m = create_field("v3d_m",tgt_grid,false,true ,true, std::min(SCREAM_PACK_SIZE,8));
   auto tgt_v3d_i = create_field("v3d_i",tgt_grid,false,true ,false,std::min(SCREAM_PACK_SIZE,16));
 
-  std::vector<Field> src_f = {src_s2d,src_v2d,src_s3d_m,src_s3d_i,src_v3d_m,src_v3d_i};
-  std::vector<Field> tgt_f = {tgt_s2d,tgt_v2d,tgt_s3d_m,tgt_s3d_i,tgt_v3d_m,tgt_v3d_i};
+  // Also remap a subfield, whose columns are not contiguous in memory
+  auto src_v3d_p = create_field("v3d_p",src_grid,false,true ,true, std::min(SCREAM_PACK_SIZE,4));
+  auto tgt_v3d_p = create_field("v3d_p",tgt_grid,false,true ,true, std::min(SCREAM_PACK_SIZE,4));
+  auto src_s3d_c = src_v3d_p.get_component(1);
+  auto tgt_s3d_c = tgt_v3d_p.get_component(1);
+
+  std::vector<Field> src_f = {src_s2d,src_v2d,src_s3d_m,src_s3d_i,src_v3d_m,src_v3d_i,src_s3d_c};
+  std::vector<Field> tgt_f = {tgt_s2d,tgt_v2d,tgt_s3d_m,tgt_s3d_i,tgt_v3d_m,tgt_v3d_i,tgt_s3d_c};
 
   const int nfields = src_f.size();
 
@@ -243,6 +252,7 @@ TEST_CASE ("coarsening_remap") {
   remap->register_field(src_s3d_i,tgt_s3d_i);
   remap->register_field(src_v3d_m,tgt_v3d_m);
   remap->register_field(src_v3d_i,tgt_v3d_i);
+  remap->register_field(src_s3d_c,tgt_s3d_c);
   remap->registration_ends();
   print (" -> registering fields ... done!\n",comm);
 
@@ -345,6 +355,23 @@ TEST_CASE ("coarsening_remap") {
       REQUIRE (recv_lids_pidpos(2*i+1,0)==pid2);
     }
   }
+  // All contributions are stored in the recv buffer, grouped by pid
+  const auto recv_pid_start = remap->get_recv_pid_start();
+  REQUIRE (recv_pid_start(0)==0);
+  REQUIRE (recv_pid_start(comm.size())==recv_lids_end(num_loc_tgt_gids-1));
+
+  // The stacked columns contain all fields, one after the other
+  const auto col_entries = remap->get_col_entries();
+  REQUIRE (remap->get_stacked_col_size()==sum_fields_col_sizes);
+  for (int i=0; i<nfields; ++i) {
+    const auto& fl = src_f[i].get_header().get_identifier().get_layout();
+    const int last_dim = fl.rank()>1 ? fl.dims().back() : 1;
+    for (int j=field_col_offset[i]; j<field_col_offset[i+1]; ++j) {
+      const int pos = j - field_col_offset[i];
+      REQUIRE (col_entries(j,0)==i);
+      REQUIRE (col_entries(j,1)*last_dim+col_entries(j,2)==pos);
+    }
+  }
   print (" -> Checking remapper internal state ... OK!\n",comm);
 
   // -------------------------------------- //
@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 #include <numeric>
+#include <cstdint>
 
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 #include "share/field/field_identifier.hpp"
@@ -330,6 +331,47 @@ TEST_CASE("field", "") {
       }
     }
   }
+
+  SECTION ("sync") {
+    Field f(fid);
+    f.allocate_view();
+
+    // On host-space builds, syncs are no-ops
+    const bool same_views = f.get_internal_view_data<const char,Host>()==
+                            f.get_internal_view_data<const char>();
+    const long long nbytes = same_views ? 0 : f.get_header().get_alloc_properties().get_alloc_size();
+
+    f.deep_copy(1.0);
+    Field::reset_sync_stats();
+
+    // Device was modified: the first sync copies, the second does nothing
+    f.sync_to_host();
+    f.sync_to_host();
+    REQUIRE (Field::get_sync_stats().bytes_to_host==nbytes);
+    auto vh = f.get_view<const Real**,Host>();
+    REQUIRE (vh(0,0)==1.0);
+
+    // Updating the time stamp marks the device as modified
+    util::TimeStamp t0 ({2000,1,1},{0,0,0});
+    f.get_header().get_tracking().update_time_stamp(t0);
+    f.sync_to_host();
+    REQUIRE (Field::get_sync_stats().bytes_to_host==2*nbytes);
+
+    // Host was never handed out as writable: nothing to copy
+    f.sync_to_dev();
+    REQUIRE (Field::get_sync_stats().bytes_to_dev==0);
+
+    // Once a writable host view is handed out, sync_to_dev always copies
+    auto vh_nc = f.get_view<Real**,Host>();
+    vh_nc(0,0) = 2.0;
+    f.sync_to_dev();
+    vh_nc(0,0) = 3.0;
+    f.sync_to_dev();
+    REQUIRE (Field::get_sync_stats().bytes_to_dev==2*nbytes);
+    auto vd_hm = Kokkos::create_mirror_view(f.get_view<const Real**>());
+    Kokkos::deep_copy(vd_hm,f.get_view<const Real**>());
+    REQUIRE (vd_hm(0,0)==3.0);
+  }
 }
 
 TEST_CASE("field_group") {
@@ -522,6 +564,66 @@ TEST_CASE("field_mgr", "") {
   REQUIRE (views_are_equal(f4_sf,f4.get_component(subview_slice)));
 }
 
+TEST_CASE("field_mgr_arenas", "") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+  using FR = FieldRequest;
+  using Pack = ekat::Pack<Real,8>;
+
+  const int ncols = 4;
+  const int nlevs = 7;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto pg = create_point_grid("phys",ncols*comm.size(),nlevs,comm);
+  const auto lt = pg->get_3d_scalar_layout(true);
+
+  FieldManager field_mgr(pg);
+  field_mgr.registration_begins();
+  for (int i=0; i<10; ++i) {
+    FieldIdentifier fid("field_" + std::to_string(i),lt,m/s,pg->name());
+    field_mgr.register_field(FR(fid,i%2==0 ? Pack::n : 1));
+  }
+  field_mgr.register_field(FR{FieldIdentifier("qv",lt,kg/kg,pg->name()),"tracers"});
+  field_mgr.register_field(FR{FieldIdentifier("qc",lt,kg/kg,pg->name()),"tracers"});
+  field_mgr.register_group(GroupRequest("tracers",pg->name(),Bundling::Required));
+
+  // Small arenas, so that we need more than one
+  const long long arena_size = 4*ncols*nlevs*sizeof(Pack);
+  field_mgr.set_arena_size(arena_size);
+  field_mgr.registration_ends();
+  REQUIRE_THROWS (field_mgr.set_arena_size(arena_size));
+
+  const auto& arenas = field_mgr.get_arenas();
+  REQUIRE (arenas.size()>1);
+  int num_fields = 0;
+  for (const auto& a : arenas) {
+    REQUIRE (a->used()<=a->capacity());
+    num_fields += a->num_fields();
+  }
+  // 10 fields, plus the tracers bundle
+  REQUIRE (num_fields==11);
+
+  // Carved fields must be zero-initialized, must not overlap, and must be aligned to their pack size
+  auto engine = setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  RPDF pdf(0.0,1.0);
+  std::vector<Field> fields, copies;
+  for (int i=0; i<10; ++i) {
+    auto f = field_mgr.get_field("field_" + std::to_string(i));
+    const auto ptr = reinterpret_cast<std::uintptr_t>(f.get_internal_view_data<const Real>());
+    REQUIRE (ptr % FieldArena::get_alignment(f) == 0);
+    // Carved fields are zeroed by the arena first touch
+    REQUIRE (frobenius_norm<Real>(f)==0);
+    randomize(f,engine,pdf);
+    fields.push_back(f);
+    copies.push_back(f.clone());
+  }
+  for (int i=0; i<10; ++i) {
+    REQUIRE (views_are_equal(fields[i],copies[i]));
+  }
+}
+
 TEST_CASE("tracers_bundle", "") {
   using namespace scream;
   using namespace ekat::units;
@@ -5,6 +5,7 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_upper_bound_check.hpp"
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/property_check_batch.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/grid/point_grid.hpp"
 
@@ -273,6 +274,66 @@ TEST_CASE("property_checks", "") {
       REQUIRE(f_data[i] == 1.0);
     }
   }
+
+  // Check that fused checks give the same results as the individual checks
+  SECTION ("property_check_batch") {
+    const auto cfh = CheckFailHandling::Fatal;
+
+    // A strided subfield, to check that the batch handles strides correctly
+    auto f1 = f.get_component(1);
+    auto nan_check = std::make_shared<FieldNaNCheck>(f,grid);
+    auto lb_check  = std::make_shared<FieldLowerBoundCheck>(f1,grid,0,true,-1);
+    auto ub_check  = std::make_shared<FieldUpperBoundCheck>(f,grid,1);
+
+    f.deep_copy(0.5);
+
+    PropertyCheckBatch batch;
+    batch.add_check(cfh,nan_check);
+    batch.add_check(cfh,lb_check);
+    batch.add_check(cfh,ub_check);
+    REQUIRE (batch.get_num_fused_checks()==3);
+    REQUIRE (batch.get_unfused_checks().size()==0);
+    REQUIRE (batch.run().size()==0);
+
+    // Component 0 is not checked by lb_check
+    auto f_view = f.get_view<Real***,Host>();
+    f_view(1,0,3) = -2;
+    f.sync_to_dev();
+    REQUIRE (batch.run().size()==0);
+
+    f_view(1,1,3) = -0.5;
+    f_view(0,2,5) = 2;
+    f.sync_to_dev();
+    auto failed = batch.run();
+    REQUIRE (failed.size()==2);
+    REQUIRE (failed.front().pc==lb_check);
+    REQUIRE (failed.front().result==CheckResult::Repairable);
+    REQUIRE (lb_check->check().result==CheckResult::Repairable);
+    REQUIRE (failed.back().pc==ub_check);
+    REQUIRE (failed.back().result==CheckResult::Fail);
+    REQUIRE (ub_check->check().result==CheckResult::Fail);
+
+    f_view(0,2,5) = std::numeric_limits<Real>::quiet_NaN();
+    f.sync_to_dev();
+    failed = batch.run();
+    REQUIRE (failed.size()==2);
+    REQUIRE (failed.front().pc==nan_check);
+    REQUIRE (failed.front().result==CheckResult::Fail);
+
+    // In lazy mode, results are retrieved at the next call, and checks that
+    // can repair are not fused
+    PropertyCheckBatch lazy_batch(true);
+    lazy_batch.add_check(cfh,nan_check);
+    lazy_batch.add_check(cfh,lb_check);
+    REQUIRE (lazy_batch.get_num_fused_checks()==1);
+    REQUIRE (lazy_batch.get_unfused_checks().size()==1);
+    REQUIRE (lazy_batch.run().size()==0);
+    f.deep_copy(0.5);
+    failed = lazy_batch.run();
+    REQUIRE (failed.size()==1);
+    REQUIRE (failed.front().pc==nan_check);
+    REQUIRE (lazy_batch.flush().size()==0);
+  }
 }
 
 } // anonymous namespace
@@ -352,5 +352,38 @@ TEST_CASE("testing_masking"){
     }
   }
 
+  //Check that an interpolation plan gives the same answer for several fields,
+  //and that it is recomputed only when the coordinates change
+  VerticalInterpolationPlan<Real,N> plan(2,n_layers_src,n_layers_tgt,mod_mask_val);
+  util::TimeStamp ts ({2000,1,1},{0,0,0});
+  REQUIRE (plan.setup(p_src,p_tgt,ts));
+  REQUIRE (not plan.setup(p_src,p_tgt,ts));
+  REQUIRE (plan.num_setups()==1);
+
+  auto out_plan_1 = view_2d<Pack<Real,N>>("",2,npacks_tgt);
+  auto out_plan_2 = view_2d<Pack<Real,N>>("",2,npacks_tgt);
+  plan.interpolate(p_src,p_tgt,{tmp_src,tmp_src},{out_plan_1,out_plan_2});
+
+  auto mask_plan_h = Kokkos::create_mirror_view(plan.get_mask());
+  Kokkos::deep_copy(mask_plan_h,plan.get_mask());
+  for (auto out_plan : {out_plan_1, out_plan_2}) {
+    auto out_plan_h = Kokkos::create_mirror_view(out_plan);
+    Kokkos::deep_copy(out_plan_h,out_plan);
+    auto out_plan_h_s = ekat::scalarize(out_plan_h);
+    for(int col=0; col<2; col++){
+      for(int lev=0; lev<17; lev++){
+        REQUIRE(out_plan_h_s(col,lev) == correct_val[col][lev]);
+        check_mask<N>(mask_plan_h,col,lev);
+      }
+    }
+  }
+
+  // A new time stamp, or an explicit invalidation, trigger a new setup
+  REQUIRE (plan.setup(p_src,p_tgt,ts+1));
+  plan.invalidate();
+  REQUIRE (not plan.is_valid());
+  REQUIRE_THROWS (plan.interpolate(p_src,p_tgt,{tmp_src},{out_plan_1}));
+  REQUIRE (plan.setup(p_src,p_tgt,ts+1));
+  REQUIRE (plan.num_setups()==3);
 }
 
@@ -2,11 +2,14 @@
 #define SCREAM_VERTICAL_INTERPOLATION_HPP
 
 #include "share/scream_types.hpp"
+#include "share/util/scream_time_stamp.hpp"
 
 #include "ekat/util/ekat_lin_interp.hpp"
 #include "ekat/ekat_pack_utils.hpp"
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
+#include <vector>
+
 namespace scream {
 namespace vinterp {
 
@@ -24,6 +27,8 @@ namespace vinterp {
  *There is a function, perform_vertical_interpolation_impl_1d which 
  *where what is provided is all 1d views (or lambdas). However, in this 
  *case the user must provide the team and ekat::LinInterp as input as well.
+ *If several fields are interpolated between the same levels (possibly
+ *over several calls), use a VerticalInterpolationPlan (see below).
  */
 
 // ------- Types --------
@@ -124,6 +129,92 @@ void perform_vertical_interpolation_impl_1d(
   const MemberType& team,
   const LIV<T,N>& vert_interp);
 
+/*
+ * A reusable plan to interpolate several fields between the same src and tgt levels.
+ *
+ * The expensive part of the interpolation is the search of the src levels
+ * bracketing each tgt level. The plan stores the result of the search (in
+ * an ekat::LinInterp object), together with the mask of out-of-bounds tgt
+ * levels, so that they are computed once, and then reused for all fields,
+ * which are interpolated with a single kernel launch.
+ *
+ * The search is redone only if the plan is not valid. A plan becomes invalid if
+ * setup is called with different coordinate views, or with a different time stamp,
+ * or if invalidate() is called. Callers should pass the time stamp of the fields
+ * storing the coordinates (e.g., the pressure), so that setup is a no-op until
+ * the coordinates are updated.
+ *
+ * The tgt levels can be a 1d view (same levels for all columns) or a 2d view.
+ */
+template<typename T, int N>
+class VerticalInterpolationPlan {
+public:
+  using pack_type = Pack<T,N>;
+  using mask_type = Mask<N>;
+
+  VerticalInterpolationPlan (const int ncols, const int nlevs_src, const int nlevs_tgt,
+                             const Real msk_val = masked_val);
+
+  // Compute src levels brackets and mask, unless the plan is still valid.
+  // Returns true if the plan was (re)computed.
+  template<typename Src, typename Tgt>
+  bool setup (const Src& x_src, const Tgt& x_tgt, const util::TimeStamp& coords_ts);
+
+  // Force the plan to be recomputed at the next call to setup
+  void invalidate () { m_valid = false; }
+  bool is_valid () const { return m_valid; }
+
+  // Interpolate all inputs onto the corresponding outputs, with a single kernel.
+  // Out-of-bounds entries are set to the mask value.
+  // Note: x_src/x_tgt must be the same views (with the same values) passed to setup.
+  template<typename Src, typename Tgt>
+  void interpolate (const Src& x_src, const Tgt& x_tgt,
+                    const std::vector<view_2d<const pack_type>>& inputs,
+                    const std::vector<view_2d<pack_type>>& outputs);
+
+  // The mask of out-of-bounds tgt levels (the same for all fields)
+  const view_2d<mask_type>& get_mask () const { return m_mask; }
+
+  int num_setups () const { return m_num_setups; }
+
+// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+#ifndef EAMXX_ENABLE_GPU
+protected:
+#endif
+  template<typename Src, typename Tgt>
+  void setup_impl (const Src& x_src, const Tgt& x_tgt);
+
+protected:
+
+  // Device-friendly description of an input/output pair
+  struct FieldDesc {
+    const pack_type* in;
+    pack_type*       out;
+    int              in_stride;
+    int              out_stride;
+  };
+  using descs_dev  = view_1d<FieldDesc>;
+  using descs_host = typename descs_dev::HostMirror;
+
+  int   m_ncols;
+  int   m_nlevs_src;
+  int   m_nlevs_tgt;
+  Real  m_msk_val;
+
+  LIV<T,N>            m_lin_interp;
+  view_2d<mask_type>  m_mask;
+
+  // What the plan was computed for
+  bool                m_valid = false;
+  const void*         m_x_src_data = nullptr;
+  const void*         m_x_tgt_data = nullptr;
+  util::TimeStamp     m_coords_ts;
+  int                 m_num_setups = 0;
+
+  descs_dev           m_descs;
+  descs_host          m_descs_h;
+};
+
 } // namespace vinterp
 } // namespace scream
 
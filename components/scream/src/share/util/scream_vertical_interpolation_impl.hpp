@@ -131,7 +131,174 @@ void perform_vertical_interpolation_impl_1d(
   });
   team.team_barrier();
 }
-  
+
+namespace impl {
+
+// The tgt levels of a column, for 1d (same levels for all cols) or 2d tgt views
+template<typename V>
+KOKKOS_INLINE_FUNCTION
+typename std::enable_if<V::rank==1,V>::type
+tgt_column (const V& x_tgt, const int /* icol */) {
+  return x_tgt;
+}
+
+template<typename V>
+KOKKOS_INLINE_FUNCTION
+auto tgt_column (const V& x_tgt, const int icol)
+ -> typename std::enable_if<V::rank==2,decltype(ekat::subview(x_tgt,icol))>::type
+{
+  return ekat::subview(x_tgt,icol);
+}
+
+} // namespace impl
+
+template<typename T, int N>
+VerticalInterpolationPlan<T,N>::
+VerticalInterpolationPlan (const int ncols, const int nlevs_src, const int nlevs_tgt,
+                           const Real msk_val)
+ : m_ncols (ncols)
+ , m_nlevs_src (nlevs_src)
+ , m_nlevs_tgt (nlevs_tgt)
+ , m_msk_val (msk_val)
+ , m_lin_interp (ncols,nlevs_src,nlevs_tgt)
+{
+  const int npacks_tgt = ekat::PackInfo<N>::num_packs(nlevs_tgt);
+  m_mask = view_2d<mask_type>("vinterp_plan_mask",ncols,npacks_tgt);
+}
+
+template<typename T, int N>
+template<typename Src, typename Tgt>
+bool VerticalInterpolationPlan<T,N>::
+setup (const Src& x_src, const Tgt& x_tgt, const util::TimeStamp& coords_ts)
+{
+  if (m_valid && coords_ts==m_coords_ts &&
+      x_src.data()==m_x_src_data && x_tgt.data()==m_x_tgt_data) {
+    return false;
+  }
+
+  const int npacks_src = ekat::PackInfo<N>::num_packs(m_nlevs_src);
+  const int npacks_tgt = ekat::PackInfo<N>::num_packs(m_nlevs_tgt);
+  EKAT_REQUIRE_MSG (x_src.extent_int(0)==m_ncols && x_src.extent_int(1)==npacks_src,
+      "Error! Src levels view has the wrong extents.\n");
+  EKAT_REQUIRE_MSG (x_tgt.extent_int(Tgt::rank-1)==npacks_tgt,
+      "Error! Tgt levels view has the wrong extents.\n");
+  EKAT_REQUIRE_MSG (Tgt::rank==1 || x_tgt.extent_int(0)==m_ncols,
+      "Error! Tgt levels view has the wrong number of columns.\n");
+
+  setup_impl(x_src,x_tgt);
+
+  m_valid = true;
+  m_x_src_data = x_src.data();
+  m_x_tgt_data = x_tgt.data();
+  m_coords_ts  = coords_ts;
+  ++m_num_setups;
+  return true;
+}
+
+template<typename T, int N>
+template<typename Src, typename Tgt>
+void VerticalInterpolationPlan<T,N>::
+setup_impl (const Src& x_src, const Tgt& x_tgt)
+{
+  const auto vert_interp = m_lin_interp;
+  const auto mask = m_mask;
+  const int nlevs_src = m_nlevs_src;
+  const int npacks_tgt = mask.extent(1);
+  const auto policy = ESU::get_default_team_policy(m_ncols, npacks_tgt);
+  Kokkos::parallel_for("scream_vert_interp_plan_setup", policy,
+               KOKKOS_LAMBDA(MemberType const& team) {
+    const int icol = team.league_rank();
+    const auto x1 = ekat::subview(x_src, icol);
+    const auto x2 = impl::tgt_column(x_tgt, icol);
+    const auto msk = ekat::subview(mask, icol);
+
+    vert_interp.setup(team, x1, x2);
+
+    //Mask out values above (below) maximum (minimum) source grid
+    const auto x_src_s = ekat::scalarize(x1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npacks_tgt), [&] (const Int & k) {
+      const auto above_max = x2[k] > x_src_s[nlevs_src-1];
+      const auto below_min = x2[k] < x_src_s[0];
+      msk(k) = above_max || below_min;
+    });
+  });
+}
+
+template<typename T, int N>
+template<typename Src, typename Tgt>
+void VerticalInterpolationPlan<T,N>::
+interpolate (const Src& x_src, const Tgt& x_tgt,
+             const std::vector<view_2d<const pack_type>>& inputs,
+             const std::vector<view_2d<pack_type>>& outputs)
+{
+  EKAT_REQUIRE_MSG (m_valid,
+      "Error! VerticalInterpolationPlan::interpolate called before setup (or after invalidate).\n");
+  EKAT_REQUIRE_MSG (x_src.data()==m_x_src_data && x_tgt.data()==m_x_tgt_data,
+      "Error! VerticalInterpolationPlan::interpolate called with coordinates different from setup.\n");
+  EKAT_REQUIRE_MSG (inputs.size()==outputs.size(),
+      "Error! Inputs and outputs lists have different sizes.\n");
+
+  const int nfields = inputs.size();
+  if (nfields==0) {
+    return;
+  }
+
+  const int npacks_src = ekat::PackInfo<N>::num_packs(m_nlevs_src);
+  const int npacks_tgt = ekat::PackInfo<N>::num_packs(m_nlevs_tgt);
+
+  // Update the fields descriptors, copying them to device only if something changed
+  if (m_descs.extent_int(0)!=nfields) {
+    m_descs   = descs_dev("vinterp_plan_descs",nfields);
+    m_descs_h = Kokkos::create_mirror_view(m_descs);
+  }
+  bool changed = false;
+  for (int i=0; i<nfields; ++i) {
+    const auto& in  = inputs[i];
+    const auto& out = outputs[i];
+    EKAT_REQUIRE_MSG (in.extent_int(0)==m_ncols && in.extent_int(1)==npacks_src,
+        "Error! Input view has the wrong extents.\n");
+    EKAT_REQUIRE_MSG (out.extent_int(0)==m_ncols && out.extent_int(1)==npacks_tgt,
+        "Error! Output view has the wrong extents.\n");
+
+    auto& d = m_descs_h(i);
+    if (d.in!=in.data() || d.out!=out.data()) {
+      d.in  = in.data();
+      d.out = out.data();
+      d.in_stride  = in.stride(0);
+      d.out_stride = out.stride(0);
+      changed = true;
+    }
+  }
+  if (changed) {
+    Kokkos::deep_copy(m_descs,m_descs_h);
+  }
+
+  const auto vert_interp = m_lin_interp;
+  const auto mask = m_mask;
+  const auto descs = m_descs;
+  const auto msk_val = m_msk_val;
+  const auto policy = ESU::get_default_team_policy(m_ncols*nfields, npacks_tgt);
+  Kokkos::parallel_for("scream_vert_interp_plan_loop", policy,
+               KOKKOS_LAMBDA(MemberType const& team) {
+    const int icol = team.league_rank() / nfields;
+    const int ifld = team.league_rank() % nfields;
+    const auto& d = descs(ifld);
+
+    const auto x1 = ekat::subview(x_src, icol);
+    const auto x2 = impl::tgt_column(x_tgt, icol);
+    const auto msk = ekat::subview(mask, icol);
+    ekat::Unmanaged<view_1d<const pack_type>> y1(d.in + icol*d.in_stride, npacks_src);
+    ekat::Unmanaged<view_1d<pack_type>> y2(d.out + icol*d.out_stride, npacks_tgt);
+
+    vert_interp.lin_interp(team, x1, x2, y1, y2, icol);
+    team.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npacks_tgt), [&] (const Int & k) {
+      y2(k).set(msk(k),msk_val);
+    });
+  });
+}
+
 } // namespace vinterp
 } // namespace scream
 
@@ -9,6 +9,7 @@
 
 #include "ekat/ekat_parse_yaml_file.hpp"
 
+#include <chrono>
 #include <iomanip>
 
 namespace scream {
@@ -67,6 +68,38 @@ TEST_CASE("shoc-stand-alone", "") {
     }
   }
 
+  // Timing comparison: run some more SHOC steps back to back, first waiting for the
+  // device only at the end, then fencing after each step (i.e., what SHOC costs
+  // if anything in it forces a host synchronization, as the npbl host round-trip
+  // used to do). Only the first set can overlap host-side work with the kernels.
+  {
+    using clock = std::chrono::steady_clock;
+    auto shoc = ad.get_atm_processes()->get_process_nonconst(0);
+
+    Kokkos::fence();
+    auto start = clock::now();
+    for (int i=0; i<nsteps; ++i) {
+      shoc->run(dt);
+    }
+    auto host_done = clock::now();
+    Kokkos::fence();
+    auto async_done = clock::now();
+
+    for (int i=0; i<nsteps; ++i) {
+      shoc->run(dt);
+      Kokkos::fence();
+    }
+    auto sync_done = clock::now();
+
+    using usec = std::chrono::duration<double,std::micro>;
+    if (atm_comm.am_i_root()) {
+      printf("SHOC timing, per step (%d steps):\n",nsteps);
+      printf("  - no fences, host only   : %12.3f us\n",usec(host_done-start).count()/nsteps);
+      printf("  - no fences, with device : %12.3f us\n",usec(async_done-start).count()/nsteps);
+      printf("  - fence after each step  : %12.3f us\n",usec(sync_done-async_done).count()/nsteps);
+    }
+  }
+
   // TODO: get the field repo from the driver, and go get (one of)
   //       the output(s) of SHOC, to check its numerical value (if possible)
 
@@ -0,0 +1,187 @@
+#include "control/atmosphere_driver.hpp"
+#include "control/atmosphere_surface_coupling_importer.hpp"
+#include "control/atmosphere_surface_coupling_exporter.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/scream_session.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Benchmark for the per-step cost of surface coupling.
+ *
+ * Runs an AD with only the SurfaceCouplingImporter and SurfaceCouplingExporter
+ * processes, and times AtmosphereDriver::run. Each step imports all the scream
+ * imports from the cpl import array, and exports all the scream exports (plus
+ * zeros for the cpl exports not set by scream) to the cpl export array.
+ * If the default device can access host memory, the cpl arrays are used
+ * directly by the import/export kernels (no copies).
+ */
+
+namespace {
+
+using namespace scream;
+using namespace scream::control;
+
+template<typename DataT>
+using view_1d_host = KokkosTypes<HostDevice>::view_1d<DataT>;
+using view_2d_host = KokkosTypes<HostDevice>::view_2d<Real>;
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+// Setup the cpl indices (the first num_scream fields of the cpl array are the scream ones),
+// and the other coupling info, for import/export fields with the given names
+struct CouplingData {
+  CouplingData (const std::vector<std::string>& names, const int num_extra, const int ncols)
+   : num_scream (names.size())
+   , num_cpl    (names.size()+num_extra)
+   , data               ("data",ncols,num_cpl)
+   , cpl_indices        ("cpl_indices",num_scream)
+   , vec_comps          ("vec_comps",num_scream)
+   , constant_multiple  ("constant_multiple",num_scream)
+   , transfer_during_init ("transfer_during_init",num_scream)
+   , names_buf (32*num_scream,'\0')
+  {
+    Kokkos::deep_copy(data,1.0);
+    Kokkos::deep_copy(constant_multiple,1.0);
+    Kokkos::deep_copy(transfer_during_init,false);
+    int next_comp = 0;
+    for (int i=0; i<num_scream; ++i) {
+      cpl_indices(i) = i;
+
+      // Vector fields appear twice in a row (one per component)
+      const bool is_vec = (i>0 && names[i]==names[i-1]) ||
+                          (i<num_scream-1 && names[i]==names[i+1]);
+      vec_comps(i) = is_vec ? next_comp++ : -1;
+      if (not is_vec) {
+        next_comp = 0;
+      }
+      std::strncpy(&names_buf[32*i],names[i].c_str(),31);
+    }
+  }
+
+  int num_scream;
+  int num_cpl;
+  view_2d_host       data;
+  view_1d_host<int>  cpl_indices;
+  view_1d_host<int>  vec_comps;
+  view_1d_host<Real> constant_multiple;
+  view_1d_host<bool> transfer_during_init;
+  std::vector<char>  names_buf;
+};
+
+void run (const ekat::Comm& comm, const int ncol, const int num_extra, const int nsteps)
+{
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  parse_yaml_file("surface_coupling_bench.yaml",ad_params);
+  ad_params.sublist("grids_manager").set("number_of_global_columns",ncol*comm.size());
+
+  auto& ts = ad_params.sublist("Time Stepping");
+  util::TimeStamp t0 (ts.get<std::vector<int>>("Start Date"), ts.get<std::vector<int>>("Start Time"));
+
+  auto& proc_factory = AtmosphereProcessFactory::instance();
+  auto& gm_factory = GridsManagerFactory::instance();
+  proc_factory.register_product("SurfaceCouplingImporter",&create_atmosphere_process<SurfaceCouplingImporter>);
+  proc_factory.register_product("SurfaceCouplingExporter",&create_atmosphere_process<SurfaceCouplingExporter>);
+  gm_factory.register_product("Mesh Free",&create_mesh_free_grids_manager);
+
+  AtmosphereDriver ad;
+  ad.set_comm(comm);
+  ad.set_params(ad_params);
+  ad.init_scorpio ();
+  ad.create_atm_processes ();
+  ad.create_grids ();
+  ad.create_fields ();
+
+  const int nlcols = ad.get_grids_manager()->get_grid("Physics")->get_num_local_dofs();
+
+  // Same imports/exports as in the surface_coupling test
+  CouplingData imports ({"sfc_alb_dir_vis", "sfc_alb_dir_nir", "sfc_alb_dif_vis", "sfc_alb_dif_nir",
+                         "surf_radiative_T", "T_2m", "qv_2m", "wind_speed_10m", "snow_depth_land",
+                         "surf_lw_flux_up", "surf_mom_flux", "surf_mom_flux", "surf_sens_flux",
+                         "surf_evap"}, num_extra, nlcols);
+  CouplingData exports ({"Sa_z", "horiz_winds", "horiz_winds", "T_mid", "Sa_ptem", "p_mid", "qv",
+                         "Sa_dens", "Sa_pslv", "Faxa_rainl", "Faxa_snowl", "sfc_flux_dir_nir",
+                         "sfc_flux_dir_vis", "sfc_flux_dif_nir", "sfc_flux_dif_vis",
+                         "sfc_flux_sw_net", "sfc_flux_lw_dn"}, num_extra, nlcols);
+
+  auto setup_sc_data = [&](const SurfaceCouplingTransferType type, CouplingData& cd) {
+    ad.setup_surface_coupling_data_manager(type, cd.num_cpl, cd.num_scream, nlcols, cd.data.data(),
+                                           cd.names_buf.data(), cd.cpl_indices.data(), cd.vec_comps.data(),
+                                           cd.constant_multiple.data(), cd.transfer_during_init.data());
+  };
+  setup_sc_data(SurfaceCouplingTransferType::Import,imports);
+  setup_sc_data(SurfaceCouplingTransferType::Export,exports);
+
+  ad.initialize_fields (t0, t0);
+  ad.initialize_output_managers ();
+  ad.initialize_atm_procs ();
+
+  using clock = std::chrono::steady_clock;
+
+  const int dt = 300;
+  ad.run(dt);
+  Kokkos::fence();
+  auto start = clock::now();
+  for (int n=0; n<nsteps; ++n) {
+    ad.run(dt);
+  }
+  Kokkos::fence();
+  auto finish = clock::now();
+  const double usec = std::chrono::duration<double,std::micro>(finish-start).count();
+
+  if (comm.am_i_root()) {
+    const bool zero_copy = std::is_same<DefaultDevice::memory_space,HostDevice::memory_space>::value;
+    printf("surface_coupling_bench: ncol=%d, cpl imports=%d, cpl exports=%d, nsteps=%d, nranks=%d\n",
+           ncol, imports.num_cpl, exports.num_cpl, nsteps, comm.size());
+    printf("  zero-copy cpl arrays: %s\n", zero_copy ? "yes" : "no");
+    printf("  import+export:        %12.3f us/step\n", usec/nsteps);
+  }
+
+  ad.finalize();
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  int ncol = 218;
+  int num_extra = 10;
+  int nsteps = 100;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      ncol = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-e", "--num-extra")) {
+      expect_another_arg(i, argc);
+      ++i;
+      num_extra = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-n", "--nsteps")) {
+      expect_another_arg(i, argc);
+      ++i;
+      nsteps = std::atoi(argv[i]);
+    }
+  }
+  EKAT_REQUIRE_MSG(ncol > 0 && num_extra >= 0 && nsteps > 0,
+      "Usage: " << argv[0] << " [-i <cols per rank>] [-e <non-scream cpl fields>] [-n <nsteps>]\n");
+
+  MPI_Init(&argc,&argv);
+  scream::initialize_scream_session(argc, argv); {
+    ekat::Comm comm(MPI_COMM_WORLD);
+    run(comm, ncol, num_extra, nsteps);
+  } scream::finalize_scream_session();
+  MPI_Finalize();
+
+  return 0;
+}